@@ -35,7 +35,9 @@
 #
 ##########################################################################
 
+import os
 import sys
+import json
 import pathlib
 import traceback
 
@@ -111,6 +113,18 @@ class execute( Gaffer.Application ) :
 					},
 				),
 
+				IECore.BoolParameter(
+					name = "worker",
+					description = "Runs as a persistent worker process, reading execution "
+						"requests from stdin and writing the results to stdout. Each request "
+						"is a single line of JSON specifying the `script`, `ignoreScriptLoadErrors`, "
+						"`nodes`, `frames` and `context` to execute. The script is only reloaded "
+						"when it differs from the previous request or has been modified, so caches "
+						"remain warm between requests. This is used by the LocalDispatcher, and "
+						"is not intended for general use.",
+					defaultValue = False,
+				),
+
 			]
 
 		)
@@ -123,19 +137,38 @@ class execute( Gaffer.Application ) :
 
 	def _run( self, args ) :
 
+		if args["worker"].value :
+			return self.__runWorker( args )
+
+		scriptNode = self.__loadScript( args["script"].value, args["ignoreScriptLoadErrors"].value )
+		if scriptNode is None :
+			return 1
+
+		return self.__execute(
+			scriptNode, list( args["nodes"] ),
+			self.parameters()["frames"].getFrameListValue().asList(),
+			list( args["context"] )
+		)
+
+	def __loadScript( self, fileName, ignoreScriptLoadErrors ) :
+
 		scriptNode = Gaffer.ScriptNode()
-		scriptNode["fileName"].setValue( pathlib.Path( args["script"].value ).absolute() )
+		scriptNode["fileName"].setValue( pathlib.Path( fileName ).absolute() )
 		try :
-			scriptNode.load( continueOnError = args["ignoreScriptLoadErrors"].value )
+			scriptNode.load( continueOnError = ignoreScriptLoadErrors )
 		except Exception as exception :
 			IECore.msg( IECore.Msg.Level.Error, "gaffer execute : loading \"%s\"" % scriptNode["fileName"].getValue(), str( exception ) )
-			return 1
+			return None
 
 		self.root()["scripts"].addChild( scriptNode )
 
+		return scriptNode
+
+	def __execute( self, scriptNode, nodeNames, frames, contextArgs ) :
+
 		nodes = []
-		if len( args["nodes"] ) :
-			for nodeName in args["nodes"] :
+		if len( nodeNames ) :
+			for nodeName in nodeNames :
 				node = scriptNode.descendant( nodeName )
 				if node is None :
 					IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Node \"%s\" does not exist" % nodeName )
@@ -152,16 +185,15 @@ class execute( Gaffer.Application ) :
 				IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Script has no executable nodes" )
 				return 1
 
-		if len(args["context"]) % 2 :
+		if len( contextArgs ) % 2 :
 			IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Context parameter must have matching entry/value pairs" )
 			return 1
 
 		context = Gaffer.Context( scriptNode.context() )
-		for i in range( 0, len(args["context"]), 2 ) :
-			entry = args["context"][i].lstrip( "-" )
-			context[entry] = eval( args["context"][i+1] )
+		for i in range( 0, len( contextArgs ), 2 ) :
+			entry = contextArgs[i].lstrip( "-" )
+			context[entry] = eval( contextArgs[i+1] )
 
-		frames = self.parameters()["frames"].getFrameListValue().asList()
 		if not frames :
 			frames = [ scriptNode.context().getFrame() ]
 
@@ -171,7 +203,7 @@ class execute( Gaffer.Application ) :
 
 		with context :
 			for node in nodes :
-				node.errorSignal().connect( Gaffer.WeakMethod( self.__error ), scoped = False )
+				errorConnection = node.errorSignal().connect( Gaffer.WeakMethod( self.__error ), scoped = True )
 				try :
 					node["task"].executeSequence( frames )
 				except Exception as exception :
@@ -189,6 +221,51 @@ class execute( Gaffer.Application ) :
 
 		return 0
 
+	def __runWorker( self, args ) :
+
+		# Reserve the original stdout for our responses, and redirect
+		# anything else written to it (by the tasks we execute) to stderr.
+		sys.stdout.flush()
+		responses = os.fdopen( os.dup( sys.stdout.fileno() ), "w", encoding = "utf-8" )
+		os.dup2( sys.stderr.fileno(), sys.stdout.fileno() )
+
+		# Load the initial script while we wait for the first request,
+		# which will most likely be for the same script.
+		fileName = pathlib.Path( args["script"].value ).absolute()
+		scriptKey = ( fileName, fileName.stat().st_mtime_ns, args["ignoreScriptLoadErrors"].value )
+		scriptNode = self.__loadScript( fileName, args["ignoreScriptLoadErrors"].value )
+		if scriptNode is None :
+			scriptKey = None
+
+		for line in sys.stdin :
+
+			try :
+				request = json.loads( line )
+				fileName = pathlib.Path( request["script"] ).absolute()
+				ignoreScriptLoadErrors = request.get( "ignoreScriptLoadErrors", False )
+				key = ( fileName, fileName.stat().st_mtime_ns, ignoreScriptLoadErrors )
+				if key != scriptKey :
+					if scriptNode is not None :
+						self.root()["scripts"].removeChild( scriptNode )
+					scriptNode = self.__loadScript( fileName, ignoreScriptLoadErrors )
+					scriptKey = key if scriptNode is not None else None
+				if scriptNode is not None :
+					result = self.__execute(
+						scriptNode, request.get( "nodes", [] ),
+						IECore.FrameList.parse( request.get( "frames", "" ) ).asList(),
+						request.get( "context", [] )
+					)
+				else :
+					result = 1
+			except Exception as exception :
+				IECore.msg( IECore.Msg.Level.Error, "gaffer execute", str( exception ) )
+				result = 1
+
+			responses.write( json.dumps( { "result" : result } ) + "\n" )
+			responses.flush()
+
+		return 0
+
 	def __error( self, plug, source, message ) :
 
 		IECore.msg(
@@ -81,6 +81,19 @@ class stats( Gaffer.Application ) :
 			```
 			gaffer stats fileName.gfr -image NameOfNode -performanceMonitor
 			```
+
+			To report which nodes occupy the cache after running a scene processing node :
+
+			```
+			gaffer stats fileName.gfr -scene NameOfNode -cache
+			```
+
+			To record a timeline of processes for viewing in `chrome://tracing`
+			or https://ui.perfetto.dev :
+
+			```
+			gaffer stats fileName.gfr -image NameOfNode -trace trace.json
+			```
 			"""
 		)
 
@@ -228,6 +241,16 @@ class stats( Gaffer.Application ) :
 					extensions = "gfr",
 				),
 
+				IECore.FileNameParameter(
+					name = "trace",
+					description = "Filename used to save a timeline of all the processes "
+						"run on each thread, in the Chrome Trace Event format. This may be "
+						"viewed in `chrome://tracing` or https://ui.perfetto.dev.",
+					defaultValue = "",
+					allowEmptyString = True,
+					extensions = "json",
+				),
+
 				IECore.BoolParameter(
 					name = "vtune",
 					description = "Enables VTune instrumentation. When enabled, the VTune "
@@ -267,6 +290,15 @@ class stats( Gaffer.Application ) :
 					defaultValue = 0,
 				),
 
+				IECore.BoolParameter(
+					name = "cache",
+					description = "Turns on per-node accounting for the ValuePlug cache, and "
+						"reports the memory usage, hits, misses and evictions for the nodes "
+						"and node types using the most memory. This is useful when choosing "
+						"a value for `-cacheMemoryLimit`.",
+					defaultValue = False,
+				),
+
 			]
 
 		)
@@ -283,6 +315,8 @@ class stats( Gaffer.Application ) :
 			Gaffer.ValuePlug.setCacheMemoryLimit( 1024 * 1024 * args["cacheMemoryLimit"].value )
 		if args["hashCacheSizeLimit"].value :
 			Gaffer.ValuePlug.setHashCacheSizeLimit( args["hashCacheSizeLimit"].value )
+		if args["cache"].value :
+			Gaffer.ValuePlug.setCacheStatisticsEnabled( True )
 
 		self.__timers = collections.OrderedDict()
 		self.__memory = collections.OrderedDict()
@@ -333,6 +367,8 @@ class stats( Gaffer.Application ) :
 		else :
 			self.__vtuneMonitor = None
 
+		self.__traceMonitor = Gaffer.TraceMonitor() if args["trace"].value else None
+
 		self.__output = open( args["outputFile"].value, "w" ) if args["outputFile"].value else sys.stdout
 
 		self.__writeVersion( script )
@@ -384,6 +420,10 @@ class stats( Gaffer.Application ) :
 
 		self.__output.write( "\n" )
 
+		self.__writeCache( script, args )
+
+		self.__output.write( "\n" )
+
 		self.__output.close()
 
 		if args["annotatedScript"].value :
@@ -397,6 +437,9 @@ class stats( Gaffer.Application ) :
 
 			script.serialiseToFile( args["annotatedScript"].value )
 
+		if self.__traceMonitor is not None :
+			self.__traceMonitor.writeChromeTrace( args["trace"].value )
+
 		return 0
 
 	def __writeVersion( self, script ) :
@@ -507,7 +550,7 @@ class stats( Gaffer.Application ) :
 		memory = _Memory.maxRSS()
 		# We don't expect serialisation to trigger any processes that the monitors would see,
 		# but we definitely want to know if they do.
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with _Timer() as timer :
 				script.serialise()
 
@@ -563,7 +606,7 @@ class stats( Gaffer.Application ) :
 			computeScene()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as sceneTimer :
 					computeScene()
@@ -605,7 +648,7 @@ class stats( Gaffer.Application ) :
 			computeImage()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as imageTimer :
 					computeImage()
@@ -640,7 +683,7 @@ class stats( Gaffer.Application ) :
 
 		memory = _Memory.maxRSS()
 		with _Timer() as taskTimer :
-			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext() :
 				with self.__context( script, args ) as context :
 					for frame in self.__frames( script, args ) :
 						context.setFrame( frame )
@@ -716,6 +759,65 @@ class stats( Gaffer.Application ) :
 
 			self.__writeItems( items )
 
+	def __writeCache( self, script, args ) :
+
+			if not args["cache"].value :
+				return
+
+			statistics = Gaffer.ValuePlug.cacheStatistics()
+
+			def describe( s ) :
+				return "{} ({} entries, {} hits, {} misses, {} evictions)".format(
+					_Memory( s.memoryUsage ), s.entries, s.hits, s.misses, s.evictions
+				)
+
+			scriptPrefix = script.fullName() + "."
+			def name( nodeName ) :
+				return nodeName[len(scriptPrefix):] if nodeName.startswith( scriptPrefix ) else nodeName
+
+			byType = collections.defaultdict( _CacheStatistics )
+			for s in statistics.values() :
+				byType[s.nodeType].add( s )
+
+			total = _CacheStatistics()
+			for s in byType.values() :
+				total.add( s )
+
+			n = args["maxLinesPerMetric"].value
+
+			self.__output.write( "Cache :\n\n" )
+			self.__writeItems( [
+				( "Limit", _Memory( Gaffer.ValuePlug.getCacheMemoryLimit() ) ),
+				( "Usage", _Memory( Gaffer.ValuePlug.cacheMemoryUsage() ) ),
+				( "Accounted", describe( total ) ),
+			] )
+
+			self.__output.write( "\nCache usage by node type :\n\n" )
+			items = sorted( byType.items(), key = lambda x : x[1].memoryUsage, reverse = True )
+			self.__writeItems( [ ( t, describe( s ) ) for t, s in items[:n] ] )
+
+			self.__output.write( "\nCache usage by node :\n\n" )
+			items = sorted( statistics.items(), key = lambda x : x[1].memoryUsage, reverse = True )
+			self.__writeItems( [ ( name( nodeName ), describe( s ) ) for nodeName, s in items[:n] ] )
+
+class _CacheStatistics( object ) :
+
+	def __init__( self ) :
+
+		self.entries = 0
+		self.memoryUsage = 0
+		self.hits = 0
+		self.misses = 0
+		self.evictions = 0
+
+	def add( self, other ) :
+
+		self.entries += other.entries
+		self.memoryUsage += other.memoryUsage
+		self.hits += other.hits
+		self.misses += other.misses
+		self.evictions += other.evictions
+
 class _Timer( object ) :
 
 	def __enter__( self ) :
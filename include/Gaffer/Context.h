@@ -48,6 +48,8 @@
 
 #include "boost/container/flat_map.hpp"
 
+#include <array>
+
 namespace Gaffer
 {
 
@@ -164,6 +166,9 @@ class GAFFER_API Context : public IECore::RefCounted
 		/// A signal emitted when an element of the context is changed.
 		ChangedSignal &changedSignal();
 
+		/// Returns a hash of all variables, excluding those with a "ui:" prefix.
+		/// This is updated incrementally as variables are set, so is very cheap
+		/// to call.
 		IECore::MurmurHash hash() const;
 
 		/// Return the hash of a particular variable ( or a default MurmurHash() if not present )
@@ -356,6 +361,30 @@ class GAFFER_API Context : public IECore::RefCounted
 
 		};
 
+		// Well-known variables that are accessed in performance-critical
+		// code are given fixed slots, so that they can be accessed without
+		// searching `m_map`. All other variables are stored in `m_map`.
+		static constexpr int g_numSlots = 6;
+		using Slots = std::array<Value, g_numSlots>;
+		inline static const IECore::InternedString *slotNames();
+		// Returns the slot index for `name`, or -1 if it doesn't have one.
+		inline static int slotIndex( const IECore::InternedString &name );
+		// Returns a hash of the characters of `name`, precomputed for slot
+		// names. Used in variable hashes in place of the address of the
+		// InternedString, so that hashes are identical between processes.
+		inline static IECore::MurmurHash nameHash( const IECore::InternedString &name );
+		// Returns the storage for `name`, which will be an unset Value
+		// (with `InvalidTypeId`) if the variable doesn't exist yet.
+		inline Value &internalStorage( const IECore::InternedString &name );
+		// Updates `m_hash` to account for the replacement of `oldValue`
+		// with `newValue`. Variable hashes are summed to form the context
+		// hash, so they can be added and removed in any order.
+		inline void updateHash( const Value &oldValue, const Value &newValue );
+
+		// Calls `f( name, value )` for every variable, including those in slots.
+		template<typename F>
+		void forEachVariable( F &&f ) const;
+
 		// Sets a variable and emits `changedSignal()` as appropriate. Does not
 		// manage ownership in any way. If ownership is required, the caller must
 		// update `m_allocMap` appropriately _before_ calling `internalSet()`.
@@ -367,10 +396,10 @@ class GAFFER_API Context : public IECore::RefCounted
 
 		using Map = boost::container::flat_map<IECore::InternedString, Value>;
 
+		Slots m_slots;
 		Map m_map;
 		ChangedSignal *m_changedSignal;
-		mutable IECore::MurmurHash m_hash;
-		mutable bool m_hashValid;
+		IECore::MurmurHash m_hash;
 		const IECore::Canceller *m_canceller;
 
 		// The alloc map holds a smart pointer to data that we allocate.  It must keep the entries
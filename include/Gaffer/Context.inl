@@ -119,7 +119,7 @@ Context::Value::Value( const IECore::InternedString &name, const T *value )
 	{
 		m_hash.append( *value );
 		m_hash.append( m_typeId );
-		m_hash.append( (uint64_t)&nameStr );
+		m_hash.append( nameHash( name ) );
 	}
 }
 
@@ -179,29 +179,109 @@ void Context::set( const IECore::InternedString &name, const T &value )
 	internalSet( name, Value( name, &d->readable() ) );
 }
 
+inline const IECore::InternedString *Context::slotNames()
+{
+	static const IECore::InternedString g_slotNames[g_numSlots] = {
+		"frame", "framesPerSecond", "scene:path",
+		"image:tileOrigin", "image:channelName", "image:viewName"
+	};
+	return g_slotNames;
+}
+
+inline int Context::slotIndex( const IECore::InternedString &name )
+{
+	// InternedStrings compare by pointer, so this is a handful of integer
+	// comparisons rather than the binary search required by `m_map`.
+	const IECore::InternedString *names = slotNames();
+	for( int i = 0; i < g_numSlots; ++i )
+	{
+		if( name == names[i] )
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+inline IECore::MurmurHash Context::nameHash( const IECore::InternedString &name )
+{
+	static const std::array<IECore::MurmurHash, g_numSlots> g_slotNameHashes = [] {
+		std::array<IECore::MurmurHash, g_numSlots> result;
+		const IECore::InternedString *names = slotNames();
+		for( int i = 0; i < g_numSlots; ++i )
+		{
+			result[i].append( names[i].string() );
+		}
+		return result;
+	}();
+
+	const int slot = slotIndex( name );
+	if( slot >= 0 )
+	{
+		return g_slotNameHashes[slot];
+	}
+
+	IECore::MurmurHash result;
+	result.append( name.string() );
+	return result;
+}
+
+inline Context::Value &Context::internalStorage( const IECore::InternedString &name )
+{
+	const int slot = slotIndex( name );
+	return slot >= 0 ? m_slots[slot] : m_map[name];
+}
+
+inline void Context::updateHash( const Value &oldValue, const Value &newValue )
+{
+	// An unset Value has a default-constructed (zero) hash, so
+	// contributes nothing.
+	m_hash = IECore::MurmurHash(
+		m_hash.h1() - oldValue.hash().h1() + newValue.hash().h1(),
+		m_hash.h2() - oldValue.hash().h2() + newValue.hash().h2()
+	);
+}
+
+template<typename F>
+void Context::forEachVariable( F &&f ) const
+{
+	const IECore::InternedString *names = slotNames();
+	for( int i = 0; i < g_numSlots; ++i )
+	{
+		if( m_slots[i].typeId() != IECore::InvalidTypeId )
+		{
+			f( names[i], m_slots[i] );
+		}
+	}
+	for( const auto &[name, value] : m_map )
+	{
+		f( name, value );
+	}
+}
+
 inline void Context::internalSet( const IECore::InternedString &name, const Value &value )
 {
+	Value &v = internalStorage( name );
 	if( !m_changedSignal )
 	{
 		// Fast path, typically in an EditableScope, where we
 		// expect the value to have changed and don't want the
 		// expense of checking.
-		m_map[name] = value;
-		m_hashValid = false;
+		updateHash( v, value );
+		v = value;
 	}
 	else
 	{
 		// Always assign to the value, because the caller might have updated
 		// `m_allocMap` already (removing the previous value).
-		Value &v = m_map[name];
 		const bool changed = v != value;
+		updateHash( v, value );
 		v = value;
 		if( changed )
 		{
 			// But avoid emitting `changedSignal` if the value hasn't
 			// actually changed. We want to avoid expensive re-evaluations
 			// that might otherwise be triggered in the UI.
-			m_hashValid = false;
 			(*m_changedSignal)( this, name );
 		}
 	}
@@ -224,6 +304,13 @@ inline const Context::Value &Context::internalGet( const IECore::InternedString
 
 inline const Context::Value *Context::internalGetIfExists( const IECore::InternedString &name ) const
 {
+	const int slot = slotIndex( name );
+	if( slot >= 0 )
+	{
+		const Value &v = m_slots[slot];
+		return v.typeId() != IECore::InvalidTypeId ? &v : nullptr;
+	}
+
 	Map::const_iterator it = m_map.find( name );
 	return it != m_map.end() ? &it->second : nullptr;
 }
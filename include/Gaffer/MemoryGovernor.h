@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Gaffer
+{
+
+/// Adjusts the limits of caches in response to memory pressure, shrinking
+/// them as memory becomes scarce and growing them back again as it becomes
+/// available. This allows generous cache limits to be used by default,
+/// without processes being killed when running in memory-limited
+/// environments such as render farm containers.
+///
+/// The ValuePlug compute, compressed and hash caches are registered
+/// automatically, and other modules may register their own caches using
+/// `registerCache()`.
+namespace MemoryGovernor
+{
+
+struct MemoryStatistics
+{
+	/// Memory in use, in bytes.
+	size_t used = 0;
+	/// Memory available in total, in bytes. Zero if unknown.
+	size_t limit = 0;
+};
+
+/// Returns the memory statistics for the current process. If the process
+/// is running in a cgroup (v2) with a memory limit, then the statistics
+/// for the cgroup are returned, with reclaimable file-backed memory excluded
+/// from `used`. Otherwise statistics for the whole system are returned
+/// based on `/proc/meminfo`.
+GAFFER_API MemoryStatistics memoryStatistics();
+
+/// Cache registration
+/// ==================
+///
+/// Caches are registered using functions to get and set their limits. Limits
+/// may be in any units (bytes, entries, open files), and are scaled
+/// proportionally by the governor.
+
+using LimitGetter = std::function<size_t ()>;
+using LimitSetter = std::function<void ( size_t )>;
+
+GAFFER_API void registerCache( const std::string &name, const LimitGetter &getter, const LimitSetter &setter );
+GAFFER_API void deregisterCache( const std::string &name );
+GAFFER_API std::vector<std::string> registeredCaches();
+
+/// Sets the limit used for a cache when there is no memory pressure. If not
+/// set, the limit the cache had when the governor was enabled is used.
+GAFFER_API void setMaximumLimit( const std::string &name, size_t limit );
+/// As above, but specifying the maximum as a fraction of the memory limit
+/// returned by `memoryStatistics()`. Only meaningful for caches whose limits
+/// are specified in bytes. A fraction of 0 removes the fractional maximum.
+GAFFER_API void setMaximumLimitFraction( const std::string &name, float fraction );
+/// Returns the current maximum for a cache, or the cache's own limit if the
+/// governor is not enabled.
+GAFFER_API size_t getMaximumLimit( const std::string &name );
+
+/// Settings
+/// ========
+
+/// Pressure is measured as `used / limit`. Caches are kept at their maximum
+/// while pressure is below `low`, and are shrunk proportionally as pressure
+/// rises towards `high`, at which point they are at `minimumScale` times
+/// their maximum.
+GAFFER_API void setPressureThresholds( float low, float high );
+GAFFER_API void getPressureThresholds( float &low, float &high );
+GAFFER_API void setMinimumScale( float minimumScale );
+GAFFER_API float getMinimumScale();
+
+/// Shrinking is applied immediately, but growth is limited to this amount
+/// per update, to avoid oscillation when caches are refilled.
+GAFFER_API void setGrowthRate( float scalePerUpdate );
+GAFFER_API float getGrowthRate();
+
+/// Enabling the governor starts a background thread which calls `update()`
+/// at the specified interval. Disabling it stops the thread and restores
+/// all caches to their maximum limits.
+///
+/// > Caution : Because registered setters may refer to static caches in
+/// > other libraries, the governor should be disabled before the process
+/// > exits. The default startup configuration does this via Python's
+/// > `atexit` module.
+GAFFER_API void setEnabled( bool enabled );
+GAFFER_API bool getEnabled();
+GAFFER_API void setUpdateInterval( std::chrono::milliseconds interval );
+GAFFER_API std::chrono::milliseconds getUpdateInterval();
+
+/// Updating
+/// ========
+
+/// Samples `memoryStatistics()` and applies the resulting scale to all
+/// registered caches. Returns the scale. Has no effect unless enabled.
+GAFFER_API float update();
+/// As above, but using the specified statistics. Primarily for testing.
+GAFFER_API float update( const MemoryStatistics &statistics );
+/// Returns the scale most recently applied to the caches.
+GAFFER_API float getScale();
+
+} // namespace MemoryGovernor
+
+} // namespace Gaffer
@@ -39,12 +39,14 @@
 #include "Gaffer/Export.h"
 #include "Gaffer/ThreadState.h"
 
+#include "IECore/InternedString.h"
 #include "IECore/RefCounted.h"
 
 namespace Gaffer
 {
 
 class Process;
+class Plug;
 
 /// Base class for monitoring node graph processes.
 class GAFFER_API Monitor : public IECore::RefCounted
@@ -95,6 +97,24 @@ class GAFFER_API Monitor : public IECore::RefCounted
 		/// Implementations must be safe to call concurrently.
 		virtual void processFinished( const Process *process ) = 0;
 
+		/// Called when `process` is made available for collaboration by other
+		/// threads via `Process::acquireCollaborativeResult()`. `cycleFallback`
+		/// is true if an equivalent process was already in flight, but couldn't
+		/// be waited on without causing a cyclic dependency. Implementations
+		/// must be safe to call concurrently.
+		virtual void collaborationStarted( const Process *process, bool cycleFallback );
+		/// Called when the current thread starts waiting for the result of
+		/// a collaborative process running on another thread. While waiting,
+		/// the thread may run tasks on behalf of that process, in which case
+		/// `processStarted()` and `processFinished()` will be called before
+		/// `collaborationWaitFinished()`. Implementations must be safe to call
+		/// concurrently.
+		virtual void collaborationWaitStarted();
+		/// Called when the wait is over. `processType` and `plug` identify
+		/// the process that was waited on, and are empty if the process
+		/// failed to start. Implementations must be safe to call concurrently.
+		virtual void collaborationWaitFinished( const IECore::InternedString &processType, const Plug *plug );
+
 		/// Must return true if forceMonitoring will ever return true from this Monitor
 		/// \todo : In order to efficently support a monitor that only forces monitoring during
 		/// compute processes, we would need to make this specific to processType - this will
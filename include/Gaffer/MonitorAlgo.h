@@ -61,9 +61,15 @@ enum PerformanceMetric
 	HashCount,
 	ComputeCount,
 	HashesPerCompute,
+	CollaborationCount,
+	CycleFallbackCount,
+	WaitCount,
+	WaitDuration,
+	WaitsPerCollaboration,
+	StolenCount,
 
 	First = TotalDuration,
-	Last = HashesPerCompute
+	Last = StolenCount
 };
 
 GAFFER_API std::string formatStatistics( const PerformanceMonitor &monitor, size_t maxLinesPerMetric = 50 );
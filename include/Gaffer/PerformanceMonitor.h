@@ -71,7 +71,12 @@ class GAFFER_API PerformanceMonitor : public Monitor
 				size_t hashCount = 0,
 				size_t computeCount = 0,
 				boost::chrono::nanoseconds hashDuration = boost::chrono::nanoseconds( 0 ),
-				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 )
+				boost::chrono::nanoseconds computeDuration = boost::chrono::nanoseconds( 0 ),
+				size_t collaborationCount = 0,
+				size_t cycleFallbackCount = 0,
+				size_t waitCount = 0,
+				boost::chrono::nanoseconds waitDuration = boost::chrono::nanoseconds( 0 ),
+				size_t stolenCount = 0
 			);
 
 			size_t hashCount;
@@ -79,6 +84,26 @@ class GAFFER_API PerformanceMonitor : public Monitor
 			boost::chrono::nanoseconds hashDuration;
 			boost::chrono::nanoseconds computeDuration;
 
+			// Task collaboration statistics. These are only recorded for
+			// processes run via `Process::acquireCollaborativeResult()`, and can
+			// be used to choose between the `TaskCollaboration` and
+			// `TaskIsolation` cache policies.
+
+			/// Number of processes made available for collaboration.
+			size_t collaborationCount;
+			/// Number of collaborative processes that were run redundantly,
+			/// because waiting for an equivalent in-flight process would have
+			/// caused deadlock.
+			size_t cycleFallbackCount;
+			/// Number of times that a thread waited for a collaborative process
+			/// running on another thread.
+			size_t waitCount;
+			/// Time spent by waiting threads while they had no work to steal.
+			boost::chrono::nanoseconds waitDuration;
+			/// Number of hash and compute processes run by waiting threads
+			/// on behalf of the process they were waiting for.
+			size_t stolenCount;
+
 			Statistics & operator += ( const Statistics &rhs );
 
 			bool operator == ( const Statistics &rhs );
@@ -97,6 +122,9 @@ class GAFFER_API PerformanceMonitor : public Monitor
 
 		void processStarted( const Process *process ) override;
 		void processFinished( const Process *process ) override;
+		void collaborationStarted( const Process *process, bool cycleFallback ) override;
+		void collaborationWaitStarted() override;
+		void collaborationWaitFinished( const IECore::InternedString &processType, const Plug *plug ) override;
 
 	private :
 
@@ -113,6 +141,14 @@ class GAFFER_API PerformanceMonitor : public Monitor
 			DurationStack durationStack;
 			// The last time measurement we made.
 			boost::chrono::high_resolution_clock::time_point then;
+			// Stack of collaborations being waited on. The top of the
+			// stack is billed for any processes we start while waiting.
+			struct Wait
+			{
+				boost::chrono::nanoseconds duration = boost::chrono::nanoseconds( 0 );
+				size_t stolenCount = 0;
+			};
+			std::stack<Wait> waitStack;
 		};
 
 		tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
@@ -0,0 +1,174 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include "IECore/MurmurHash.h"
+#include "IECore/Object.h"
+
+#include "boost/noncopyable.hpp"
+
+#include "tbb/concurrent_queue.h"
+#include "tbb/task_arena.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// An in-memory store of losslessly compressed `FloatVectorData`, used by
+/// ValuePlug to provide a second-level cache for results evicted from the
+/// compute cache. Data is byte-shuffled and delta encoded, so that the
+/// sign and exponent bytes of similar values become runs, and then run
+/// length encoded. Constant data is stored as a single value. Entries are
+/// evicted in least recently used order when the total memory usage
+/// exceeds `getMaxMemory()`. Compression is performed asynchronously,
+/// so that evicting from the compute cache is not delayed by it.
+///
+/// All methods are threadsafe.
+class GAFFER_API CompressedCache : boost::noncopyable
+{
+
+	public :
+
+		explicit CompressedCache( size_t maxMemory );
+		~CompressedCache();
+
+		/// Sets the maximum memory usage in bytes, evicting entries if
+		/// necessary. A limit of 0 disables the cache.
+		void setMaxMemory( size_t bytes );
+		size_t getMaxMemory() const;
+
+		bool enabled() const;
+
+		/// Returns the memory used by all entries in their compressed form.
+		size_t currentMemory() const;
+		/// Returns the memory that all entries would use if they were
+		/// not compressed.
+		size_t uncompressedMemory() const;
+		size_t entries() const;
+
+		/// Returns a decompressed copy of the data stored for `key`, or null
+		/// if there is none.
+		IECore::ConstObjectPtr get( const IECore::MurmurHash &key );
+		/// Queues `object` to be compressed and stored for `key` on a TBB
+		/// worker thread, unless an entry exists already. Returns false if
+		/// `object` is not `FloatVectorData`, the cache is disabled or being
+		/// cleared, or the data awaiting compression would exceed
+		/// `getMaxMemory()`.
+		bool set( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &object );
+		/// Waits for all data queued by `set()` to be stored.
+		void wait();
+
+		/// Removes all entries from the cache, and discards any data
+		/// still awaiting compression.
+		void clear();
+
+		/// Disables `set()` for the lifetime of the scope, and clears the
+		/// cache on exit. Used while clearing the compute cache, so that the
+		/// entries it removes are discarded rather than compressed.
+		class ClearScope : boost::noncopyable
+		{
+
+			public :
+
+				ClearScope( CompressedCache &cache );
+				~ClearScope();
+
+			private :
+
+				CompressedCache &m_cache;
+
+		};
+
+		/// Counts of the lookups made by `get()`.
+		size_t hits() const;
+		size_t misses() const;
+		void clearStatistics();
+
+	private :
+
+		struct Block;
+		using ConstBlockPtr = std::shared_ptr<const Block>;
+		using Cache = IECorePreview::LRUCache<IECore::MurmurHash, ConstBlockPtr, IECorePreview::LRUCachePolicy::Parallel>;
+
+		struct Pending
+		{
+			IECore::MurmurHash key;
+			IECore::ConstObjectPtr object;
+			size_t generation;
+		};
+
+		void drain();
+		void store( const Pending &pending );
+		void removed( const IECore::MurmurHash &key, const ConstBlockPtr &block );
+
+		Cache m_cache;
+
+		// Data awaiting compression, and the number of bytes it holds.
+		// `m_pendingCount` also includes any data being compressed, and
+		// the task running `drain()`.
+		tbb::concurrent_queue<Pending> m_pending;
+		std::atomic_size_t m_pendingCount;
+		std::atomic_size_t m_pendingMemory;
+		std::atomic_bool m_draining;
+		tbb::task_arena m_arena;
+
+		// Incremented by `clear()` to discard pending data queued
+		// before it. Guarded by `m_clearMutex` so that no data can
+		// be stored concurrently with a clear.
+		std::mutex m_clearMutex;
+		std::atomic_size_t m_generation;
+		std::atomic_int m_clearScopes;
+
+		std::atomic_size_t m_entries;
+		std::atomic_size_t m_uncompressedMemory;
+		std::atomic_size_t m_hits;
+		std::atomic_size_t m_misses;
+
+};
+
+} // namespace Private
+
+} // namespace Gaffer
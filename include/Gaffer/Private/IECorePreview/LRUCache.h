@@ -40,6 +40,8 @@
 #include "boost/noncopyable.hpp"
 #include "boost/variant.hpp"
 
+#include <chrono>
+#include <cstdint>
 #include <optional>
 
 namespace IECorePreview
@@ -86,7 +88,8 @@ class TaskParallel;
 ///
 /// The Policy determines the thread safety, eviction and performance characteristics
 /// of the cache. See the documentation for each individual policy in the LRUCachePolicy
-/// namespace.
+/// namespace. The EvictionPolicy passed to the constructor further determines which
+/// items are discarded first when the maximum cost is exceeded.
 ///
 /// The GetterKey may be used where the GetterFunction requires some auxiliary information
 /// in addition to the Key. It must be implicitly castable to Key, and all GetterKeys
@@ -100,6 +103,23 @@ class LRUCache : private boost::noncopyable
 
 		using Cost = size_t;
 		using KeyType = Key;
+		using Duration = std::chrono::nanoseconds;
+
+		enum class EvictionPolicy
+		{
+			/// Discards the least recently used items first.
+			LRU,
+			/// Implements the Greedy-Dual-Size-Frequency algorithm. Each item
+			/// has priority `L + frequency * duration / cost`, where `duration`
+			/// is the time taken to compute it and `L` is an inflation value
+			/// which rises to the lowest priority in the cache as items are
+			/// discarded. Items with the lowest priority are discarded first,
+			/// so items which are cheap to recompute per unit cost are discarded
+			/// before expensive ones, but items which are no longer accessed age
+			/// out as `L` rises. To avoid the serial overhead of a priority queue,
+			/// the lowest priority item is chosen from a small sample of candidates.
+			CostAware
+		};
 
 		/// The GetterFunction is responsible for computing the value and cost for a cache entry
 		/// when given the key. It should throw a descriptive exception if it can't get the data for
@@ -109,9 +129,11 @@ class LRUCache : private boost::noncopyable
 		/// The optional RemovalCallback is called whenever an item is discarded from the cache.
 		using RemovalCallback = boost::function<void ( const Key &key, const Value &data )>;
 
-		LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback = RemovalCallback(), bool cacheErrors = true );
+		LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback = RemovalCallback(), bool cacheErrors = true, EvictionPolicy evictionPolicy = EvictionPolicy::LRU );
 		virtual ~LRUCache();
 
+		EvictionPolicy getEvictionPolicy() const;
+
 		/// Retrieves an item from the cache, computing it if necessary.
 		/// The item is returned by value, as it may be removed from the
 		/// cache at any time by operations on another thread, or may not
@@ -129,21 +151,27 @@ class LRUCache : private boost::noncopyable
 		/// Returns true for success and false on failure - failure can occur
 		/// if the cost exceeds the maximum cost for the cache. Note that even
 		/// when true is returned, the item may be removed from the cache by a
-		/// subsequent (or concurrent) operation.
-		bool set( const Key &key, const Value &value, Cost cost );
+		/// subsequent (or concurrent) operation. The `duration` is the time
+		/// taken to compute the value, and is used by `EvictionPolicy::CostAware`.
+		bool set( const Key &key, const Value &value, Cost cost, Duration duration = Duration( 0 ) );
 		/// As above, but only if the item is not cached already. This avoids
 		/// calling a potentially expensive cost function in the case that the
 		/// item is cached already.
 		/// \todo Ideally we wouldn't need the cost calculation to be duplicated
 		/// between CostFunction and GetterFunction.
 		template<typename CostFunction>
-		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction );
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, Duration duration = Duration( 0 ) );
 
 		/// Returns true if the object is in the cache. Note that the
 		/// return value may be invalidated immediately by operations performed
 		/// by another thread.
 		bool cached( const Key &key ) const;
 
+		/// Returns the cost of the item if it is in the cache. As for
+		/// `cached()`, the return value may be invalidated immediately
+		/// by operations performed by another thread.
+		std::optional<Cost> cost( const Key &key ) const;
+
 		/// Erases the item if it was cached. Returns true if it was cached
 		/// and false if it wasn't cached and therefore wasn't removed.
 		bool erase( const Key &key );
@@ -183,6 +211,10 @@ class LRUCache : private boost::noncopyable
 			Failed // m_getter failed when computing entry
 		};
 
+		// Priority of an item for `EvictionPolicy::CostAware`, in
+		// nanoseconds per unit cost.
+		using Priority = double;
+
 		// The type used to store a single cached item.
 		struct CacheEntry
 		{
@@ -198,6 +230,7 @@ class LRUCache : private boost::noncopyable
 
 			State state;
 			Cost cost; // the cost for this item
+			Priority durationPerCost; // the compute time per unit cost for this item
 
 			Status status() const;
 
@@ -209,13 +242,14 @@ class LRUCache : private boost::noncopyable
 
 		Cost m_maxCost;
 		bool m_cacheErrors;
+		EvictionPolicy m_evictionPolicy;
 
 		// Methods
 		// =======
 
 		// Updates the cached value and updates the current
 		// total cost.
-		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost );
+		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, Duration duration );
 
 		// Removes any cached value and updates the current total
 		// cost.
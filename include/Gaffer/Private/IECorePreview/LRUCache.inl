@@ -49,8 +49,10 @@
 #include "tbb/spin_mutex.h"
 #include "tbb/spin_rw_mutex.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <limits>
 #include <tuple>
 #include <vector>
 
@@ -66,9 +68,19 @@ namespace IECorePreview
 // In practice, any data structure can be used provided the interface
 // described below is presented. The required interface is documented
 // on the Serial policy only for simplicity.
+//
+// All policies must also implement `EvictionPolicy::CostAware`. Each item
+// has a priority of `L + frequency * durationPerCost`, assigned by `push()`,
+// where `L` is an inflation value that `pop()` raises to the lowest priority
+// in the cache as items are popped. Rather than maintaining a priority queue,
+// `pop()` samples the items it would have popped under the LRU policy, and
+// pops the one with the lowest priority.
 namespace LRUCachePolicy
 {
 
+// Number of candidates considered by `pop()` for `EvictionPolicy::CostAware`.
+const int g_costAwareSampleSize = 8;
+
 enum AcquireMode
 {
 	FindReadable,
@@ -99,7 +111,7 @@ class Serial
 		struct Item
 		{
 			Item( const Key &key )
-				:	key( key ), handleCount( 0 )
+				:	key( key ), handleCount( 0 ), frequency( 0 ), priority( 0 )
 			{
 			}
 
@@ -111,6 +123,9 @@ class Serial
 			// get non-const access to it.
 			mutable CacheEntry cacheEntry;
 			mutable size_t handleCount;
+			// Used by `EvictionPolicy::CostAware`.
+			mutable uint32_t frequency;
+			mutable typename LRUCache::Priority priority;
 		};
 
 		using MapAndList = boost::multi_index_container<
@@ -129,8 +144,8 @@ class Serial
 		using MapIterator = typename MapAndList::iterator;
 		using List = typename MapAndList::template nth_index<1>::type;
 
-		Serial()
-			:	currentCost( 0 )
+		Serial( typename LRUCache::EvictionPolicy evictionPolicy )
+			:	currentCost( 0 ), m_evictionPolicy( evictionPolicy ), m_inflation( 0 )
 		{
 		}
 
@@ -243,6 +258,11 @@ class Serial
 		{
 			List &list = m_mapAndList.template get<1>();
 			list.relocate( list.end(), list.iterator_to( *(handle.m_it) ) );
+			if( m_evictionPolicy == LRUCache::EvictionPolicy::CostAware )
+			{
+				handle.m_it->frequency++;
+				handle.m_it->priority = m_inflation + handle.m_it->frequency * handle.m_it->cacheEntry.durationPerCost;
+			}
 		}
 
 		// Pops a copy of the least recently used CacheEntry from the policy,
@@ -258,10 +278,22 @@ class Serial
 			// GetterFunction has reentered the cache with a call
 			// to `get( someOtherKey )`, and this inner call has
 			// then entered `limitCost()`.
-			typename List::iterator it = list.begin();
-			while( it != list.end() && it->handleCount )
+			//
+			// For `EvictionPolicy::CostAware`, we consider several
+			// such items and choose the one with the lowest priority.
+			const int sampleSize = m_evictionPolicy == LRUCache::EvictionPolicy::CostAware ? g_costAwareSampleSize : 1;
+			typename List::iterator it = list.end();
+			int numSamples = 0;
+			for( typename List::iterator sampleIt = list.begin(); sampleIt != list.end() && numSamples < sampleSize; ++sampleIt )
 			{
-				++it;
+				if( sampleIt->handleCount )
+				{
+					continue;
+				}
+				if( !numSamples++ || sampleIt->priority < it->priority )
+				{
+					it = sampleIt;
+				}
 			}
 
 			if( it == list.end() )
@@ -270,6 +302,7 @@ class Serial
 			}
 
 			const Item &item = *it;
+			m_inflation = std::max( m_inflation, item.priority );
 
 			key = item.key;
 			cacheEntry = item.cacheEntry;
@@ -284,6 +317,8 @@ class Serial
 	private :
 
 		MapAndList m_mapAndList;
+		const typename LRUCache::EvictionPolicy m_evictionPolicy;
+		typename LRUCache::Priority m_inflation;
 
 };
 
@@ -302,9 +337,9 @@ class Parallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : recentlyUsed(), frequency(), priority() {}
+			Item( const Key &key ) : key( key ), recentlyUsed(), frequency(), priority() {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed(), frequency(), priority() {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
@@ -312,6 +347,9 @@ class Parallel
 			mutable Mutex mutex;
 			// Flag used in second-chance algorithm.
 			mutable std::atomic_bool recentlyUsed;
+			// Used by `EvictionPolicy::CostAware`.
+			mutable std::atomic<uint32_t> frequency;
+			mutable std::atomic<typename LRUCache::Priority> priority;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -355,7 +393,8 @@ class Parallel
 
 		using Bins = std::vector<Bin>;
 
-		Parallel()
+		Parallel( typename LRUCache::EvictionPolicy evictionPolicy )
+			:	m_evictionPolicy( evictionPolicy ), m_inflation( 0 ), m_sweepMinimum( std::numeric_limits<typename LRUCache::Priority>::infinity() )
 		{
 			m_bins.resize( std::thread::hardware_concurrency() );
 			m_popBinIndex = 0;
@@ -502,6 +541,19 @@ class Parallel
 
 		void push( Handle &handle )
 		{
+			if( m_evictionPolicy == LRUCache::EvictionPolicy::CostAware )
+			{
+				// Assign the priority that `pop()` will compare against
+				// other items. We don't need the handle to be writable to
+				// write here, because `frequency` and `priority` are atomic.
+				const uint32_t frequency = handle.m_item->frequency.fetch_add( 1, std::memory_order_relaxed ) + 1;
+				handle.m_item->priority.store(
+					m_inflation.load( std::memory_order_relaxed ) + frequency * handle.m_item->cacheEntry.durationPerCost,
+					std::memory_order_relaxed
+				);
+				return;
+			}
+
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
@@ -528,6 +580,50 @@ class Parallel
 			typename Bin::Mutex::scoped_lock binLock( bin->mutex );
 
 			typename Item::Mutex::scoped_lock itemLock;
+
+			// For `EvictionPolicy::CostAware`, we instead sample
+			// several items and pop the one with the lowest priority.
+			// Samples are recorded by key, because the bin they are
+			// in may have been unlocked by the time we pop.
+			int numSamples = 0;
+			Key sampleKey;
+			size_t sampleBinIndex = 0;
+			typename LRUCache::Priority samplePriority = 0;
+			auto popSample = [&] () {
+				if( sampleBinIndex != m_popBinIndex )
+				{
+					binLock.release();
+					binLock.acquire( m_bins[sampleBinIndex].mutex );
+				}
+				Map &sampleMap = m_bins[sampleBinIndex].map;
+				MapIterator it = sampleMap.find( sampleKey );
+				bool result = false;
+				if( it != sampleMap.end() && itemLock.try_acquire( it->mutex ) )
+				{
+					key = it->key;
+					cacheEntry = it->cacheEntry;
+					// See below for why it is safe to erase the item
+					// after releasing the lock.
+					itemLock.release();
+					if( sampleBinIndex == m_popBinIndex && it == m_popIterator )
+					{
+						m_popIterator = sampleMap.erase( it );
+					}
+					else
+					{
+						sampleMap.erase( it );
+					}
+					result = true;
+				}
+				if( sampleBinIndex != m_popBinIndex )
+				{
+					binLock.release();
+					binLock.acquire( bin->mutex );
+				}
+				numSamples = 0;
+				return result;
+			};
+
 			int numFullIterations = 0;
 			while( true )
 			{
@@ -544,10 +640,19 @@ class Parallel
 					if( m_popIterator == emptySentinel )
 					{
 						// We've come full circle and all bins were empty.
-						return false;
+						return numSamples && popSample();
 					}
 					else if( m_popBinIndex == 0 )
 					{
+						// We've completed a sweep. Our samples aren't
+						// representative of the whole cache, so rather than
+						// inflate to the priority of each item we pop, we
+						// inflate to the lowest priority seen in the sweep.
+						if( m_sweepMinimum != std::numeric_limits<typename LRUCache::Priority>::infinity() )
+						{
+							m_inflation.store( std::max( m_inflation.load( std::memory_order_relaxed ), m_sweepMinimum ), std::memory_order_relaxed );
+							m_sweepMinimum = std::numeric_limits<typename LRUCache::Priority>::infinity();
+						}
 						if( numFullIterations++ > 50 )
 						{
 							// We're not empty, but we've been around and around
@@ -556,14 +661,26 @@ class Parallel
 							// the `recentlyUsed` flag or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
-							return false;
+							return numSamples && popSample();
 						}
 					}
 				}
 
 				if( itemLock.try_acquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					if( m_evictionPolicy == LRUCache::EvictionPolicy::CostAware )
+					{
+						const typename LRUCache::Priority priority = m_popIterator->priority.load( std::memory_order_relaxed );
+						m_sweepMinimum = std::min( m_sweepMinimum, priority );
+						if( !numSamples++ || priority < samplePriority )
+						{
+							sampleKey = m_popIterator->key;
+							sampleBinIndex = m_popBinIndex;
+							samplePriority = priority;
+						}
+						itemLock.release();
+					}
+					else if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -596,6 +713,11 @@ class Parallel
 				}
 
 				++m_popIterator;
+
+				if( numSamples == g_costAwareSampleSize && popSample() )
+				{
+					return true;
+				}
 			}
 		}
 
@@ -618,6 +740,11 @@ class Parallel
 		size_t m_popBinIndex;
 		MapIterator m_popIterator;
 
+		const typename LRUCache::EvictionPolicy m_evictionPolicy;
+		// Only written by `pop()`, while holding `m_popMutex`.
+		std::atomic<typename LRUCache::Priority> m_inflation;
+		typename LRUCache::Priority m_sweepMinimum;
+
 };
 
 
@@ -648,9 +775,9 @@ class TaskParallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : recentlyUsed(), frequency(), priority() {}
+			Item( const Key &key ) : key( key ), recentlyUsed(), frequency(), priority() {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed(), frequency(), priority() {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
@@ -658,6 +785,9 @@ class TaskParallel
 			mutable Mutex mutex;
 			// Flag used in second-chance algorithm.
 			mutable std::atomic_bool recentlyUsed;
+			// Used by `EvictionPolicy::CostAware`.
+			mutable std::atomic<uint32_t> frequency;
+			mutable std::atomic<typename LRUCache::Priority> priority;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -701,7 +831,8 @@ class TaskParallel
 
 		using Bins = std::vector<Bin>;
 
-		TaskParallel()
+		TaskParallel( typename LRUCache::EvictionPolicy evictionPolicy )
+			:	m_evictionPolicy( evictionPolicy ), m_inflation( 0 ), m_sweepMinimum( std::numeric_limits<typename LRUCache::Priority>::infinity() )
 		{
 			m_bins.resize( std::thread::hardware_concurrency() );
 			m_popBinIndex = 0;
@@ -887,6 +1018,19 @@ class TaskParallel
 
 		void push( Handle &handle )
 		{
+			if( m_evictionPolicy == LRUCache::EvictionPolicy::CostAware )
+			{
+				// Assign the priority that `pop()` will compare against
+				// other items. We don't need the handle to be writable to
+				// write here, because `frequency` and `priority` are atomic.
+				const uint32_t frequency = handle.m_item->frequency.fetch_add( 1, std::memory_order_relaxed ) + 1;
+				handle.m_item->priority.store(
+					m_inflation.load( std::memory_order_relaxed ) + frequency * handle.m_item->cacheEntry.durationPerCost,
+					std::memory_order_relaxed
+				);
+				return;
+			}
+
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
@@ -913,6 +1057,50 @@ class TaskParallel
 			typename Bin::Mutex::scoped_lock binLock( bin->mutex );
 
 			typename Item::Mutex::ScopedLock itemLock;
+
+			// For `EvictionPolicy::CostAware`, we instead sample
+			// several items and pop the one with the lowest priority.
+			// Samples are recorded by key, because the bin they are
+			// in may have been unlocked by the time we pop.
+			int numSamples = 0;
+			Key sampleKey;
+			size_t sampleBinIndex = 0;
+			typename LRUCache::Priority samplePriority = 0;
+			auto popSample = [&] () {
+				if( sampleBinIndex != m_popBinIndex )
+				{
+					binLock.release();
+					binLock.acquire( m_bins[sampleBinIndex].mutex );
+				}
+				Map &sampleMap = m_bins[sampleBinIndex].map;
+				MapIterator it = sampleMap.find( sampleKey );
+				bool result = false;
+				if( it != sampleMap.end() && itemLock.tryAcquire( it->mutex ) )
+				{
+					key = it->key;
+					cacheEntry = it->cacheEntry;
+					// See below for why it is safe to erase the item
+					// after releasing the lock.
+					itemLock.release();
+					if( sampleBinIndex == m_popBinIndex && it == m_popIterator )
+					{
+						m_popIterator = sampleMap.erase( it );
+					}
+					else
+					{
+						sampleMap.erase( it );
+					}
+					result = true;
+				}
+				if( sampleBinIndex != m_popBinIndex )
+				{
+					binLock.release();
+					binLock.acquire( bin->mutex );
+				}
+				numSamples = 0;
+				return result;
+			};
+
 			int numFullIterations = 0;
 			while( true )
 			{
@@ -929,10 +1117,19 @@ class TaskParallel
 					if( m_popIterator == emptySentinel )
 					{
 						// We've come full circle and all bins were empty.
-						return false;
+						return numSamples && popSample();
 					}
 					else if( m_popBinIndex == 0 )
 					{
+						// We've completed a sweep. Our samples aren't
+						// representative of the whole cache, so rather than
+						// inflate to the priority of each item we pop, we
+						// inflate to the lowest priority seen in the sweep.
+						if( m_sweepMinimum != std::numeric_limits<typename LRUCache::Priority>::infinity() )
+						{
+							m_inflation.store( std::max( m_inflation.load( std::memory_order_relaxed ), m_sweepMinimum ), std::memory_order_relaxed );
+							m_sweepMinimum = std::numeric_limits<typename LRUCache::Priority>::infinity();
+						}
 						if( numFullIterations++ > 50 )
 						{
 							// We're not empty, but we've been around and around
@@ -941,14 +1138,26 @@ class TaskParallel
 							// the `recentlyUsed` flag or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
-							return false;
+							return numSamples && popSample();
 						}
 					}
 				}
 
 				if( itemLock.tryAcquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					if( m_evictionPolicy == LRUCache::EvictionPolicy::CostAware )
+					{
+						const typename LRUCache::Priority priority = m_popIterator->priority.load( std::memory_order_relaxed );
+						m_sweepMinimum = std::min( m_sweepMinimum, priority );
+						if( !numSamples++ || priority < samplePriority )
+						{
+							sampleKey = m_popIterator->key;
+							sampleBinIndex = m_popBinIndex;
+							samplePriority = priority;
+						}
+						itemLock.release();
+					}
+					else if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -981,6 +1190,11 @@ class TaskParallel
 				}
 
 				++m_popIterator;
+
+				if( numSamples == g_costAwareSampleSize && popSample() )
+				{
+					return true;
+				}
 			}
 		}
 
@@ -1003,6 +1217,11 @@ class TaskParallel
 		size_t m_popBinIndex;
 		MapIterator m_popIterator;
 
+		const typename LRUCache::EvictionPolicy m_evictionPolicy;
+		// Only written by `pop()`, while holding `m_popMutex`.
+		std::atomic<typename LRUCache::Priority> m_inflation;
+		typename LRUCache::Priority m_sweepMinimum;
+
 };
 
 } // namespace LRUCachePolicy
@@ -1012,7 +1231,7 @@ class TaskParallel
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::CacheEntry::CacheEntry()
-	:	cost( 0 )
+	:	cost( 0 ), durationPerCost( 0 )
 {
 }
 
@@ -1026,8 +1245,8 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Status LRUCache<Key, Value, Po
 // =======================================================================
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors )
-	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors )
+LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors, EvictionPolicy evictionPolicy )
+	:	m_getter( getter ), m_removalCallback( removalCallback ), m_policy( evictionPolicy ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors ), m_evictionPolicy( evictionPolicy )
 {
 }
 
@@ -1036,6 +1255,12 @@ LRUCache<Key, Value, Policy, GetterKey>::~LRUCache()
 {
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+typename LRUCache<Key, Value, Policy, GetterKey>::EvictionPolicy LRUCache<Key, Value, Policy, GetterKey>::getEvictionPolicy() const
+{
+	return m_evictionPolicy;
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 void LRUCache<Key, Value, Policy, GetterKey>::clear()
 {
@@ -1087,9 +1312,23 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( handle.isWritable() );
 		Value value = Value();
 		Cost cost = 0;
+		Duration duration( 0 );
 		try
 		{
-			handle.execute( [this, &value, &key, &cost, canceller] { value = m_getter( key, cost, canceller ); } );
+			handle.execute(
+				[this, &value, &key, &cost, &duration, canceller] {
+					if( m_evictionPolicy == EvictionPolicy::CostAware )
+					{
+						const auto start = std::chrono::steady_clock::now();
+						value = m_getter( key, cost, canceller );
+						duration = std::chrono::duration_cast<Duration>( std::chrono::steady_clock::now() - start );
+					}
+					else
+					{
+						value = m_getter( key, cost, canceller );
+					}
+				}
+			);
 		}
 		catch( IECore::Cancelled const & )
 		{
@@ -1107,7 +1346,7 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( cacheEntry.status() != Cached ); // this would indicate that another thread somehow
 		assert( cacheEntry.status() != Failed ); // loaded the same thing as us, which is not the intention.
 
-		setInternal( key, handle.writable(), value, cost );
+		setInternal( key, handle.writable(), value, cost, duration );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1154,12 +1393,12 @@ std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost, Duration duration )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::InsertWritable, /* canceller = */ nullptr );
 	assert( handle.isWritable() );
-	bool result = setInternal( key, handle.writable(), value, cost );
+	bool result = setInternal( key, handle.writable(), value, cost, duration );
 	m_policy.push( handle );
 	handle.release();
 	limitCost( m_maxCost );
@@ -1168,7 +1407,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 template<typename CostFunction>
-bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction )
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, Duration duration )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::Insert, /* canceller = */ nullptr );
@@ -1179,7 +1418,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 	if( status == Uncached )
 	{
 		assert( handle.isWritable() );
-		result = setInternal( key, handle.writable(), value, costFunction( value ) );
+		result = setInternal( key, handle.writable(), value, costFunction( value ), duration );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1189,7 +1428,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, Duration duration )
 {
 	eraseInternal( key, cacheEntry );
 
@@ -1200,6 +1439,10 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
+	cacheEntry.durationPerCost = m_evictionPolicy == EvictionPolicy::CostAware ?
+		static_cast<double>( duration.count() ) / static_cast<double>( std::max<Cost>( cost, 1 ) ) :
+		0.0
+	;
 
 	m_policy.currentCost += cost;
 
@@ -1220,6 +1463,23 @@ bool LRUCache<Key, Value, Policy, GetterKey>::cached( const Key &key ) const
 	return handle.readable().status() == Cached;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+std::optional<typename LRUCache<Key, Value, Policy, GetterKey>::Cost> LRUCache<Key, Value, Policy, GetterKey>::cost( const Key &key ) const
+{
+	typename Policy<LRUCache>::Handle handle;
+	if( !const_cast<Policy<LRUCache> &>( m_policy ).acquire( key, handle, LRUCachePolicy::FindReadable, /* canceller = */ nullptr ) )
+	{
+		return std::nullopt;
+	}
+
+	const CacheEntry &cacheEntry = handle.readable();
+	if( cacheEntry.status() != Cached )
+	{
+		return std::nullopt;
+	}
+	return cacheEntry.cost;
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 bool LRUCache<Key, Value, Policy, GetterKey>::erase( const Key &key )
 {
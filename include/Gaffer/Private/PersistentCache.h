@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include "IECore/MurmurHash.h"
+#include "IECore/Object.h"
+
+#include "boost/functional/hash.hpp"
+#include "boost/noncopyable.hpp"
+
+#include "tbb/concurrent_queue.h"
+#include "tbb/task_arena.h"
+
+#include <atomic>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace Gaffer
+{
+
+namespace Private
+{
+
+/// A content-addressed store of IECore::Objects on disk, used by ValuePlug to
+/// provide a second-level cache that persists between processes. Entries are
+/// keyed by hash, serialised using `Object::save()`, and evicted in least
+/// recently used order when the total size exceeds `getMaxSize()`. Access
+/// times are recorded in the file modification times, so that the eviction
+/// order is preserved when the store is reopened by another process.
+/// Objects are written asynchronously, so that computes are not delayed
+/// by disk I/O.
+///
+/// All methods are threadsafe. Multiple processes may share the same
+/// directory, and entries written by one are found by lookups in the
+/// others. Each process performs its own size accounting, so the total
+/// size may temporarily exceed the limit.
+class GAFFER_API PersistentCache : boost::noncopyable
+{
+
+	public :
+
+		explicit PersistentCache( size_t maxSize );
+		~PersistentCache();
+
+		/// Sets the directory used to store the cache. An empty string
+		/// disables the cache. The directory is created if necessary, and any
+		/// entries already present are made available for lookup.
+		void setDirectory( const std::filesystem::path &directory );
+		std::filesystem::path getDirectory() const;
+
+		/// Returns true if a directory has been specified.
+		bool enabled() const;
+
+		/// Sets the maximum size of the cache in bytes, evicting entries
+		/// if necessary.
+		void setMaxSize( size_t bytes );
+		size_t getMaxSize() const;
+
+		/// Returns the total size of all entries in the cache in bytes.
+		size_t currentSize() const;
+
+		/// Returns the object stored for `key`, or null if there is none.
+		/// Entries written by other processes are found even if they were
+		/// written after the directory was set.
+		IECore::ConstObjectPtr get( const IECore::MurmurHash &key );
+		/// Queues `object` to be written for `key` on a TBB worker thread,
+		/// unless an entry exists already. Returns false if the cache is
+		/// disabled, or the objects awaiting writing would use too much memory.
+		bool set( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &object );
+		/// Waits for all objects queued by `set()` to be written.
+		void wait();
+
+		/// Removes all entries from the cache.
+		void clear();
+
+	private :
+
+		using KeyList = std::list<IECore::MurmurHash>;
+
+		struct Entry
+		{
+			size_t size;
+			// Position in `m_keys`, which is ordered from
+			// least to most recently used.
+			KeyList::iterator position;
+		};
+
+		using EntryMap = std::unordered_map<IECore::MurmurHash, Entry, boost::hash<IECore::MurmurHash>>;
+
+		struct Pending
+		{
+			IECore::MurmurHash key;
+			IECore::ConstObjectPtr object;
+			size_t memory;
+		};
+
+		void drain();
+		void write( const Pending &pending );
+
+		std::filesystem::path path( const IECore::MurmurHash &key ) const;
+		// These must be called with `m_mutex` held.
+		void addEntry( const IECore::MurmurHash &key, size_t size );
+		void removeEntry( EntryMap::iterator it, bool removeFile );
+		void limitSize();
+
+		mutable std::mutex m_mutex;
+		std::filesystem::path m_directory;
+		size_t m_maxSize;
+		size_t m_currentSize;
+		EntryMap m_entries;
+		KeyList m_keys;
+
+		// Objects awaiting writing, and the memory they use. `m_pendingCount`
+		// also includes any object being written, and the task running `drain()`.
+		tbb::concurrent_queue<Pending> m_pending;
+		std::atomic_size_t m_pendingCount;
+		std::atomic_size_t m_pendingMemory;
+		std::atomic_bool m_draining;
+		tbb::task_arena m_arena;
+
+};
+
+} // namespace Private
+
+} // namespace Gaffer
@@ -112,7 +112,8 @@ class GAFFER_API Process : private ThreadState::Scope
 		/// - `ProcessType::run()` does the work for the process and returns the
 		///   result.
 		/// - `ProcessType::g_cache` is a static LRUCache of type `ProcessType::CacheType`
-		///   to be used for the caching of the result.
+		///   to be used for the caching of the result. The time taken by `run()` is
+		///   passed to the cache, for use by `EvictionPolicy::CostAware`.
 		/// - `ProcessType::cacheCostFunction()` is a static function suitable
 		///   for use with `CacheType::setIfUncached()`.
 		///
@@ -34,11 +34,14 @@
 //
 //////////////////////////////////////////////////////////////////////////
 
+#include "Gaffer/Monitor.h"
+
 #include "tbb/concurrent_hash_map.h"
 #include "tbb/spin_mutex.h"
 #include "tbb/task_arena.h"
 #include "tbb/task_group.h"
 
+#include <chrono>
 #include <unordered_set>
 #include <variant>
 
@@ -257,6 +260,13 @@ class GAFFER_API Process::Collaboration : public IECore::RefCounted
 		// Protects access to `dependents` on _all_ Collaborations.
 		static tbb::spin_mutex g_dependentsMutex;
 
+		// The plug and type of the process being run by the collaboration,
+		// for the benefit of Monitors. These are set by the collaborating
+		// thread before running the process, and may be read by waiting
+		// threads once `taskGroup.wait()` has returned.
+		const Plug *plug = nullptr;
+		IECore::InternedString processType;
+
 };
 
 /// Collaboration subclass specific to a single type of process, providing storage for the result
@@ -320,6 +330,8 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	typename CollaborationType::PendingCollaborations::accessor accessor;
 	CollaborationType::g_pendingCollaborations.insert( accessor, cacheKey );
 
+	// Set if we reject a collaboration because it would cause a cycle.
+	bool cycleFallback = false;
 	for( const auto &candidate : accessor->second )
 	{
 		// Check to see if we can safely collaborate on `candidate` without
@@ -348,6 +360,7 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 			}
 			else
 			{
+				cycleFallback = true;
 				continue;
 			}
 		}
@@ -369,10 +382,20 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 		CollaborationTypePtr collaboration = candidate;
 		accessor.release();
 
+		for( const auto &m : *threadState.m_monitors )
+		{
+			m->collaborationWaitStarted();
+		}
+
 		collaboration->arena.execute(
 			[&]{ return collaboration->taskGroup.wait(); }
 		);
 
+		for( const auto &m : *threadState.m_monitors )
+		{
+			m->collaborationWaitFinished( collaboration->processType, collaboration->plug );
+		}
+
 		return collaboration->resultOrException();
 	}
 
@@ -406,13 +429,23 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 					{
 						ProcessType process( std::forward<ProcessArguments>( args )... );
 						process.m_collaboration = collaboration.get();
+						collaboration->plug = process.plug();
+						collaboration->processType = process.type();
+						for( const auto &m : *threadState.m_monitors )
+						{
+							m->collaborationStarted( &process, cycleFallback );
+						}
+						const auto start = std::chrono::steady_clock::now();
 						collaboration->result = process.run();
 						// Publish result to cache before we remove ourself from
 						// `g_pendingCollaborations`, so that other threads will
-						// be able to get the result one way or the other.
+						// be able to get the result one way or the other. The
+						// duration of the process allows caches to prioritise
+						// results that are expensive to recompute.
 						ProcessType::g_cache.setIfUncached(
 							cacheKey, std::get<typename ProcessType::ResultType>( collaboration->result ),
-							ProcessType::cacheCostFunction
+							ProcessType::cacheCostFunction,
+							std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start )
 						);
 					}
 					catch( ... )
@@ -0,0 +1,162 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "IECore/InternedString.h"
+#include "IECore/MurmurHash.h"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which records a timeline of the processes run on each thread,
+/// suitable for viewing in `chrome://tracing` or https://ui.perfetto.dev.
+/// Collaborative processes are marked when they start, and the time threads
+/// spend waiting on collaborations is recorded alongside the processes.
+/// Events are recorded into a fixed-size ring buffer per thread, so that
+/// recording is cheap and free from contention. When a buffer is full, the
+/// oldest events on that thread are discarded.
+class GAFFER_API TraceMonitor : public Monitor
+{
+
+	public :
+
+		/// Only processes whose type is in `processMask` are recorded. An
+		/// empty mask records all processes. A maximum of `eventsPerThread`
+		/// events are retained for each thread.
+		TraceMonitor( const std::vector<IECore::InternedString> &processMask = {}, size_t eventsPerThread = 100000 );
+		~TraceMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( TraceMonitor )
+
+		using Clock = std::chrono::steady_clock;
+
+		struct Event
+		{
+			enum class Type
+			{
+				/// A process, from `processStarted()` to `processFinished()`.
+				Process,
+				/// The start of a collaborative process. `begin` and `end` are equal.
+				Collaboration,
+				/// As above, for a process which was started because it couldn't
+				/// wait on an equivalent collaboration without causing a cycle.
+				CycleFallback,
+				/// A wait on a collaborative process running on another thread.
+				/// Processes run on behalf of the collaboration are nested inside.
+				/// The context hash is not known, and is left default-constructed.
+				CollaborationWait
+			};
+
+			Type type;
+			/// Identifies the plug, but doesn't keep it alive, so may
+			/// dangle if the plug has since been destroyed. The plug's
+			/// name is resolved the first time it is recorded on each
+			/// thread, so it can still be reported after destruction.
+			const Plug *plug;
+			IECore::InternedString processType;
+			IECore::MurmurHash contextHash;
+			Clock::time_point begin;
+			Clock::time_point end;
+		};
+
+		/// Query functions. These are not thread-safe, and must be called
+		/// only when the Monitor is not active (as defined by `Monitor::Scope`).
+		/// Returns the total number of events currently held.
+		size_t numEvents() const;
+		/// Writes all events in the Chrome Trace Event JSON format. Each event
+		/// is named after the plug, categorised by process type, and carries
+		/// the context hash as an argument. Collaboration waits are instead
+		/// categorised as "collaborationWait", and carry the process type as
+		/// an argument. Collaborations are written as instant events.
+		void writeChromeTrace( const std::filesystem::path &fileName ) const;
+		/// Discards all recorded events.
+		void clear();
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+		void collaborationStarted( const Process *process, bool cycleFallback ) override;
+		void collaborationWaitStarted() override;
+		void collaborationWaitFinished( const IECore::InternedString &processType, const Plug *plug ) override;
+
+	private :
+
+		bool recording( const IECore::InternedString &processType ) const;
+
+		const std::vector<IECore::InternedString> m_processMask;
+		const size_t m_eventsPerThread;
+		const Clock::time_point m_startTime;
+
+		// Each ThreadData is only ever written by its own thread, so no
+		// synchronisation is needed while recording.
+		struct ThreadData
+		{
+			ThreadData();
+			int id;
+			// Begin times for the processes and collaboration waits currently
+			// running on this thread, innermost last.
+			std::vector<Clock::time_point> stack;
+			// Ring buffer of completed events. Grows up to `m_eventsPerThread`
+			// and then wraps, with `next` indexing the oldest event.
+			std::vector<Event> events;
+			size_t next;
+			// Names for the plugs referenced by `events`. Resolving each name
+			// once avoids the cost of building a string for every event.
+			std::unordered_map<const Plug *, std::string> plugNames;
+		};
+		mutable tbb::enumerable_thread_specific<ThreadData> m_threadData;
+
+		void record( ThreadData &threadData, const Event &event ) const;
+
+};
+
+IE_CORE_DECLAREPTR( TraceMonitor )
+
+} // namespace Gaffer
@@ -41,6 +41,8 @@
 
 #include "IECore/Object.h"
 
+#include <map>
+
 namespace Gaffer
 {
 
@@ -141,7 +143,15 @@ class GAFFER_API ValuePlug : public Plug
 			Default,
 			/// Deprecated synonym for Default. Will be removed in a future
 			/// release.
-			Legacy = Default
+			Legacy = Default,
+			/// As for TaskCollaboration, but results are additionally stored
+			/// in the persistent on-disk cache, so that they may be reused by
+			/// subsequent processes. Only suitable for computes whose hash is
+			/// stable between processes, and whose results are expensive
+			/// enough to justify the cost of serialisation. Has no effect
+			/// beyond TaskCollaboration unless `setPersistentCacheDirectory()`
+			/// has been called.
+			Persistent
 		};
 
 		/// @name Cache management
@@ -156,10 +166,121 @@ class GAFFER_API ValuePlug : public Plug
 		static void setCacheMemoryLimit( size_t bytes );
 		/// Returns the current memory usage of the cache in bytes.
 		static size_t cacheMemoryUsage();
-		/// Clears the cache.
+		/// Clears the cache, including the compressed cache.
 		static void clearCache();
 		//@}
 
+		/// @name Cache statistics
+		/// Optional per-node accounting of the compute cache, to help with
+		/// sizing the cache limits. Accounting adds overhead to every cache
+		/// access, so is disabled by default.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		struct CacheStatistics
+		{
+			/// The type of the node.
+			std::string nodeType;
+			/// The number of entries currently in the cache.
+			size_t entries = 0;
+			/// The memory used by those entries, in bytes.
+			size_t memoryUsage = 0;
+			size_t hits = 0;
+			size_t misses = 0;
+			/// The number of entries removed from the cache, either
+			/// to meet the memory limit or by `clearCache()`.
+			size_t evictions = 0;
+		};
+		/// Maps from the full name of each node to its statistics. Nodes are
+		/// not kept alive, so may have been deleted since they used the cache.
+		using CacheStatisticsMap = std::map<std::string, CacheStatistics>;
+
+		static void setCacheStatisticsEnabled( bool enabled );
+		static bool getCacheStatisticsEnabled();
+		/// Returns statistics for each node that has used the cache since
+		/// statistics were enabled or last cleared.
+		/// > Note : Nodes are identified by the name they had when they first
+		/// > used the cache. Renaming a node starts a new set of statistics.
+		static CacheStatisticsMap cacheStatistics();
+		/// Resets hit, miss and eviction counts. Occupancy continues to be
+		/// tracked for entries which remain in the cache.
+		static void clearCacheStatistics();
+		//@}
+
+		/// @name Compressed cache management
+		/// `FloatVectorData` results evicted from the compute cache may be
+		/// stored in a second-level cache in memory, losslessly compressed
+		/// by a background task. On a miss in the compute cache for a
+		/// FloatVectorDataPlug, the compressed cache is consulted before
+		/// computing. This is of most benefit to image processing, where
+		/// channel data is stored as `FloatVectorData`, and constant tiles
+		/// compress to a single value. The memory limit defaults to 0,
+		/// disabling the compressed cache, but the `startup/Gaffer/cache.py`
+		/// config run by all Gaffer applications enables it with a limit of
+		/// up to 1GB.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Sets the maximum amount of memory the compressed cache may use
+		/// in bytes. A limit of 0 disables the compressed cache.
+		static void setCompressedCacheMemoryLimit( size_t bytes );
+		static size_t getCompressedCacheMemoryLimit();
+		/// Returns the current memory usage of the compressed cache in bytes,
+		/// after waiting for any pending compression to complete.
+		static size_t compressedCacheMemoryUsage();
+
+		struct CompressedCacheStatistics
+		{
+			/// The number of entries currently in the cache.
+			size_t entries = 0;
+			/// The memory used by those entries, in bytes.
+			size_t memoryUsage = 0;
+			/// The memory those entries would use uncompressed, in bytes.
+			size_t uncompressedMemoryUsage = 0;
+			size_t hits = 0;
+			size_t misses = 0;
+		};
+
+		/// Waits for any pending compression to complete, and then
+		/// returns statistics for the compressed cache.
+		static CompressedCacheStatistics compressedCacheStatistics();
+		/// Resets hit and miss counts.
+		static void clearCompressedCacheStatistics();
+		//@}
+
+		/// @name Persistent cache management
+		/// Results from computes using `CachePolicy::Persistent` may also be
+		/// stored in a second-level cache on disk, keyed by hash. On a miss in
+		/// the memory cache, the disk cache is consulted before computing.
+		/// Results are written to disk in the background. The disk cache is
+		/// disabled by default, and may be shared between processes running
+		/// concurrently, including entries written after a process started.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Sets the directory used to store the persistent cache. An empty
+		/// string disables the persistent cache.
+		static void setPersistentCacheDirectory( const std::string &directory );
+		static std::string getPersistentCacheDirectory();
+		/// Sets the maximum size in bytes that the persistent cache may occupy on
+		/// disk. Least recently used entries are deleted to meet the limit.
+		static void setPersistentCacheSizeLimit( size_t bytes );
+		static size_t getPersistentCacheSizeLimit();
+		/// Results with a memory usage below this threshold are not stored in
+		/// the persistent cache.
+		static void setPersistentCacheCostThreshold( size_t bytes );
+		static size_t getPersistentCacheCostThreshold();
+		/// Returns the current size of the persistent cache in bytes, after
+		/// waiting for any pending writes to complete.
+		static size_t persistentCacheUsage();
+		/// Removes all entries from the persistent cache.
+		static void clearPersistentCache();
+		/// Adds a component to the keys used for all entries in the persistent
+		/// cache. This should be called by libraries whose computes depend on
+		/// process-wide settings, so that processes using different settings
+		/// don't share entries. It is typically called during library
+		/// initialisation, since entries stored before the call are not
+		/// used by subsequent computes.
+		static void addPersistentCacheKeyComponent( const IECore::MurmurHash &component );
+		//@}
+
 		/// @name Hash cache management
 		/// In addition to the cache of recently computed values, we also
 		/// keep a per-thread cache of recently computed hashes. These functions
@@ -168,10 +289,14 @@ class GAFFER_API ValuePlug : public Plug
 		//@{
 		static size_t getHashCacheSizeLimit();
 		/// > Note : Limits are applied on a per-thread basis as and
-		/// > when each thread is used to compute a hash.
+		/// > when each thread is used to compute a hash, except in
+		/// > `HashCacheMode::Global`, where the limit applies to the
+		/// > single shared cache.
 		static void setHashCacheSizeLimit( size_t maxEntriesPerThread );
 		/// Returns the total number of entries in both global and per-thread hash caches
 		static size_t hashCacheTotalUsage();
+		/// Returns an estimate of the memory used by all hash caches, in bytes.
+		static size_t hashCacheMemoryUsage();
 		/// Clears the hash cache.
 		/// > Note : By default, clearing occurs on a per-thread basis as
 		/// > and when each thread next accesses its cache. Pass `now = true`
@@ -184,12 +309,16 @@ class GAFFER_API ValuePlug : public Plug
 		/// plugs.  If you have incorrect affects() methods, you can use
 		/// "Legacy", which pessimisticly dirties all hash cache entries
 		/// when something changes, or "Checked" which helps identify
-		/// bad affects() methods by throwing exceptions.
+		/// bad affects() methods by throwing exceptions. "Global" is
+		/// equivalent to "Standard", but replaces the per-thread caches with
+		/// a single lock-free cache shared by all threads. This uses less
+		/// memory and avoids redundant hashing when many threads are used.
 		enum class HashCacheMode
 		{
 			Standard,
 			Checked,
-			Legacy
+			Legacy,
+			Global
 		};
 		static void setHashCacheMode( HashCacheMode hashCacheMode );
 		static HashCacheMode getHashCacheMode();
@@ -54,6 +54,16 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 
 		GAFFER_NODE_DECLARE_TYPE( GafferImage::Blur, BlurTypeId, FlatImageProcessor );
 
+		enum Method
+		{
+			/// Filters using the internal Resample node. Cost
+			/// increases linearly with the radius.
+			Filter,
+			/// Approximates the gaussian using a recursive filter,
+			/// with a cost per pixel that is independent of the radius.
+			Recursive
+		};
+
 		Gaffer::V2fPlug *radiusPlug();
 		const Gaffer::V2fPlug *radiusPlug() const;
 
@@ -63,6 +73,9 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Gaffer::BoolPlug *expandDataWindowPlug();
 		const Gaffer::BoolPlug *expandDataWindowPlug() const;
 
+		Gaffer::IntPlug *methodPlug();
+		const Gaffer::IntPlug *methodPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -79,12 +92,30 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Gaffer::FloatVectorDataPlug *resampledChannelDataPlug();
 		const Gaffer::FloatVectorDataPlug *resampledChannelDataPlug() const;
 
+		// Output plug for the horizontal pass of the Recursive method. Computed
+		// for entire rows of tiles at once, with the tile origin's x coordinate
+		// set to 0. The passes are computed per channel rather than using the
+		// channel groups provided by ImageProcessor : channels share nothing
+		// but the filter coefficients, and grouping would multiply the size of
+		// each row or column while serialising work that can currently run in
+		// parallel.
+		Gaffer::FloatVectorDataPlug *horizontalPassPlug();
+		const Gaffer::FloatVectorDataPlug *horizontalPassPlug() const;
+
+		// Output plug for the vertical pass of the Recursive method. Computed
+		// for entire columns of tiles at once, with the tile origin's y coordinate
+		// set to 0.
+		Gaffer::FloatVectorDataPlug *verticalPassPlug();
+		const Gaffer::FloatVectorDataPlug *verticalPassPlug() const;
+
 		// Internal resample node.
 		Resample *resample();
 		const Resample *resample() const;
 
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
 
 		void hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		Imath::Box2i computeDataWindow( const Gaffer::Context *context, const ImagePlug *parent ) const override;
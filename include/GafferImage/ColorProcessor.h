@@ -68,6 +68,13 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		/// Returns true, since colour transforms operate on each pixel independently.
+		bool mipLevelsSupported( const Gaffer::Context *context ) const override;
+
+		const Gaffer::ObjectPlug *channelGroupPlug() const override;
+		std::vector<std::string> channelGroup( const std::string &channel, const Gaffer::Context *context ) const override;
+		void hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
+		IECore::ConstObjectVectorPtr computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const override;
 
 		/// Function object used to implement the processing of color values.
 		using ColorProcessorFunction = std::function<void ( IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b )>;
@@ -88,11 +95,9 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		Gaffer::ObjectPlug *colorProcessorPlug();
 		const Gaffer::ObjectPlug *colorProcessorPlug() const;
 
-		// Used to store the result of processColorData(), so that it can be reused in computeChannelData().
-		// Evaluated in a context with an "image:colorProcessor:__layerName" variable, so we can cache
-		// different results per layer.
-		Gaffer::ObjectPlug *colorDataPlug();
-		const Gaffer::ObjectPlug *colorDataPlug() const;
+		// Returns the ColorProcessor directly upstream of us, if it
+		// can be fused into our own computation of the channel group.
+		const ColorProcessor *fusableInput() const;
 
 		static size_t g_firstPlugIndex;
 
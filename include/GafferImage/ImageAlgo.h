@@ -139,6 +139,19 @@ enum TileOrder
 	TopToBottom
 };
 
+enum GatherMode
+{
+	// The GatherFunctor is called by the worker threads which
+	// compute the tiles, and at most one tile per thread is
+	// in flight at any time.
+	InlineGather,
+	// The GatherFunctor is called on a dedicated thread, which
+	// drains completed tiles in order while the worker threads
+	// run ahead. This allows slow gathers, such as writing to
+	// disk, to overlap with the computation of subsequent tiles.
+	PipelinedGather
+};
+
 // Call the functor in parallel, once per tile
 template <class TileFunctor>
 void parallelProcessTiles(
@@ -159,18 +172,27 @@ void parallelProcessTiles(
 );
 
 // Process all tiles in parallel using TileFunctor, passing the
-// results in series to GatherFunctor.
+// results in series to GatherFunctor. For `InlineGather`, the number
+// of tiles computed but not yet gathered is bounded by `maxTilesInFlight`,
+// which defaults to the number of threads. For `PipelinedGather`, one
+// tile per thread is always computed concurrently, and `maxTilesInFlight`
+// bounds the number of computed tiles queued for the gather thread. It
+// defaults to three times the number of threads, and values less than 1
+// are treated as 1.
 template <class TileFunctor, class GatherFunctor>
 void parallelGatherTiles(
 	const ImagePlug *image,
 	const TileFunctor &tileFunctor, // Signature : T tileFunctor( const ImagePlug *imagePlug, const V2i &tileOrigin )
 	GatherFunctor &&gatherFunctor, // Signature : void gatherFunctor( const ImagePlug *imagePlug, const V2i &tileOrigin, T &tileFunctorResult )
 	const Imath::Box2i &window = Imath::Box2i(), // Uses dataWindow if not specified ( requires a valid view in the context )
-	TileOrder tileOrder = Unordered
+	TileOrder tileOrder = Unordered,
+	GatherMode gatherMode = InlineGather,
+	size_t maxTilesInFlight = 0 // Uses the default for `gatherMode` if not specified
 );
 
 // Process all tiles in parallel using TileFunctor, passing the
-// results in series to GatherFunctor.
+// results in series to GatherFunctor. Note that `maxTilesInFlight`
+// counts whole tiles, each holding the results for all channels.
 template <class TileFunctor, class GatherFunctor>
 void parallelGatherTiles(
 	const ImagePlug *image,
@@ -178,7 +200,9 @@ void parallelGatherTiles(
 	const TileFunctor &tileFunctor, // Signature : T tileFunctor( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
 	GatherFunctor &&gatherFunctor, // Signature : void gatherFunctor( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, T &tileFunctorResult )
 	const Imath::Box2i &window = Imath::Box2i(), // Uses dataWindow if not specified ( requires a valid view in the context )
-	TileOrder tileOrder = Unordered
+	TileOrder tileOrder = Unordered,
+	GatherMode gatherMode = InlineGather,
+	size_t maxTilesInFlight = 0 // Uses the default for `gatherMode` if not specified
 );
 
 /// Whole view operations
@@ -211,6 +235,15 @@ GAFFERIMAGE_API IECore::ConstCompoundObjectPtr tiles( const ImagePlug *imagePlug
 /// If the provided sample offsets do not match, raise an exception that indicates where the mismatch occured.
 GAFFERIMAGE_API void throwIfSampleOffsetsMismatch( const IECore::IntVectorData* sampleOffsetsA, const IECore::IntVectorData* sampleOffsetsB, const Imath::V2i &tileOrigin, const std::string &message );
 
+/// Mip level Utils
+/// ==============================
+
+/// Returns the equivalent of `window` at the specified mip level, as
+/// requested by `ImagePlug::mipLevelContextName`. Pixel `p` at level `n`
+/// covers the full resolution pixels from `p * 2^n` to `( p + 1 ) * 2^n - 1`
+/// inclusive, and the result is the smallest window covering all the
+/// pixels of `window`.
+GAFFERIMAGE_API Imath::Box2i mipLevelWindow( const Imath::Box2i &window, int level );
 
 /// Multi-View Utils
 /// ==============================
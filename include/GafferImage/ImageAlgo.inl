@@ -43,9 +43,15 @@
 
 #include "boost/tuple/tuple.hpp"
 
+#include "tbb/concurrent_queue.h"
 #include "tbb/pipeline.h"
 #include "tbb/task_scheduler_init.h"
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 namespace GafferImage
 {
 
@@ -332,7 +338,7 @@ void parallelProcessTiles( const ImagePlug *imagePlug, const std::vector<std::st
 }
 
 template <class TileFunctor, class GatherFunctor>
-void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder, GatherMode gatherMode, size_t maxTilesInFlight )
 {
 	Imath::Box2i processWindow = window;
 	if( processWindow == Imath::Box2i() )
@@ -351,53 +357,155 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFun
 	Detail::TileInputIterator tileIterator( processWindow, tileOrder );
 	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
 
+	const size_t numThreads = tbb::task_scheduler_init::default_num_threads();
+	if( !maxTilesInFlight )
+	{
+		maxTilesInFlight = gatherMode == PipelinedGather ? numThreads * 3 : numThreads;
+	}
+
+	auto tileFilter = tbb::make_filter<void, Imath::V2i>(
+		tbb::filter::serial,
+		Detail::TileInputFilter<Detail::TileInputIterator>( tileIterator )
+	) &
+
+	tbb::make_filter<Imath::V2i, TileFilterResult>(
+
+		tbb::filter::parallel,
+
+		[ imagePlug, &tileFunctor, &threadState ] ( const Imath::V2i &tileOrigin ) {
+
+			ImagePlug::ChannelDataScope channelDataScope( threadState );
+			channelDataScope.setTileOrigin( &tileOrigin );
+
+			return TileFilterResult(
+				tileOrigin, tileFunctor( imagePlug, tileOrigin )
+			);
+		}
+
+	);
+
+	const tbb::filter::mode gatherFilterMode = tileOrder == Unordered ? tbb::filter::serial_out_of_order : tbb::filter::serial_in_order;
+
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
-	parallel_pipeline( tbb::task_scheduler_init::default_num_threads(),
 
-		tbb::make_filter<void, Imath::V2i>(
-			tbb::filter::serial,
-			Detail::TileInputFilter<Detail::TileInputIterator>( tileIterator )
-		) &
+	if( gatherMode == InlineGather )
+	{
+		parallel_pipeline( maxTilesInFlight,
 
-		tbb::make_filter<Imath::V2i, TileFilterResult>(
+			tileFilter &
 
-			tbb::filter::parallel,
+			tbb::make_filter<TileFilterResult, void>(
 
-			[ imagePlug, &tileFunctor, &threadState ] ( const Imath::V2i &tileOrigin ) {
+				gatherFilterMode,
 
-				ImagePlug::ChannelDataScope channelDataScope( threadState );
-				channelDataScope.setTileOrigin( &tileOrigin );
+				[ imagePlug, &gatherFunctor, &threadState ] ( const TileFilterResult &input ) {
 
-				return TileFilterResult(
-					tileOrigin, tileFunctor( imagePlug, tileOrigin )
-				);
-			}
+					ImagePlug::ChannelDataScope channelDataScope( threadState );
+					channelDataScope.setTileOrigin( &input.first );
 
-		) &
+					gatherFunctor( imagePlug, input.first, input.second );
 
-		tbb::make_filter<TileFilterResult, void>(
+				}
 
-			tileOrder == Unordered ? tbb::filter::serial_out_of_order : tbb::filter::serial_in_order,
+			),
 
-			[ imagePlug, &gatherFunctor, &threadState ] ( const TileFilterResult &input ) {
+			// Prevents outer tasks silently cancelling our tasks
+			taskGroupContext
 
-				ImagePlug::ChannelDataScope channelDataScope( threadState );
-				channelDataScope.setTileOrigin( &input.first );
+		);
+		return;
+	}
 
-				gatherFunctor( imagePlug, input.first, input.second );
+	// Pipelined gather. The final stage of the pipeline hands results
+	// to a dedicated gather thread via a bounded queue, so the workers
+	// never wait on the GatherFunctor unless the queue is full. A null
+	// result signals the end of the tiles.
 
-			}
+	// We always use one pipeline token per thread, so that tiles are
+	// computed with the same concurrency as for `InlineGather`, however
+	// many channels each tile holds. Memory use is bounded by limiting
+	// the number of results waiting in the queue to `maxTilesInFlight`.
 
-		),
+	const size_t numTokens = numThreads;
 
-		// Prevents outer tasks silently cancelling our tasks
-		taskGroupContext
+	using TileFilterResultPtr = std::shared_ptr<TileFilterResult>;
+	tbb::concurrent_bounded_queue<TileFilterResultPtr> queue;
+	queue.set_capacity( std::max<size_t>( maxTilesInFlight, 1 ) );
 
+	std::exception_ptr gatherException;
+	std::thread gatherThread(
+		[ imagePlug, &gatherFunctor, &threadState, &queue, &gatherException, &taskGroupContext ] {
+
+			ImagePlug::ChannelDataScope channelDataScope( threadState );
+
+			TileFilterResultPtr result;
+			while( true )
+			{
+				queue.pop( result );
+				if( !result )
+				{
+					break;
+				}
+				else if( gatherException )
+				{
+					// Keep draining the queue so that the pipeline can't
+					// block while it shuts down.
+					continue;
+				}
+
+				try
+				{
+					channelDataScope.setTileOrigin( &result->first );
+					gatherFunctor( imagePlug, result->first, result->second );
+				}
+				catch( ... )
+				{
+					gatherException = std::current_exception();
+					taskGroupContext.cancel_group_execution();
+				}
+			}
+		}
 	);
+
+	try
+	{
+		parallel_pipeline( numTokens,
+
+			tileFilter &
+
+			tbb::make_filter<TileFilterResult, void>(
+
+				gatherFilterMode,
+
+				[ &queue ] ( const TileFilterResult &input ) {
+					queue.push( std::make_shared<TileFilterResult>( input ) );
+				}
+
+			),
+
+			// Prevents outer tasks silently cancelling our tasks
+			taskGroupContext
+
+		);
+	}
+	catch( ... )
+	{
+		queue.push( nullptr );
+		gatherThread.join();
+		throw;
+	}
+
+	queue.push( nullptr );
+	gatherThread.join();
+
+	if( gatherException )
+	{
+		std::rethrow_exception( gatherException );
+	}
 }
 
 template <class TileFunctor, class GatherFunctor>
-void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder, GatherMode gatherMode, size_t maxTilesInFlight )
 {
 	using TileFunctorResult = std::invoke_result_t<TileFunctor, const ImagePlug *, const std::string &, const Imath::V2i &>;
 	using WholeTileResult = std::vector<TileFunctorResult>;
@@ -430,7 +538,7 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::str
 		}
 	};
 
-	parallelGatherTiles( imagePlug, f, g, window, tileOrder );
+	parallelGatherTiles( imagePlug, f, g, window, tileOrder, gatherMode, maxTilesInFlight );
 }
 
 } // namespace ImageAlgo
@@ -90,6 +90,27 @@ class GAFFERIMAGE_API ImageNode : public Gaffer::ComputeNode
 		/// \deprecated remove this once all derived classes stop using it.
 		virtual bool enabled() const;
 
+		/// Reduced resolution mip levels are requested by setting `ImagePlug::mipLevelContextName`
+		/// in the context. Derived classes which can compute them directly should return true from
+		/// this method, in which case they are responsible for scaling the format and data window with
+		/// `ImageAlgo::mipLevelWindow()` and for making their hashes reflect the level. Nodes which
+		/// pass through the format and data window and process each pixel independently of its
+		/// neighbours need do nothing more than return true, because their inputs take care of the rest.
+		/// In this case the result is only an approximation of the filtered full resolution output,
+		/// because the processing is applied after filtering rather than before, but it is cheaper
+		/// to compute by a factor of `4^n`.
+		///
+		/// The default implementation returns false, in which case ImageNode computes the mip levels
+		/// automatically, by box filtering the full resolution output of the node. This is exact,
+		/// but does nothing to reduce the cost of computing the full resolution image.
+		/// Each level is computed from the one above it and cached under the node's usual policy
+		/// for `outPlug()->channelDataPlug()`, so nodes with uncached channel data gain little.
+		virtual bool mipLevelsSupported( const Gaffer::Context *context ) const;
+		/// Returns true if `context` requests a mip level which is being computed automatically
+		/// on behalf of this node. Derived classes which reimplement `hash()` or `compute()` to
+		/// bypass the base class for parts of `outPlug()` must check this first.
+		bool mipLevelFallback( const Gaffer::Context *context ) const;
+
 		/// Implemented to call the hash*() methods below whenever output is part of an ImagePlug.
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		/// Hash methods for the individual children of outPlug(). A derived class must either :
@@ -132,6 +153,13 @@ class GAFFERIMAGE_API ImageNode : public Gaffer::ComputeNode
 
 	private :
 
+		// Used when `mipLevelsSupported()` is false. Channel data for each mip
+		// level is computed from the level above it.
+		void hashMipLevel( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const;
+		void computeMipLevel( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const;
+		void hashMipLevelChannelData( const Gaffer::Context *context, IECore::MurmurHash &h ) const;
+		IECore::ConstFloatVectorDataPtr computeMipLevelChannelData( const Gaffer::Context *context ) const;
+
 		static size_t g_firstPlugIndex;
 };
 
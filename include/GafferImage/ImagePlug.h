@@ -39,6 +39,7 @@
 
 #include "GafferImage/AtomicFormatPlug.h"
 #include "GafferImage/Export.h"
+#include "GafferImage/TileSize.h"
 #include "GafferImage/TypeIds.h"
 
 #include "Gaffer/Context.h"
@@ -144,6 +145,16 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::InternedString viewNameContextName;
 		static const IECore::InternedString channelNameContextName;
 		static const IECore::InternedString tileOriginContextName;
+		/// The name used to request a reduced resolution proxy of the
+		/// image, intended for interactive display. The variable is optional
+		/// and holds an int level `n`, in which each pixel approximates the
+		/// average of a `2^n x 2^n` block of full resolution pixels. The
+		/// format and data window are scaled down to match, as described by
+		/// `ImageAlgo::mipLevelWindow()`. Level 0 is the full resolution
+		/// image, and is used when the variable is absent. Only flat images
+		/// may be evaluated at levels other than 0. See
+		/// `ImageNode::mipLevelsSupported()` for details.
+		static const IECore::InternedString mipLevelContextName;
 
 		/// Utility class to scope a temporary copy of a context,
 		/// with tile/channel specific variables removed. This can be used
@@ -256,8 +267,27 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
 
+		/// Images are processed in square tiles of this size. The default
+		/// size is 128, and may be changed for the whole process by setting
+		/// the `GAFFERIMAGE_TILE_SIZE_LOG2` environment variable to a value
+		/// between 6 (64 pixels) and 9 (512 pixels) before GafferImage is
+		/// loaded. Larger tiles reduce the per-tile overhead of hashing,
+		/// caching and context management for large plates, while smaller
+		/// tiles reduce wasted work for small images and interactive updates.
+		/// Builds may instead fix the tile size using the
+		/// `GAFFERIMAGE_TILE_SIZE_LOG2` build option, in which case the
+		/// environment variable is ignored and the functions below are
+		/// `constexpr`.
+#if GAFFERIMAGE_TILE_SIZE_LOG2
 		static constexpr int tileSize() { return 1 << tileSizeLog2(); };
 		static constexpr int tilePixels() { return tileSize() * tileSize(); };
+#else
+		static int tileSize() { return 1 << tileSizeLog2(); };
+		static int tilePixels() { return tileSize() * tileSize(); };
+#endif
+		/// Returns true if the tile size may be chosen at runtime, and false
+		/// if it was fixed at build time.
+		static constexpr bool tileSizeIsConfigurable() { return GAFFERIMAGE_TILE_SIZE_LOG2 == 0; };
 
 		/// Returns the index of the tile containing a point
 		/// This just means dividing by tile size ( always rounding down )
@@ -286,10 +316,19 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		};
 		//@}
 
-		static constexpr int tileSizeLog2() { return 7; };
+#if GAFFERIMAGE_TILE_SIZE_LOG2
+		static_assert( GAFFERIMAGE_TILE_SIZE_LOG2 >= 6 && GAFFERIMAGE_TILE_SIZE_LOG2 <= 9, "GAFFERIMAGE_TILE_SIZE_LOG2 must be between 6 and 9" );
+		static constexpr int tileSizeLog2() { return GAFFERIMAGE_TILE_SIZE_LOG2; };
+#else
+		static int tileSizeLog2() { return g_tileSizeLog2; };
+#endif
 
 	private :
 
+#if !GAFFERIMAGE_TILE_SIZE_LOG2
+		static int g_tileSizeLog2;
+#endif
+
 		static void compoundObjectToCompoundData( const IECore::CompoundObject *object, IECore::CompoundData *data );
 
 		static size_t g_firstPlugIndex;
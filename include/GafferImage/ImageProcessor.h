@@ -39,6 +39,10 @@
 
 #include "GafferImage/ImageNode.h"
 
+#include "Gaffer/TypedObjectPlug.h"
+
+#include "IECore/ObjectVector.h"
+
 #include <limits>
 
 namespace Gaffer
@@ -85,6 +89,8 @@ class GAFFERIMAGE_API ImageProcessor : public ImageNode
 		Gaffer::Plug *correspondingInput( const Gaffer::Plug *output ) override;
 		const Gaffer::Plug *correspondingInput( const Gaffer::Plug *output ) const override;
 
+		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
+
 	protected :
 
 		/// Reimplemented to pass through the hashes of the inPlug() when the node is disabled.
@@ -92,6 +98,39 @@ class GAFFERIMAGE_API ImageProcessor : public ImageNode
 		/// Reimplemented from ImageNode to pass through the inPlug() computations when the node is disabled.
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 
+		/// Channel groups
+		/// ==============
+		///
+		/// By default each channel of a tile is computed independently, using
+		/// `computeChannelData()`. Nodes which process several channels together
+		/// (most commonly the RGB or RGBA channels of a layer) may instead compute
+		/// a whole group of channels in a single pass, sharing setup and input
+		/// fetches between them. The result for the group is cached on an internal
+		/// plug provided by the derived class via `channelGroupPlug()`, and
+		/// `outPlug()->channelDataPlug()` provides a view onto it for each channel.
+
+		/// Returns the channels that should be computed together with `channel`,
+		/// including `channel` itself, or an empty vector if it should be computed
+		/// individually by `computeChannelData()`. Called in the channelData context
+		/// for `outPlug()`, and must return the same group for every channel in the
+		/// group. The default implementation returns an empty vector.
+		virtual std::vector<std::string> channelGroup( const std::string &channel, const Gaffer::Context *context ) const;
+		/// Must be implemented by derived classes which return non-empty groups from
+		/// `channelGroup()`. Called with `image:channelName` removed from the context.
+		/// Implementations must call the base class implementation first.
+		virtual void hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const;
+		/// Must return a FloatVectorData for each of `channels`, in the same order.
+		/// Called with `image:channelName` removed from the context.
+		virtual IECore::ConstObjectVectorPtr computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const;
+
+		/// Returns the plug used to cache the results of `computeChannelGroup()`.
+		/// Derived classes which use channel groups must add an output ObjectPlug
+		/// for this purpose and return it here, and should add it to the outputs
+		/// from `affects()` for any inputs which affect the group computation.
+		/// The default implementation returns null, in which case channel groups
+		/// are not used at all.
+		virtual const Gaffer::ObjectPlug *channelGroupPlug() const;
+
 	private :
 
 		static size_t g_firstPlugIndex;
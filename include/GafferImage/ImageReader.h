@@ -147,6 +147,11 @@ class GAFFERIMAGE_API ImageReader : public ImageNode
 
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+		/// Returns true, because everything is passed through from the internal network,
+		/// which deals with mip levels itself. Note that this doesn't mean that levels are
+		/// read natively from the file : the internal OpenImageIOReader uses the generic
+		/// box filter fallback provided by ImageNode.
+		bool mipLevelsSupported( const Gaffer::Context *context ) const override;
 
 		void hashViewNames( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		IECore::ConstStringVectorDataPtr computeViewNames( const Gaffer::Context *context, const ImagePlug *parent ) const override;
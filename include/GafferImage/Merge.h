@@ -39,6 +39,7 @@
 #include "GafferImage/FlatImageProcessor.h"
 
 #include "Gaffer/NumericPlug.h"
+#include "Gaffer/TypedObjectPlug.h"
 
 namespace GafferImage
 {
@@ -53,8 +54,6 @@ namespace GafferImage
 /// - For some operations (add for instance) we could entirely skip invalid input tiles, and tiles
 ///   where channelData == ImagePlug::blackTile().
 /// - For some operations we do not need to track the intermediate alpha values at all.
-/// - We could improve our masking of invalid pixels with special cases for wholly valid tiles,
-///   wholly invalid tiles, and by chunking the work on the valid sections.
 class GAFFERIMAGE_API Merge : public FlatImageProcessor
 {
 
@@ -90,6 +89,11 @@ class GAFFERIMAGE_API Merge : public FlatImageProcessor
 
 	protected :
 
+		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
+		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		bool mipLevelsSupported( const Gaffer::Context *context ) const override;
+
 		/// Reimplemented to hash the connected input plugs
 		void hashDataWindow( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void hashChannelNames( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
@@ -104,6 +108,11 @@ class GAFFERIMAGE_API Merge : public FlatImageProcessor
 
 	private :
 
+		/// The data window and channel names of each valid input,
+		/// gathered once rather than being fetched for every tile.
+		Gaffer::CompoundObjectPlug *inputInfoPlug();
+		const Gaffer::CompoundObjectPlug *inputInfoPlug() const;
+
 		static size_t g_firstPlugIndex;
 
 };
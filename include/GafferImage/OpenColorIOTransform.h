@@ -39,6 +39,7 @@
 #include "GafferImage/ColorProcessor.h"
 
 #include "Gaffer/CompoundDataPlug.h"
+#include "Gaffer/NumericPlug.h"
 
 #include "OpenColorIO/OpenColorIO.h"
 
@@ -67,8 +68,25 @@ class GAFFERIMAGE_API OpenColorIOTransform : public ColorProcessor
 		Gaffer::CompoundDataPlug *contextPlug();
 		const Gaffer::CompoundDataPlug *contextPlug() const;
 
+		/// When on, the processor is baked into a shaper and 3D LUT,
+		/// which is applied in place of the exact processor provided
+		/// its error does not exceed `bakeTolerancePlug()`.
+		Gaffer::BoolPlug *bakePlug();
+		const Gaffer::BoolPlug *bakePlug() const;
+
+		Gaffer::FloatPlug *bakeTolerancePlug();
+		const Gaffer::FloatPlug *bakeTolerancePlug() const;
+
+		/// Output reporting the maximum error measured between the
+		/// baked LUT and the exact processor. Zero if `bakePlug()`
+		/// is off.
+		Gaffer::FloatPlug *bakeErrorPlug();
+		const Gaffer::FloatPlug *bakeErrorPlug() const;
+
 		GAFFER_NODE_DECLARE_TYPE( GafferImage::OpenColorIOTransform, OpenColorIOTransformTypeId, ColorProcessor );
 
+		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
+
 		/// Returns the OCIO processor for this node, taking into account
 		/// the current Gaffer context and the OCIO context specified by
 		/// `contextPlug()`. Returns nullptr if this node is a no-op.
@@ -81,6 +99,9 @@ class GAFFERIMAGE_API OpenColorIOTransform : public ColorProcessor
 
 		explicit OpenColorIOTransform( const std::string &name=defaultName<OpenColorIOTransform>(), bool withContextPlug=false );
 
+		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
+		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+
 		/// Derived classes must implement this to return true if the specified input
 		/// is used in transform().
 		virtual bool affectsTransform( const Gaffer::Plug *input ) const = 0;
@@ -66,9 +66,19 @@ class GAFFERIMAGE_API Premultiply : public ChannelDataProcessor
 
 	protected :
 
+		/// Reimplemented to pass through the alpha channel, which is never modified.
+		bool channelEnabled( const std::string &channel ) const override;
+
 		void hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channelIndex, IECore::FloatVectorDataPtr outData ) const override;
 
+		/// The R, G and B channels of each layer are premultiplied together,
+		/// sharing a single fetch of the alpha tile.
+		const Gaffer::ObjectPlug *channelGroupPlug() const override;
+		std::vector<std::string> channelGroup( const std::string &channel, const Gaffer::Context *context ) const override;
+		void hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
+		IECore::ConstObjectVectorPtr computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const override;
+
 	private :
 
 		static size_t g_firstPlugIndex;
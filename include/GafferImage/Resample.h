@@ -104,11 +104,21 @@ class GAFFERIMAGE_API Resample : public FlatImageProcessor
 		Imath::Box2i computeDataWindow( const Gaffer::Context *context, const ImagePlug *parent ) const override;
 		IECore::ConstFloatVectorDataPtr computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const override;
 
+		/// The R, G and B channels of each layer are resampled together,
+		/// sharing the filter weights computed for the tile.
+		const Gaffer::ObjectPlug *channelGroupPlug() const override;
+		std::vector<std::string> channelGroup( const std::string &channel, const Gaffer::Context *context ) const override;
+		void hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
+		IECore::ConstObjectVectorPtr computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const override;
+
 	private :
 
 		ImagePlug *horizontalPassPlug();
 		const ImagePlug *horizontalPassPlug() const;
 
+		void hashResampledChannels( const std::vector<std::string> &channelNames, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent, IECore::MurmurHash &h ) const;
+		std::vector<IECore::FloatVectorDataPtr> resampleChannels( const std::vector<std::string> &channelNames, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const;
+
 		static size_t g_firstPlugIndex;
 
 };
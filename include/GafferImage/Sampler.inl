@@ -82,7 +82,7 @@ inline float Sampler::sample( float x, float y )
 	int yi;
 	float yf = OIIO::floorfrac( y - 0.5, &yi );
 
-	constexpr int tileLowMask = ImagePlug::tileSize() - 1;
+	const int tileLowMask = ImagePlug::tileSize() - 1;
 	if(
 		( xi & tileLowMask ) != tileLowMask &&
 		( yi & tileLowMask ) != tileLowMask &&
@@ -303,7 +303,7 @@ inline void Sampler::cachedData( Imath::V2i p, const float *& tileData, int &til
 {
 	// Get the smart pointer to the tile we want.
 
-	constexpr int lowMask = ( 1 << ImagePlug::tileSizeLog2() ) - 1;
+	const int lowMask = ( 1 << ImagePlug::tileSizeLog2() ) - 1;
 	int cacheIndex = ( p.x >> ImagePlug::tileSizeLog2() ) + m_cacheWidth * ( p.y >> ImagePlug::tileSizeLog2() ) - m_cacheOriginIndex;
 
 	tilePixelIndex = ( p.x & lowMask ) + ( ( p.y & lowMask ) << ImagePlug::tileSizeLog2() );
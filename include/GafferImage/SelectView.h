@@ -61,6 +61,8 @@ class GAFFERIMAGE_API SelectView : public ImageProcessor
 
 	protected :
 
+		bool mipLevelsSupported( const Gaffer::Context *context ) const override;
+
 		void hashFormat( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void hashMetadata( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
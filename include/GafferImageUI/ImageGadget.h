@@ -133,6 +133,15 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		void setPaused( bool paused );
 		bool getPaused() const;
 
+		/// When on, tiles are computed at the coarsest mip level that
+		/// still provides at least one image pixel per screen pixel, as
+		/// described by `ImagePlug::mipLevelContextName`. A coarser level
+		/// is computed first and displayed as a placeholder until the
+		/// final tiles are available. Off by default, and has no effect
+		/// for deep images.
+		void setMipMapping( bool mipMapping );
+		bool getMipMapping() const;
+
 		static uint64_t tileUpdateCount();
 		static void resetTileUpdateCount();
 
@@ -199,6 +208,7 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 
 		bool m_labelsVisible;
 		bool m_paused;
+		bool m_mipMapping;
 		ImageGadgetSignal m_stateChangedSignal;
 
 		bool m_wipeEnabled;
@@ -221,18 +231,21 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 			DataWindowDirty = 2,
 			ChannelNamesDirty = 4,
 			TilesDirty = 8,
-			AllDirty = FormatDirty | DataWindowDirty | ChannelNamesDirty | TilesDirty
+			DeepDirty = 16,
+			AllDirty = FormatDirty | DataWindowDirty | ChannelNamesDirty | TilesDirty | DeepDirty
 		};
 
 		void dirty( unsigned flags );
 		const GafferImage::Format &format() const;
 		const Imath::Box2i &dataWindow() const;
 		const std::vector<std::string> &channelNames() const;
+		bool deep() const;
 
 		mutable unsigned m_dirtyFlags;
 		mutable GafferImage::Format m_format;
 		mutable Imath::Box2i m_dataWindow;
 		mutable std::vector<std::string> m_channelNames;
+		mutable bool m_deep;
 
 		// Tile storage.
 		//
@@ -244,14 +257,14 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 
 		struct TileIndex
 		{
-			TileIndex( const Imath::V2i &tileOrigin, IECore::InternedString channelName )
-				:	tileOrigin( tileOrigin ), channelName( channelName )
+			TileIndex( const Imath::V2i &tileOrigin, IECore::InternedString channelName, int mipLevel = 0 )
+				:	tileOrigin( tileOrigin ), channelName( channelName ), mipLevel( mipLevel )
 			{
 			}
 
 			bool operator == ( const TileIndex &rhs ) const
 			{
-				return tileOrigin == rhs.tileOrigin && channelName == rhs.channelName;
+				return tileOrigin == rhs.tileOrigin && channelName == rhs.channelName && mipLevel == rhs.mipLevel;
 			}
 
 			struct Hash
@@ -265,12 +278,15 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 					// and is sufficient because all equal InternedStrings are
 					// guaranteed to have the same pointers.
 					boost::hash_combine( result, tileIndex.channelName.c_str() );
+					boost::hash_combine( result, tileIndex.mipLevel );
 					return result;
 				}
 			};
 
+			// Origin of the tile in the pixel space of `mipLevel`.
 			Imath::V2i tileOrigin;
 			IECore::InternedString channelName;
+			int mipLevel;
 		};
 
 		struct Tile
@@ -295,6 +311,9 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 
 			// Called from the UI thread.
 			const IECoreGL::Texture *texture( bool &active );
+			// Called from the UI thread. Returns true if the tile has
+			// been computed at least once, and can therefore be drawn.
+			bool hasData();
 
 			private :
 
@@ -316,6 +335,11 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 
 		void updateTiles();
 		void removeOutOfBoundsTiles() const;
+		// Chooses `m_mipLevel` to suit the current viewport, dirtying
+		// the tiles if it has changed.
+		void updateMipLevel();
+
+		int m_mipLevel;
 
 		std::unique_ptr<Gaffer::BackgroundTask> m_tilesTask;
 		std::atomic_bool m_renderRequestPending;
@@ -323,7 +347,7 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		// Rendering.
 
 		void visibilityChanged();
-		void renderTiles() const;
+		void renderTiles( const std::vector<std::string> &channelNames ) const;
 		void renderText( const std::string &text, const Imath::V2f &position, const Imath::V2f &alignment, const GafferUI::Style *style ) const;
 
 		BlendMode m_blendMode;
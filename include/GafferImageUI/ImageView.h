@@ -104,6 +104,10 @@ class GAFFERIMAGEUI_API ImageView : public GafferUI::View
 		const Gaffer::StringPlug *compareCatalogueOutputPlug() const;
 		Gaffer::BoolPlug *compareMatchDisplayWindowsPlug();
 		const Gaffer::BoolPlug *compareMatchDisplayWindowsPlug() const;
+		/// When on, images are displayed using approximate reduced
+		/// resolution mip levels when zoomed out. Off by default.
+		Gaffer::BoolPlug *mipMappingPlug();
+		const Gaffer::BoolPlug *mipMappingPlug() const;
 
 		/// The gadget responsible for displaying the image.
 		ImageGadget *imageGadget();
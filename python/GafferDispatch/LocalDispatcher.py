@@ -34,7 +34,9 @@
 #
 ##########################################################################
 
+import atexit
 import enum
+import json
 import os
 import errno
 import signal
@@ -58,6 +60,9 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		self["executeInBackground"] = Gaffer.BoolPlug( defaultValue = False )
 		self["ignoreScriptLoadErrors"] = Gaffer.BoolPlug( defaultValue = False )
 		self["environmentCommand"] = Gaffer.StringPlug()
+		self["maximumCPUs"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+		self["maximumMemory"] = Gaffer.FloatPlug( defaultValue = 0, minValue = 0 )
+		self["reuseProcesses"] = Gaffer.BoolPlug( defaultValue = False )
 
 		self.__jobPool = jobPool if jobPool else LocalDispatcher.defaultJobPool()
 
@@ -93,6 +98,9 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__environmentCommand = Gaffer.Context.current().substitute(
 				dispatcher["environmentCommand"].getValue()
 			)
+			self.__maximumCPUs = dispatcher["maximumCPUs"].getValue()
+			self.__maximumMemory = dispatcher["maximumMemory"].getValue()
+			self.__reuseProcesses = dispatcher["reuseProcesses"].getValue()
 
 			self.__messageHandler = IECore.CapturingMessageHandler()
 			self.__messageTitle = "%s : Job %s %s" % ( self.__dispatcher.getName(), self.__name, self.__id )
@@ -113,23 +121,26 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		def description( self ) :
 
-			batch = self.__currentBatch()
-			if batch is None or batch.plug() is None :
+			batches = [ b for b in self.__runningBatches() if b.plug() is not None ]
+			if not batches :
 				return "N/A"
 
-			frames = str( IECore.frameListFromList( [ int(x) for x in batch.frames() ] ) )
-
-			return "Executing " + batch.blindData()["nodeName"].value + " on frames " + frames
+			return "Executing " + ", ".join(
+				"{} on frames {}".format(
+					batch.blindData()["nodeName"].value,
+					IECore.frameListFromList( [ int(x) for x in batch.frames() ] )
+				)
+				for batch in batches
+			)
 
 		def statistics( self ) :
 
-			batch = self.__currentBatch()
-			if batch is None or "pid" not in batch.blindData().keys() :
+			pids = [ str( b.blindData()["pid"].value ) for b in self.__runningBatches() if "pid" in b.blindData().keys() ]
+			if not pids :
 				return {}
 
 			rss = 0
 			pcpu = 0.0
-			pid = batch.blindData().get( "pid" )
 
 			try :
 				stats = subprocess.check_output(
@@ -137,14 +148,14 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 					universal_newlines = True,
 				).split()
 				for i in range( 0, len(stats), 6 ) :
-					if str(pid) in stats[i:i+4] :
+					if any( pid in stats[i:i+4] for pid in pids ) :
 						pcpu += float(stats[i+4])
 						rss += float(stats[i+5])
 			except :
 				return {}
 
 			return {
-				"pid" : pid,
+				"pids" : [ int( pid ) for pid in pids ],
 				"pcpu" : pcpu,
 				"rss" : rss,
 			}
@@ -230,32 +241,103 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			with self.__messageHandler :
 				self.__doBackgroundDispatch( self.__batch )
 
-		def __doBackgroundDispatch( self, batch ) :
+		def __doBackgroundDispatch( self, rootBatch ) :
 
-			if self.__getStatus( batch ) == LocalDispatcher.Job.Status.Complete :
-				return True
+			# Order the batches such that each appears after all of its
+			# preTasks. We then repeatedly launch the first batches whose
+			# preTasks are complete, for as long as they fit within the
+			# CPU and memory limits.
 
-			for upstreamBatch in batch.preTasks() :
-				if not self.__doBackgroundDispatch( upstreamBatch ) :
+			pending = []
+			self.__topologicalSortWalk( rootBatch, set(), pending )
+
+			running = {}
+			cpusInUse = 0
+			memoryInUse = 0.0
+			schedule = True
+
+			while True :
+
+				if rootBatch.blindData().get( "killed" ) :
+					for batch, process in running.items() :
+						self.__killProcess( process )
+						self.__setStatus( batch, LocalDispatcher.Job.Status.Killed )
+					self.__reportKilled( rootBatch )
 					return False
 
-			if batch.blindData().get( "killed" ) :
-				self.__reportKilled( batch )
-				return False
+				for batch, process in list( running.items() ) :
+
+					if process.poll() is None :
+						continue
+
+					del running[batch]
+					if isinstance( process, _Worker ) :
+						_workerPool.release( process )
+					cpusInUse -= batch.blindData()["cpus"].value
+					memoryInUse -= batch.blindData()["memory"].value
+
+					if process.returncode :
+						for otherBatch, otherProcess in running.items() :
+							self.__killProcess( otherProcess )
+							self.__setStatus( otherBatch, LocalDispatcher.Job.Status.Killed )
+						self.__reportFailed( batch )
+						return False
+
+					self.__setStatus( batch, LocalDispatcher.Job.Status.Complete )
+					schedule = True
+
+				if schedule :
+
+					schedule = False
+					stillPending = []
+					for i, batch in enumerate( pending ) :
+
+						if self.__getStatus( batch ) == LocalDispatcher.Job.Status.Complete :
+							continue
+
+						if any( self.__getStatus( b ) != LocalDispatcher.Job.Status.Complete for b in batch.preTasks() ) :
+							stillPending.append( batch )
+							continue
+
+						if batch.plug() is None :
+							if batch is rootBatch :
+								self.__reportCompleted( batch )
+								return True
+							self.__setStatus( batch, LocalDispatcher.Job.Status.Complete )
+							continue
+
+						if len( batch.frames() ) == 0 :
+							# This case occurs for nodes like TaskList and TaskContextProcessors,
+							# because they don't do anything in execute (they have empty hashes).
+							# Their batches exist only to depend on upstream batches. We don't need
+							# to do any work here, but we still signal completion for the task to
+							# provide progress feedback to the user.
+							self.__setStatus( batch, LocalDispatcher.Job.Status.Complete )
+							IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, "Finished " + batch.blindData()["nodeName"].value )
+							continue
+
+						# Batches are launched in order, so that a large batch
+						# can't be starved by a stream of smaller ones. We always
+						# allow at least one batch to run, even if it exceeds
+						# the limits by itself.
+						cpus = batch.blindData()["cpus"].value
+						memory = batch.blindData()["memory"].value
+						if running and (
+							cpusInUse + cpus > self.__maximumCPUs or
+							( self.__maximumMemory and memoryInUse + memory > self.__maximumMemory )
+						) :
+							stillPending.extend( pending[i:] )
+							break
+
+						running[batch] = self.__launchBatch( batch )
+						cpusInUse += cpus
+						memoryInUse += memory
+
+					pending = stillPending
 
-			if batch.plug() is None :
-				self.__reportCompleted( batch )
-				return True
+				time.sleep( 0.01 )
 
-			if len( batch.frames() ) == 0 :
-				# This case occurs for nodes like TaskList and TaskContextProcessors,
-				# because they don't do anything in execute (they have empty hashes).
-				# Their batches exist only to depend on upstream batches. We don't need
-				# to do any work here, but we still signal completion for the task to
-				# provide progress feedback to the user.
-				self.__setStatus( batch, LocalDispatcher.Job.Status.Complete )
-				IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, "Finished " + batch.blindData()["nodeName"].value )
-				return True
+		def __launchBatch( self, batch ) :
 
 			taskContext = batch.context()
 			frames = str( IECore.frameListFromList( [ int(x) for x in batch.frames() ] ) )
@@ -282,6 +364,20 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				args.extend( [ "-context" ] + contextArgs )
 
 			self.__setStatus( batch, LocalDispatcher.Job.Status.Running )
+
+			if self.__reuseProcesses :
+				worker = _workerPool.acquire( self.__environmentCommand, self.__scriptFile, self.__ignoreScriptLoadErrors )
+				IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, "Worker {} : {}".format( worker.pid, " ".join( args ) ) )
+				worker.execute( {
+					"script" : str( self.__scriptFile ),
+					"ignoreScriptLoadErrors" : self.__ignoreScriptLoadErrors,
+					"nodes" : [ batch.blindData()["nodeName"].value ],
+					"frames" : frames,
+					"context" : contextArgs,
+				} )
+				batch.blindData()["pid"] = IECore.IntData( worker.pid )
+				return worker
+
 			IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, " ".join( args ) )
 			if os.name == "nt":
 				if self.__environmentCommand :
@@ -292,25 +388,18 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				process = subprocess.Popen( args, start_new_session=True )
 			batch.blindData()["pid"] = IECore.IntData( process.pid )
 
-			while process.poll() is None :
+			return process
 
-				if batch.blindData().get( "killed" ) :
-					if os.name == "nt" :
-						subprocess.check_call( [ "TASKKILL", "/F", "/PID", str( process.pid ), "/T" ] )
-					else :
-						os.killpg( process.pid, signal.SIGTERM )
-					self.__reportKilled( batch )
-					return False
+		@staticmethod
+		def __killProcess( process ) :
 
-				time.sleep( 0.01 )
-
-			if process.returncode :
-				self.__reportFailed( batch )
-				return False
-
-			self.__setStatus( batch, LocalDispatcher.Job.Status.Complete )
+			if process.poll() is not None :
+				return
 
-			return True
+			if os.name == "nt" :
+				subprocess.check_call( [ "TASKKILL", "/F", "/PID", str( process.pid ), "/T" ] )
+			else :
+				os.killpg( process.pid, signal.SIGTERM )
 
 		def __getStatus( self, batch ) :
 
@@ -339,28 +428,38 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__dispatcher.jobPool()._remove( self )
 			IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, "Killed " + self.name() )
 
-		def __currentBatch( self ) :
+		def __runningBatches( self ) :
 
-			## \todo Consider just storing the current batch, rather
-			# than searching each time it is requested.
-			return self.__currentBatchWalk( self.__batch, set() )
+			## \todo Consider just storing the running batches, rather
+			# than searching each time they are requested.
+			result = []
+			self.__runningBatchesWalk( self.__batch, set(), result )
+			return result
 
-		def __currentBatchWalk( self, batch, visited ) :
+		def __runningBatchesWalk( self, batch, visited, result ) :
 
 			if batch in visited :
-				return None
+				return
 
 			visited.add( batch )
 
 			if self.__getStatus( batch ) == LocalDispatcher.Job.Status.Running :
-				return batch
+				result.append( batch )
+
+			for upstreamBatch in batch.preTasks() :
+				self.__runningBatchesWalk( upstreamBatch, visited, result )
+
+		def __topologicalSortWalk( self, batch, visited, result ) :
+
+			if batch in visited :
+				return
+
+			visited.add( batch )
 
 			for upstreamBatch in batch.preTasks() :
-				currentBatch = self.__currentBatchWalk( upstreamBatch, visited )
-				if currentBatch is not None :
-					return currentBatch
+				self.__topologicalSortWalk( upstreamBatch, visited, result )
 
-			return None
+			result.append( batch )
 
 		def __initBatchWalk( self, batch ) :
 
@@ -369,9 +468,23 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				return
 
 			nodeName = ""
+			cpus = 1
+			memory = 0.0
 			if batch.plug() is not None :
-				nodeName = batch.plug().node().relativeName( batch.plug().node().scriptNode() )
+				node = batch.plug().node()
+				nodeName = node.relativeName( node.scriptNode() )
+				localPlug = node["dispatcher"].getChild( "local" )
+				if localPlug is not None and batch.frames() :
+					with Gaffer.Context( batch.context() ) as batchContextWithFrame :
+						# Resources can not be varied per-frame within a batch, but we provide the context
+						# variable so that expressions can be used without erroring.
+						batchContextWithFrame["frame"] = min( batch.frames() )
+						cpus = localPlug["cpus"].getValue()
+						memory = localPlug["memory"].getValue()
+
 			batch.blindData()["nodeName"] = nodeName
+			batch.blindData()["cpus"] = IECore.IntData( cpus )
+			batch.blindData()["memory"] = IECore.FloatData( memory )
 
 			self.__setStatus( batch, LocalDispatcher.Job.Status.Waiting )
 
@@ -448,6 +561,16 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		return self.__jobPool
 
+	@staticmethod
+	def _setupPlugs( parentPlug ) :
+
+		if "local" in parentPlug :
+			return
+
+		parentPlug["local"] = Gaffer.Plug()
+		parentPlug["local"]["cpus"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+		parentPlug["local"]["memory"] = Gaffer.FloatPlug( defaultValue = 0, minValue = 0 )
+
 	def _doDispatch( self, batch ) :
 
 		job = LocalDispatcher.Job(
@@ -459,7 +582,141 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		job.execute( background = self["executeInBackground"].getValue() )
 
+## A persistent `gaffer execute -worker` process, used to execute batches
+# without paying the cost of process startup and script loading for each
+# one. Provides the `poll()`, `returncode` and `pid` members of `subprocess.Popen`
+# so that it can be managed in the same way as a regular process.
+class _Worker( object ) :
+
+	def __init__( self, environmentCommand, scriptFile, ignoreScriptLoadErrors ) :
+
+		args = shlex.split( environmentCommand ) + [
+			str( Gaffer.executablePath() ),
+			"execute", "-worker",
+			"-script", str( scriptFile ),
+		]
+		if ignoreScriptLoadErrors :
+			args.append( "-ignoreScriptLoadErrors" )
+
+		if os.name == "nt" :
+			self.__process = subprocess.Popen( args, shell = bool( environmentCommand ), stdin = subprocess.PIPE, stdout = subprocess.PIPE )
+		else :
+			self.__process = subprocess.Popen( args, start_new_session = True, stdin = subprocess.PIPE, stdout = subprocess.PIPE )
+
+		self.environmentCommand = environmentCommand
+		self.scriptFile = str( scriptFile )
+		self.returncode = 0
+
+	@property
+	def pid( self ) :
+
+		return self.__process.pid
+
+	def alive( self ) :
+
+		return self.__process.poll() is None
+
+	## Sends a request to the worker, returning immediately. Use `poll()`
+	# to determine when the request has completed.
+	def execute( self, request ) :
+
+		self.scriptFile = request["script"]
+		self.returncode = None
+		threading.Thread( target = self.__execute, args = ( request, ), daemon = True ).start()
+
+	def poll( self ) :
+
+		return self.returncode
+
+	def shutdown( self ) :
+
+		# The worker exits when it reaches the end of its input.
+		try :
+			self.__process.stdin.close()
+		except OSError :
+			pass
+
+	## Kills the worker immediately, without waiting for it to
+	# reach the end of its input.
+	def terminate( self ) :
+
+		self.shutdown()
+		if not self.alive() :
+			return
+
+		try :
+			if os.name == "nt" :
+				subprocess.check_call( [ "TASKKILL", "/F", "/PID", str( self.pid ), "/T" ] )
+			else :
+				os.killpg( self.pid, signal.SIGTERM )
+		except ( OSError, subprocess.CalledProcessError ) :
+			pass
+
+	def __execute( self, request ) :
+
+		try :
+			self.__process.stdin.write( ( json.dumps( request ) + "\n" ).encode( "utf-8" ) )
+			self.__process.stdin.flush()
+			response = self.__process.stdout.readline()
+			# An empty response means the worker died, most likely
+			# because it was killed.
+			self.returncode = json.loads( response )["result"] if response else 1
+		except Exception :
+			self.returncode = 1
+
+## Maintains the idle workers available for reuse.
+class _WorkerPool( object ) :
+
+	def __init__( self ) :
+
+		self.__lock = threading.Lock()
+		self.__idleWorkers = []
+		self.__maxIdleWorkers = max( 1, os.cpu_count() or 1 )
+
+		atexit.register( self.shutdown )
+
+	def acquire( self, environmentCommand, scriptFile, ignoreScriptLoadErrors ) :
+
+		with self.__lock :
+
+			self.__idleWorkers = [ w for w in self.__idleWorkers if w.alive() ]
+			candidates = [ w for w in self.__idleWorkers if w.environmentCommand == environmentCommand ]
+			if candidates :
+				# Prefer a worker that already has the script loaded.
+				worker = next( ( w for w in candidates if w.scriptFile == str( scriptFile ) ), candidates[0] )
+				self.__idleWorkers.remove( worker )
+				return worker
+
+		return _Worker( environmentCommand, scriptFile, ignoreScriptLoadErrors )
+
+	def release( self, worker ) :
+
+		if worker.poll() :
+			# The batch failed, so the worker may have been left in a
+			# bad state. Get rid of it, so that a fresh one is launched
+			# in its place by the next call to `acquire()`.
+			worker.terminate()
+			return
+
+		with self.__lock :
+			if worker.alive() and len( self.__idleWorkers ) < self.__maxIdleWorkers :
+				self.__idleWorkers.append( worker )
+				return
+
+		worker.shutdown()
+
+	def shutdown( self ) :
+
+		with self.__lock :
+			workers = self.__idleWorkers
+			self.__idleWorkers = []
+
+		for worker in workers :
+			worker.shutdown()
+
+_workerPool = _WorkerPool()
+
 IECore.registerRunTimeTyped( LocalDispatcher, typeName = "GafferDispatch::LocalDispatcher" )
 IECore.registerRunTimeTyped( LocalDispatcher.JobPool, typeName = "GafferDispatch::LocalDispatcher::JobPool" )
 
-GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher )
+GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher, LocalDispatcher._setupPlugs )
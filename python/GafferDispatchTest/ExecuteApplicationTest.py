@@ -36,6 +36,7 @@
 ##########################################################################
 
 import os
+import json
 import pathlib
 import subprocess
 import unittest
@@ -372,5 +373,61 @@ class ExecuteApplicationTest( GafferTest.TestCase ) :
 		validate( sequence = True )
 		validate( sequence = False )
 
+	def testWorker( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["write"] = GafferDispatchTest.TextWriter()
+		s["write"]["fileName"].setValue( pathlib.Path( self.__outputFileSeq.fileName ) )
+		s["write"]["text"].setValue( "${test}" )
+
+		s["fileName"].setValue( self.__scriptFileName )
+		s.save()
+
+		p = subprocess.Popen(
+			[ str( Gaffer.executablePath() ), "execute", "-worker", "-script", str( self.__scriptFileName ) ],
+			stdin = subprocess.PIPE,
+			stdout = subprocess.PIPE,
+			stderr = subprocess.PIPE,
+			universal_newlines = True,
+		)
+
+		def request( **kw ) :
+
+			p.stdin.write( json.dumps( kw ) + "\n" )
+			p.stdin.flush()
+			return json.loads( p.stdout.readline() )["result"]
+
+		self.assertEqual(
+			request( script = str( self.__scriptFileName ), nodes = [ "write" ], frames = "1-2", context = [ "-test", "'a'" ] ),
+			0
+		)
+		for frame in ( 1, 2 ) :
+			with open( self.__outputFileSeq.fileNameForFrame( frame ), encoding = "utf-8" ) as f :
+				self.assertEqual( f.read(), "a" )
+
+		# Modifications to the script should be picked up by
+		# subsequent requests.
+
+		s["write"]["text"].setValue( "b" )
+		s.save()
+
+		self.assertEqual(
+			request( script = str( self.__scriptFileName ), nodes = [ "write" ], frames = "3" ),
+			0
+		)
+		with open( self.__outputFileSeq.fileNameForFrame( 3 ), encoding = "utf-8" ) as f :
+			self.assertEqual( f.read(), "b" )
+
+		# Errors are reported without terminating the worker.
+
+		self.assertEqual( request( script = str( self.__scriptFileName ), nodes = [ "notANode" ] ), 1 )
+		self.assertEqual( request( script = str( self.__scriptFileName ), nodes = [ "write" ], frames = "4" ), 0 )
+		self.assertTrue( pathlib.Path( self.__outputFileSeq.fileNameForFrame( 4 ) ).exists() )
+
+		p.stdin.close()
+		p.wait()
+		self.assertEqual( p.returncode, 0 )
+
 if __name__ == "__main__":
 	unittest.main()
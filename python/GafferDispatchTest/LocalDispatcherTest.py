@@ -53,9 +53,9 @@ import GafferDispatchTest
 
 class LocalDispatcherTest( GafferTest.TestCase ) :
 
-	def __createLocalDispatcher( self ) :
+	def __createLocalDispatcher( self, jobPool = None ) :
 
-		result = GafferDispatch.LocalDispatcher()
+		result = GafferDispatch.LocalDispatcher( jobPool = jobPool )
 		result["jobsDirectory"].setValue( self.temporaryDirectory() )
 		return result
 
@@ -871,5 +871,270 @@ class LocalDispatcherTest( GafferTest.TestCase ) :
 			open( self.temporaryDirectory() / "outer.txt", encoding = "utf-8" ).readlines(),
 		)
 
+	def __timingScript( self ) :
+
+		# Creates a script where each frame of `s["timer"]` records the
+		# time it starts and ends, and `s["downstream"]` records its start
+		# time after all frames of `s["timer"]` have completed.
+
+		s = Gaffer.ScriptNode()
+
+		s["timer"] = GafferDispatch.PythonCommand()
+		s["timer"]["command"].setValue( inspect.cleandoc(
+			"""
+			import time
+			start = time.time()
+			time.sleep( 1 )
+			with open( "{directory}/timer.{{}}.txt".format( int( context.getFrame() ) ), "w" ) as f :
+				f.write( "{{}} {{}}".format( start, time.time() ) )
+			""".format( directory = self.temporaryDirectory().as_posix() )
+		) )
+
+		s["downstream"] = GafferDispatch.PythonCommand()
+		s["downstream"]["preTasks"][0].setInput( s["timer"]["task"] )
+		s["downstream"]["sequence"].setValue( True )
+		s["downstream"]["command"].setValue( inspect.cleandoc(
+			"""
+			import time
+			with open( "{directory}/downstream.txt", "w" ) as f :
+				f.write( str( time.time() ) )
+			""".format( directory = self.temporaryDirectory().as_posix() )
+		) )
+
+		return s
+
+	def __timings( self, frames ) :
+
+		intervals = []
+		for frame in frames :
+			with open( self.temporaryDirectory() / "timer.{}.txt".format( frame ), encoding = "utf-8" ) as f :
+				intervals.append( [ float( x ) for x in f.read().split() ] )
+
+		with open( self.temporaryDirectory() / "downstream.txt", encoding = "utf-8" ) as f :
+			downstream = float( f.read() )
+
+		return intervals, downstream
+
+	@staticmethod
+	def __maxOverlap( intervals ) :
+
+		result = 0
+		for start, end in intervals :
+			result = max( result, len( [ i for i in intervals if i[0] < end and i[1] > start ] ) )
+
+		return result
+
+	def testParallelExecution( self ) :
+
+		s = self.__timingScript()
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-4" )
+		d["maximumCPUs"].setValue( 4 )
+
+		d.dispatch( [ s["downstream"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+
+		intervals, downstream = self.__timings( range( 1, 5 ) )
+
+		# Independent frames should have run concurrently, but
+		# the downstream task must still wait for all of them.
+		self.assertGreater( self.__maxOverlap( intervals ), 1 )
+		self.assertLessEqual( self.__maxOverlap( intervals ), 4 )
+		self.assertGreaterEqual( downstream, max( i[1] for i in intervals ) )
+
+	def testCPULimits( self ) :
+
+		s = self.__timingScript()
+		s["timer"]["dispatcher"]["local"]["cpus"].setValue( 2 )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-4" )
+		d["maximumCPUs"].setValue( 3 )
+
+		d.dispatch( [ s["downstream"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+
+		intervals, downstream = self.__timings( range( 1, 5 ) )
+		self.assertEqual( self.__maxOverlap( intervals ), 1 )
+		self.assertGreaterEqual( downstream, max( i[1] for i in intervals ) )
+
+	def testMemoryLimits( self ) :
+
+		s = self.__timingScript()
+		s["timer"]["dispatcher"]["local"]["memory"].setValue( 3 )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-4" )
+		d["maximumCPUs"].setValue( 4 )
+		d["maximumMemory"].setValue( 4 )
+
+		d.dispatch( [ s["downstream"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+
+		intervals, downstream = self.__timings( range( 1, 5 ) )
+		self.assertEqual( self.__maxOverlap( intervals ), 1 )
+
+	def testKillParallelExecution( self ) :
+
+		s = self.__timingScript()
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-4" )
+		d["maximumCPUs"].setValue( 4 )
+
+		d.dispatch( [ s["downstream"] ] )
+		self.assertEqual( len( d.jobPool().jobs() ), 1 )
+
+		job = d.jobPool().jobs()[0]
+		statistics = {}
+		timeout = time.time() + 10
+		while not statistics and time.time() < timeout :
+			statistics = job.statistics()
+			time.sleep( 0.1 )
+		self.assertIsInstance( statistics["pids"], list )
+
+		job.kill()
+		d.jobPool().waitForAll()
+
+		self.assertEqual( len( d.jobPool().jobs() ), 0 )
+		self.assertFalse( ( self.temporaryDirectory() / "downstream.txt" ).exists() )
+
+	def testReuseProcesses( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["pid"] = GafferDispatch.PythonCommand()
+		s["pid"]["command"].setValue( inspect.cleandoc(
+			"""
+			import os
+			with open( "{directory}/pid.{{}}.txt".format( int( context.getFrame() ) ), "w" ) as f :
+				f.write( str( os.getpid() ) )
+			""".format( directory = self.temporaryDirectory().as_posix() )
+		) )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["reuseProcesses"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+
+		def pids( frames ) :
+
+			result = set()
+			for frame in frames :
+				with open( self.temporaryDirectory() / "pid.{}.txt".format( frame ), encoding = "utf-8" ) as f :
+					result.add( int( f.read() ) )
+			return result
+
+		d["frameRange"].setValue( "1-4" )
+		d.dispatch( [ s["pid"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+
+		# All batches were executed serially, so should have
+		# been executed by a single worker.
+		pids1 = pids( range( 1, 5 ) )
+		self.assertEqual( len( pids1 ), 1 )
+		self.assertNotIn( os.getpid(), pids1 )
+
+		# And that worker should be reused by subsequent
+		# dispatches, even though they save a new script.
+
+		d["frameRange"].setValue( "5-6" )
+		d.dispatch( [ s["pid"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+		self.assertEqual( pids( range( 5, 7 ) ), pids1 )
+
+	def testFailureKillsParallelBatches( self ) :
+
+		s = self.__timingScript()
+		s["timer"]["command"].setValue( inspect.cleandoc(
+			"""
+			import time
+			if context.getFrame() == 1 :
+				raise RuntimeError( "Failed" )
+			time.sleep( 10 )
+			"""
+		) )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-4" )
+		d["maximumCPUs"].setValue( 4 )
+
+		startTime = time.time()
+		d.dispatch( [ s["downstream"] ] )
+		d.jobPool().waitForAll()
+		self.assertLess( time.time() - startTime, 10 )
+
+		self.assertEqual( len( d.jobPool().failedJobs() ), 1 )
+		# The batches that were killed because of the failure must
+		# no longer be considered to be running.
+		self.assertEqual( d.jobPool().failedJobs()[0].statistics(), {} )
+
+	def testReuseProcessesFailure( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferDispatchTest.TextWriter()
+		s["n"]["fileName"].setValue( "" )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["reuseProcesses"].setValue( True )
+
+		d.dispatch( [ s["n"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 1 )
+
+	def testReuseProcessesReplacesFailedWorker( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["pid"] = GafferDispatch.PythonCommand()
+		s["pid"]["command"].setValue( inspect.cleandoc(
+			"""
+			import os
+			with open( "{directory}/pid.{{}}.txt".format( int( context.getFrame() ) ), "w" ) as f :
+				f.write( str( os.getpid() ) )
+			if context.getFrame() == 2 :
+				raise RuntimeError( "Failed" )
+			""".format( directory = self.temporaryDirectory().as_posix() )
+		) )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["reuseProcesses"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+
+		def pid( frame ) :
+
+			with open( self.temporaryDirectory() / "pid.{}.txt".format( frame ), encoding = "utf-8" ) as f :
+				return int( f.read() )
+
+		d["frameRange"].setValue( "1-2" )
+		d.dispatch( [ s["pid"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 1 )
+		self.assertEqual( pid( 1 ), pid( 2 ) )
+
+		# The worker that failed must not be reused.
+
+		d["frameRange"].setValue( "3" )
+		d.dispatch( [ s["pid"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 1 )
+		self.assertNotEqual( pid( 3 ), pid( 2 ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -97,6 +97,90 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"maximumCPUs" : (
+
+			"description",
+			"""
+			The number of CPUs available for executing tasks in the
+			background. Independent batches are executed concurrently
+			provided that the sum of their `dispatcher.local.cpus`
+			settings does not exceed this limit. The default of 1
+			executes batches one at a time.
+			""",
+
+		),
+
+		"maximumMemory" : (
+
+			"description",
+			"""
+			The amount of memory (in gigabytes) available for executing
+			tasks in the background. Independent batches are executed
+			concurrently provided that the sum of their `dispatcher.local.memory`
+			settings does not exceed this limit. A value of 0 disables the
+			limit.
+			""",
+
+		),
+
+		"reuseProcesses" : (
+
+			"description",
+			"""
+			Executes batches using a pool of persistent `gaffer execute` worker
+			processes, rather than launching a new process for each batch. This
+			avoids the cost of process startup and script loading for each batch,
+			and allows caches to remain warm between batches and between dispatches.
+			Workers reload the script whenever it changes.
+			""",
+
+		),
+
+	}
+
+)
+
+Gaffer.Metadata.registerNode(
+
+	GafferDispatch.TaskNode,
+
+	plugs = {
+
+		"dispatcher.local" : [
+
+			"description",
+			"""
+			Settings that control how tasks are
+			executed by the LocalDispatcher.
+			""",
+
+			"layout:section", "Local",
+			"plugValueWidget:type", "GafferUI.LayoutPlugValueWidget",
+
+		],
+
+		"dispatcher.local.cpus" : [
+
+			"description",
+			"""
+			The number of CPUs used by each batch of this task, counted
+			against the LocalDispatcher's `maximumCPUs` setting when
+			executing in the background.
+			""",
+
+		],
+
+		"dispatcher.local.memory" : [
+
+			"description",
+			"""
+			The amount of memory (in gigabytes) used by each batch of this
+			task, counted against the LocalDispatcher's `maximumMemory` setting
+			when executing in the background.
+			""",
+
+		],
+
 	}
 
 )
@@ -41,6 +41,7 @@ import pathlib
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 import os
@@ -198,5 +199,57 @@ class BlurTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( finalCrop["out"], expectedReader["out"], maxDifference = 0.00001, ignoreMetadata = True )
 
+	def testRecursiveMethod( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "checker.exr" )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( reader["out"] )
+
+		recursiveBlur = GafferImage.Blur()
+		recursiveBlur["in"].setInput( reader["out"] )
+		recursiveBlur["method"].setValue( GafferImage.Blur.Method.Recursive )
+
+		for radius in [ imath.V2f( 2 ), imath.V2f( 7.5, 20 ), imath.V2f( 0, 10 ), imath.V2f( 40 ) ] :
+			for boundingMode in ( GafferImage.Sampler.BoundingMode.Black, GafferImage.Sampler.BoundingMode.Clamp ) :
+				for expandDataWindow in [ False, True ] :
+					with self.subTest( radius = radius, boundingMode = boundingMode, expandDataWindow = expandDataWindow ) :
+						for b in ( blur, recursiveBlur ) :
+							b["radius"].setValue( radius )
+							b["boundingMode"].setValue( boundingMode )
+							b["expandDataWindow"].setValue( expandDataWindow )
+
+						self.assertEqual( recursiveBlur["out"].dataWindow(), blur["out"].dataWindow() )
+						self.assertImagesEqual( recursiveBlur["out"], blur["out"], maxDifference = 0.1 )
+
+		recursiveBlur["radius"].setValue( imath.V2f( 0 ) )
+		self.assertImageHashesEqual( recursiveBlur["out"], reader["out"] )
+
+	def testMethodAffectsChannelData( self ) :
+
+		blur = GafferImage.Blur()
+		blur["radius"].setValue( imath.V2f( 2 ) )
+
+		cs = GafferTest.CapturingSlot( blur.plugDirtiedSignal() )
+		blur["method"].setValue( GafferImage.Blur.Method.Recursive )
+		self.assertIn( blur["out"]["channelData"], { x[0] for x in cs } )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testRecursivePerformance( self ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / "deepMergeReference.exr" )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( imageReader["out"] )
+		blur["radius"].setValue( imath.V2f( 200 ) )
+		blur["method"].setValue( GafferImage.Blur.Method.Recursive )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( blur["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -411,5 +411,56 @@ class ColorSpaceTest( GafferImageTest.ImageTestCase ) :
 			GafferImage.OpenColorIOAlgo.setWorkingSpace( context, "color_picking" )
 			self.assertNotEqual( colorSpace["out"].channelData( "R", imath.V2i( 0 ) ), tile )
 
+	def testBake( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.fileName )
+
+		exact = GafferImage.ColorSpace()
+		exact["in"].setInput( reader["out"] )
+		exact["inputSpace"].setValue( "scene_linear" )
+		exact["outputSpace"].setValue( "color_picking" )
+
+		baked = GafferImage.ColorSpace()
+		baked["in"].setInput( reader["out"] )
+		baked["inputSpace"].setValue( "scene_linear" )
+		baked["outputSpace"].setValue( "color_picking" )
+
+		self.assertEqual( baked["bakeError"].getValue(), 0 )
+		self.assertImageHashesEqual( baked["out"], exact["out"] )
+
+		cs = GafferTest.CapturingSlot( baked.plugDirtiedSignal() )
+		baked["bake"].setValue( True )
+		baked["bakeTolerance"].setValue( 0.01 )
+		self.assertIn( baked["bakeError"], { x[0] for x in cs } )
+		self.assertIn( baked["out"]["channelData"], { x[0] for x in cs } )
+
+		# Error is reported, and is small enough for the LUT to be used.
+
+		error = baked["bakeError"].getValue()
+		self.assertGreater( error, 0 )
+		self.assertLess( error, baked["bakeTolerance"].getValue() )
+
+		self.assertNotEqual( baked["out"].channelDataHash( "R", imath.V2i( 0 ) ), exact["out"].channelDataHash( "R", imath.V2i( 0 ) ) )
+		self.assertImagesEqual( baked["out"], exact["out"], maxDifference = 0.01 )
+
+		# If the error exceeds the tolerance, we fall back to the exact processor.
+
+		baked["bakeTolerance"].setValue( error / 2 )
+		self.assertEqual( baked["bakeError"].getValue(), error )
+		self.assertImagesEqual( baked["out"], exact["out"] )
+
+		# Negative values are outside the range of the LUT, so are processed exactly.
+
+		baked["bakeTolerance"].setValue( 1 )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( reader["out"] )
+		grade["offset"].setValue( imath.Color4f( -2, -2, -2, 0 ) )
+
+		exact["in"].setInput( grade["out"] )
+		baked["in"].setInput( grade["out"] )
+		self.assertImagesEqual( baked["out"], exact["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -38,6 +38,7 @@ import os
 import unittest
 import random
 import threading
+import time
 import subprocess
 import imath
 
@@ -84,7 +85,7 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 
 		# The channelData argument is a list of FloatVectorData
 		# per channel.
-		def sendBucket( self, bucketWindow, channelData ) :
+		def sendBucket( self, bucketWindow, channelData, withCallHandler = True ) :
 
 			bucketSize = bucketWindow.size()
 			bucketData = IECore.FloatVectorData()
@@ -94,6 +95,17 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 					for c in channelData :
 						bucketData.append( c[i] )
 
+			if not withCallHandler :
+				self.__driver.imageData(
+					self.__format.toEXRSpace( bucketWindow ),
+					bucketData
+				)
+				return
+
+			# Display limits the rate of UI updates, so we must wait
+			# long enough for this bucket to be shown immediately.
+			time.sleep( 0.05 )
+
 			with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
 
 				self.__driver.imageData(
@@ -214,6 +226,130 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 
 		self.__testTransferImage( self.imagesPath() / "checkerWithNegativeDataWindow.200x150.exr" )
 
+	def testTransferChannelCounts( self ) :
+
+		# A single bucket spanning several tiles, to exercise the
+		# parallel transfer and the specialisations for each channel count.
+		dataWindow = imath.Box2i( imath.V2i( -10, 5 ), imath.V2i( 150, 140 ) )
+		size = dataWindow.size()
+		tileSize = GafferImage.ImagePlug.tileSize()
+
+		for numChannels in ( 1, 2, 3, 4, 5, 8, 16 ) :
+
+			with self.subTest( numChannels = numChannels ) :
+
+				node = GafferImage.Display()
+				server = IECoreImage.DisplayDriverServer()
+				driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ), scoped = True )
+
+				channelNames = [ "C{}".format( c ) for c in range( 0, numChannels ) ]
+				driver = self.Driver(
+					GafferImage.Format( 200, 150 ),
+					dataWindow,
+					channelNames,
+					port = server.portNumber(),
+				)
+
+				driver.sendBucket(
+					dataWindow,
+					[ IECore.FloatVectorData( [ c * 100000 + i for i in range( 0, size.x * size.y ) ] ) for c in range( 0, numChannels ) ]
+				)
+
+				for c, channelName in enumerate( channelNames ) :
+					for tileOrigin, tile in self.__tiles( node, channelName ).items() :
+						expected = IECore.FloatVectorData()
+						for y in range( tileOrigin[1], tileOrigin[1] + tileSize ) :
+							for x in range( tileOrigin[0], tileOrigin[0] + tileSize ) :
+								if GafferImage.BufferAlgo.contains( dataWindow, imath.V2i( x, y ) ) :
+									expected.append( c * 100000 + ( y - dataWindow.min().y ) * size.x + x - dataWindow.min().x )
+								else :
+									expected.append( 0 )
+						self.assertEqual( tile, expected )
+
+				driver.close()
+
+	def testCoalescedUpdates( self ) :
+
+		node = GafferImage.Display()
+		server = IECoreImage.DisplayDriverServer()
+		driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ), scoped = True )
+
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 255 ) )
+		driver = self.Driver(
+			GafferImage.Format( dataWindow ),
+			dataWindow,
+			[ "Y" ],
+			port = server.portNumber(),
+		)
+
+		t1 = self.__tiles( node, "Y" )
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		bucketData = IECore.FloatVectorData( [ 1 ] * tileSize * tileSize )
+
+		with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
+
+			# While a UI thread call is outstanding, any further
+			# buckets should join its batch rather than scheduling
+			# calls of their own.
+			for x in range( 0, 4 ) :
+				driver.sendBucket(
+					imath.Box2i( imath.V2i( x * tileSize, 0 ), imath.V2i( ( x + 1 ) * tileSize - 1, tileSize - 1 ) ),
+					[ bucketData ], withCallHandler = False
+				)
+
+			time.sleep( 1 )
+
+			h.assertCalled()
+			h.assertDone()
+
+		t2 = self.__tiles( node, "Y" )
+		self.__assertTilesChangedInRegion( t1, t2, imath.Box2i( imath.V2i( 0 ), imath.V2i( 4 * tileSize, tileSize - 1 ) ) )
+
+		driver.close()
+
+	def testUpdateRateLimit( self ) :
+
+		node = GafferImage.Display()
+		server = IECoreImage.DisplayDriverServer()
+		driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ), scoped = True )
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 2 * tileSize - 1, tileSize - 1 ) )
+		driver = self.Driver(
+			GafferImage.Format( dataWindow ),
+			dataWindow,
+			[ "Y" ],
+			port = server.portNumber(),
+		)
+
+		t1 = self.__tiles( node, "Y" )
+
+		bucketData = IECore.FloatVectorData( [ 1 ] * tileSize * tileSize )
+		bucket1 = imath.Box2i( imath.V2i( 0 ), imath.V2i( tileSize - 1 ) )
+		bucket2 = imath.Box2i( imath.V2i( tileSize, 0 ), imath.V2i( 2 * tileSize - 1, tileSize - 1 ) )
+
+		# The first bucket is shown immediately, but the second arrives
+		# too soon after it, so its update is held back.
+
+		time.sleep( 0.05 )
+		with GafferTest.ParallelAlgoTest.UIThreadCallHandler() as h :
+			driver.sendBucket( bucket1, [ bucketData ], withCallHandler = False )
+			h.assertCalled()
+			driver.sendBucket( bucket2, [ bucketData ], withCallHandler = False )
+			h.assertCalled()
+			h.assertDone()
+
+		t2 = self.__tiles( node, "Y" )
+		self.__assertTilesChangedInRegion( t1, t2, bucket1 )
+
+		# Closing the image flushes the held back update.
+
+		driver.close()
+
+		t3 = self.__tiles( node, "Y" )
+		self.__assertTilesChangedInRegion( t2, t3, bucket2 )
+
 	def testAccessOutsideDataWindow( self ) :
 
 		node = self.__testTransferImage( self.imagesPath() / "checker.exr" )
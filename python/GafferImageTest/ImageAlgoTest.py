@@ -35,6 +35,8 @@
 ##########################################################################
 
 import unittest
+import threading
+import time
 import imath
 import itertools
 import re
@@ -204,7 +206,10 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 			size = GafferImage.ImagePlug.tileIndex( window.max() - imath.V2i( 1 ) ) - GafferImage.ImagePlug.tileIndex( window.min() ) + imath.V2i( 1 )
 			numTiles = size.x * size.y
 
-			for order in GafferImage.ImageAlgo.TileOrder.values.values() :
+			for order, gatherMode in itertools.product(
+				GafferImage.ImageAlgo.TileOrder.values.values(),
+				GafferImage.ImageAlgo.GatherMode.values.values()
+			) :
 
 				del tileOrigins[:]
 				del channelTileOrigins[:]
@@ -214,7 +219,8 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 					tileFunctor,
 					gatherFunctor,
 					window = window,
-					tileOrder = order
+					tileOrder = order,
+					gatherMode = gatherMode
 				)
 
 				GafferImage.ImageAlgo.parallelGatherTiles(
@@ -223,7 +229,8 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 					tileFunctor,
 					channelGatherFunctor,
 					window = window,
-					tileOrder = order
+					tileOrder = order,
+					gatherMode = gatherMode
 				)
 
 				self.assertEqual( len( tileOrigins ), numTiles )
@@ -254,6 +261,107 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 
 		GafferImage.ImageAlgo.parallelGatherTiles( constant["out"], [ "R", "G", "B", "A" ], computeTile, gatherTile )
 
+	def testPipelinedGatherExceptions( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 1000, 1000 ) )
+
+		def computeTile( image, tileOrigin ) :
+
+			if tileOrigin == imath.V2i( 0 ) and raiseInCompute :
+				raise RuntimeError( "Compute error" )
+			return image["channelData"].getValue()
+
+		def gatherTile( image, tileOrigin, tile ) :
+
+			if tileOrigin == imath.V2i( 0 ) and not raiseInCompute :
+				raise RuntimeError( "Gather error" )
+
+		for raiseInCompute in ( True, False ) :
+			for maxTilesInFlight in ( 0, 1, 3 ) :
+				with self.assertRaisesRegex( RuntimeError, "Compute error" if raiseInCompute else "Gather error" ) :
+					GafferImage.ImageAlgo.parallelGatherTiles(
+						constant["out"], computeTile, gatherTile,
+						tileOrder = GafferImage.ImageAlgo.TileOrder.TopToBottom,
+						gatherMode = GafferImage.ImageAlgo.GatherMode.PipelinedGather,
+						maxTilesInFlight = maxTilesInFlight
+					)
+
+	def testPipelinedGatherMaxTilesInFlight( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 1000, 1000 ) )
+
+		lock = threading.Lock()
+		inFlight = 0
+		maxInFlight = 0
+
+		def computeTile( image, tileOrigin ) :
+
+			nonlocal inFlight, maxInFlight
+			with lock :
+				inFlight += 1
+				maxInFlight = max( maxInFlight, inFlight )
+			return image["channelData"].getValue()
+
+		def gatherTile( image, tileOrigin, tile ) :
+
+			nonlocal inFlight
+			time.sleep( 0.001 )
+			with lock :
+				inFlight -= 1
+
+		# One tile per thread may be held by the pipeline, plus `maxTilesInFlight`
+		# in the queue, plus the one being gathered.
+		numThreads = IECore.hardwareConcurrency()
+		for maxTilesInFlight in ( 1, 4, 10 ) :
+			maxInFlight = 0
+			GafferImage.ImageAlgo.parallelGatherTiles(
+				constant["out"], computeTile, gatherTile,
+				tileOrder = GafferImage.ImageAlgo.TileOrder.TopToBottom,
+				gatherMode = GafferImage.ImageAlgo.GatherMode.PipelinedGather,
+				maxTilesInFlight = maxTilesInFlight
+			)
+			self.assertEqual( inFlight, 0 )
+			self.assertLessEqual( maxInFlight, numThreads + maxTilesInFlight + 1 )
+
+	@unittest.skipIf( IECore.hardwareConcurrency() < 2, "Requires multiple threads" )
+	def testPipelinedGatherConcurrency( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 1000, 1000 ) )
+
+		lock = threading.Lock()
+		computing = 0
+		maxComputing = 0
+
+		def computeTile( image, tileOrigin ) :
+
+			nonlocal computing, maxComputing
+			with lock :
+				computing += 1
+				maxComputing = max( maxComputing, computing )
+			time.sleep( 0.01 )
+			with lock :
+				computing -= 1
+			return image["channelData"].getValue()
+
+		def gatherTile( image, tileOrigin, tile ) :
+
+			pass
+
+		# Even the smallest queue must not serialise the computation
+		# of tiles.
+		for maxTilesInFlight in ( 1, 3 ) :
+			maxComputing = 0
+			GafferImage.ImageAlgo.parallelGatherTiles(
+				constant["out"], computeTile, gatherTile,
+				tileOrder = GafferImage.ImageAlgo.TileOrder.TopToBottom,
+				gatherMode = GafferImage.ImageAlgo.GatherMode.PipelinedGather,
+				maxTilesInFlight = maxTilesInFlight
+			)
+			self.assertGreater( maxComputing, 1 )
+
 	def testMonitorParallelProcessTiles( self ) :
 
 		numTilesX = 50
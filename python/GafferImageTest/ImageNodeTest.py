@@ -106,6 +106,145 @@ class ImageNodeTest( GafferImageTest.ImageTestCase ) :
 		self.assertNodesConstructWithDefaultValues( GafferImage )
 		self.assertNodesConstructWithDefaultValues( GafferImageTest )
 
+	def testMipLevelFallback( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 150, 100 ) )
+		checker["size"].setValue( imath.V2f( 3 ) )
+
+		# Crop doesn't support mip levels natively, so will be
+		# box filtered by the ImageNode base class.
+		crop = GafferImage.Crop()
+		crop["in"].setInput( checker["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 3, 5 ), imath.V2i( 149, 97 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		for level in ( 1, 2 ) :
+			self.__assertMipLevelFiltered( crop["out"], level )
+
+	def testMipLevelSupported( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 150, 100 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( checker["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 3, 5 ), imath.V2i( 149, 97 ) ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( crop["out"] )
+		grade["multiply"].setValue( imath.Color4f( 2 ) )
+
+		with Gaffer.Context() as c :
+
+			c["image:mipLevel"] = 1
+
+			self.assertEqual( grade["out"].format(), crop["out"].format() )
+			self.assertEqual( grade["out"].dataWindow(), crop["out"].dataWindow() )
+
+			for tileOrigin in self.__tileOrigins( grade["out"].dataWindow() ) :
+				inputData = crop["out"].channelData( "R", tileOrigin )
+				outputData = grade["out"].channelData( "R", tileOrigin )
+				for i, o in zip( inputData, outputData ) :
+					self.assertAlmostEqual( o, i * 2, places = 5 )
+
+		# Grading is linear, so computing from the filtered input
+		# is equivalent to filtering the full resolution output.
+		self.__assertMipLevelFiltered( grade["out"], 1 )
+
+	def testMipLevelWindow( self ) :
+
+		self.assertEqual(
+			GafferImage.ImageAlgo.mipLevelWindow( imath.Box2i( imath.V2i( 0 ), imath.V2i( 100 ) ), 0 ),
+			imath.Box2i( imath.V2i( 0 ), imath.V2i( 100 ) )
+		)
+
+		self.assertEqual(
+			GafferImage.ImageAlgo.mipLevelWindow( imath.Box2i( imath.V2i( -3, 5 ), imath.V2i( 101, 97 ) ), 1 ),
+			imath.Box2i( imath.V2i( -2, 2 ), imath.V2i( 51, 49 ) )
+		)
+
+		self.assertEqual(
+			GafferImage.ImageAlgo.mipLevelWindow( imath.Box2i( imath.V2i( -3, 5 ), imath.V2i( 101, 97 ) ), 2 ),
+			imath.Box2i( imath.V2i( -1, 1 ), imath.V2i( 26, 25 ) )
+		)
+
+		self.assertEqual(
+			GafferImage.ImageAlgo.mipLevelWindow( imath.Box2i(), 2 ),
+			imath.Box2i()
+		)
+
+	def testMipLevelsNotSupportedForDeepImages( self ) :
+
+		constant = GafferImage.Constant()
+		flatToDeep = GafferImage.FlatToDeep()
+		flatToDeep["in"].setInput( constant["out"] )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( flatToDeep["out"] )
+
+		with Gaffer.Context() as c :
+			c["image:mipLevel"] = 1
+			with self.assertRaisesRegex( Gaffer.ProcessException, "Mip levels are not supported for deep images" ) :
+				offset["out"].channelData( "R", imath.V2i( 0 ) )
+
+	def __assertMipLevelFiltered( self, image, level ) :
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		fullDataWindow = image.dataWindow()
+		fullFormat = image.format()
+
+		tiles = {
+			( tileOrigin.x, tileOrigin.y ) : image.channelData( "R", tileOrigin )
+			for tileOrigin in self.__tileOrigins( fullDataWindow )
+		}
+
+		def fullResolutionPixel( p ) :
+
+			if not GafferImage.BufferAlgo.contains( fullDataWindow, p ) :
+				return 0.0
+
+			tileOrigin = GafferImage.ImagePlug.tileOrigin( p )
+			tile = tiles[( tileOrigin.x, tileOrigin.y )]
+			return tile[(p.y - tileOrigin.y) * tileSize + p.x - tileOrigin.x]
+
+		with Gaffer.Context() as c :
+
+			c["image:mipLevel"] = level
+
+			self.assertEqual(
+				image.format().getDisplayWindow(),
+				GafferImage.ImageAlgo.mipLevelWindow( fullFormat.getDisplayWindow(), level )
+			)
+
+			dataWindow = image.dataWindow()
+			self.assertEqual( dataWindow, GafferImage.ImageAlgo.mipLevelWindow( fullDataWindow, level ) )
+
+			scale = 2 ** level
+			for tileOrigin in self.__tileOrigins( dataWindow ) :
+				channelData = image.channelData( "R", tileOrigin )
+				bound = GafferImage.BufferAlgo.intersection(
+					dataWindow, imath.Box2i( tileOrigin, tileOrigin + imath.V2i( tileSize ) )
+				)
+				for y in range( bound.min().y, bound.max().y ) :
+					for x in range( bound.min().x, bound.max().x ) :
+						expected = sum(
+							fullResolutionPixel( imath.V2i( x * scale + i, y * scale + j ) )
+							for j in range( 0, scale ) for i in range( 0, scale )
+						) / ( scale * scale )
+						self.assertAlmostEqual(
+							channelData[(y - tileOrigin.y) * tileSize + x - tileOrigin.x], expected, places = 5
+						)
+
+	@staticmethod
+	def __tileOrigins( dataWindow ) :
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		minTile = GafferImage.ImagePlug.tileOrigin( dataWindow.min() )
+		for y in range( minTile.y, dataWindow.max().y, tileSize ) :
+			for x in range( minTile.x, dataWindow.max().x, tileSize ) :
+				yield imath.V2i( x, y )
+
 	def setUp( self ) :
 
 		GafferImageTest.ImageTestCase.setUp( self )
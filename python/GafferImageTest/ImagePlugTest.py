@@ -36,6 +36,7 @@
 ##########################################################################
 
 import os
+import subprocess
 import unittest
 import imath
 
@@ -297,6 +298,44 @@ class ImagePlugTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
 
+	@unittest.skipIf( not GafferImage.ImagePlug.tileSizeIsConfigurable(), "Tile size is fixed at build time" )
+	def testTileSizeEnvironmentVariable( self ) :
+
+		for tileSizeLog2 in ( 6, 9 ) :
+
+			env = os.environ.copy()
+			env["GAFFERIMAGE_TILE_SIZE_LOG2"] = str( tileSizeLog2 )
+			env["GAFFERIMAGETEST_EXPECTED_TILE_SIZE"] = str( 1 << tileSizeLog2 )
+
+			try :
+				subprocess.check_output(
+					[
+						str( Gaffer.executablePath() ), "test",
+						"GafferImageTest.ImagePlugTest.checkTileSize",
+						"GafferImageTest.ResampleTest.testExpectedOutput",
+						"GafferImageTest.ResampleTest.testSeparableMatchesSinglePass",
+					],
+					env = env, stderr = subprocess.STDOUT
+				)
+			except subprocess.CalledProcessError as e :
+				self.fail( e.output )
+
+	def checkTileSize( self ) :
+
+		tileSize = int( os.environ["GAFFERIMAGETEST_EXPECTED_TILE_SIZE"] )
+		self.assertEqual( GafferImage.ImagePlug.tileSize(), tileSize )
+		self.assertEqual( 1 << GafferImage.ImagePlug.tileSizeLog2(), tileSize )
+		self.assertEqual( GafferImage.ImagePlug.tilePixels(), tileSize * tileSize )
+		self.assertEqual( len( GafferImage.ImagePlug.blackTile() ), tileSize * tileSize )
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 1000, 1000 ) )
+		self.assertEqual( len( c["out"].channelData( "R", imath.V2i( 0 ) ) ), tileSize * tileSize )
+		self.assertEqual(
+			len( GafferImage.ImageAlgo.tiles( c["out"] )["tileOrigins"] ),
+			( ( 1000 + tileSize - 1 ) // tileSize ) ** 2
+		)
+
 	def __testTileData( self, tileData, numSamples, value = None, valueFunc = None ) :
 
 		self.assertEqual( len(tileData), numSamples )
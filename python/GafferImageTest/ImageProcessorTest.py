@@ -35,6 +35,7 @@
 ##########################################################################
 
 import unittest
+import imath
 
 import IECore
 
@@ -122,5 +123,84 @@ class ImageProcessorTest( GafferImageTest.ImageTestCase ) :
 		self.assertEqual( n["in"].minSize(), 2 )
 		self.assertEqual( n["in"].maxSize(), Gaffer.ArrayPlug().maxSize() )
 
+	def testChannelGroupPlug( self ) :
+
+		# Only nodes which actually compute channel groups should pay
+		# for the internal plug used to cache them.
+
+		self.assertNotIn( "__channelGroup", GafferImage.ImageProcessor() )
+		self.assertNotIn( "__channelGroup", GafferImage.ImageProcessor( minInputs = 2 ) )
+		self.assertNotIn( "__channelGroup", GafferImage.Offset() )
+		self.assertNotIn( "__channelGroup", GafferImage.Blur() )
+
+		self.assertIn( "__channelGroup", GafferImage.Premultiply() )
+		self.assertIn( "__channelGroup", GafferImage.Resample() )
+
+		self.assertIn( "__channelGroup", GafferImage.Saturation() )
+		self.assertNotIn( "__channelGroup", GafferImage.Grade() )
+		self.assertIn( "__channelGroup", GafferImage.CDL() )
+
+	def __channelGroupOverheadPerf( self, node, grouped ) :
+
+		# Processes an image with trivial per-pixel work, so that the timing
+		# is dominated by the fixed cost of each tile. When `grouped` is False,
+		# the RGB channels are renamed so that they are computed individually.
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 4096, 4096 ) )
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 1, 0.5 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( constant["out"] )
+
+		deleteChannels = GafferImage.DeleteChannels()
+		deleteChannels["in"].setInput( shuffle["out"] )
+
+		if not grouped :
+			for c in "RGB" :
+				shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "custom" + c, c ) )
+			deleteChannels["channels"].setValue( "R G B" )
+
+		node["in"].setInput( deleteChannels["out"] )
+
+		GafferImageTest.processTiles( deleteChannels["out"] )
+		if "__horizontalPass" in node :
+			GafferImageTest.processTiles( node["__horizontalPass"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( node["out"] )
+
+	def __premultiply( self ) :
+
+		premultiply = GafferImage.Premultiply()
+		premultiply["channels"].setValue( "*" )
+		return premultiply
+
+	def __resample( self ) :
+
+		resample = GafferImage.Resample()
+		resample["filter"].setValue( "box" )
+		return resample
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testPremultiplyGroupedChannelsPerf( self ) :
+
+		self.__channelGroupOverheadPerf( self.__premultiply(), grouped = True )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testPremultiplyIndividualChannelsPerf( self ) :
+
+		self.__channelGroupOverheadPerf( self.__premultiply(), grouped = False )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testResampleGroupedChannelsPerf( self ) :
+
+		self.__channelGroupOverheadPerf( self.__resample(), grouped = True )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testResampleIndividualChannelsPerf( self ) :
+
+		self.__channelGroupOverheadPerf( self.__resample(), grouped = False )
+
 if __name__ == "__main__":
 	unittest.main()
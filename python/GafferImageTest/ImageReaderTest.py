@@ -925,5 +925,32 @@ class ImageReaderTest( GafferImageTest.ImageTestCase ) :
 		script2.execute( serialisation )
 		self.assertIsInstance( script2["reader"], GafferImage.ImageReader )
 
+	def testHalfDataIsCached( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1024, 1024 ) )
+		checker["colorA"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+		checker["colorB"].setValue( imath.Color4f( 2, 4, 0.125, 0.5 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( checker["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "half.exr" )
+		writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Tile )
+		writer["openexr"]["dataType"].setValue( "half" )
+		writer["task"].execute()
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( writer["fileName"].getValue() )
+
+		self.assertImagesEqual( reader["out"], checker["out"], ignoreMetadata = True )
+
+		# The tile batches hold the pixels at half precision, but the
+		# converted float tiles must also be cached, so that downstream
+		# nodes don't pay for the conversion on every request.
+		tile1 = reader["out"].channelData( "R", imath.V2i( 0 ), _copy = False )
+		Gaffer.ValuePlug.clearHashCache()
+		tile2 = reader["out"].channelData( "R", imath.V2i( 0 ), _copy = False )
+		self.assertTrue( tile1.isSame( tile2 ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -35,8 +35,10 @@
 ##########################################################################
 
 import imath
+import json
 import os
 import pathlib
+import subprocess
 
 import IECore
 import IECoreImage
@@ -191,6 +193,40 @@ class ImageTestCase( GafferTest.TestCase ) :
 	def deepImage( self ):
 		return self.DeepImage()
 
+	## Runs the performance test method `testName` in a subprocess using a tile size
+	# of `1 << tileSizeLog2`, and records its timings as the timings for the current
+	# test. Because the tile size is fixed for the lifetime of a process, this is
+	# the only way to compare the performance of different tile sizes in a single
+	# test run. Skips the current test if the tile size was fixed at build time.
+	def runWithTileSize( self, testName, tileSizeLog2 ) :
+
+		if not GafferImage.ImagePlug.tileSizeIsConfigurable() :
+			self.skipTest( "Tile size is fixed at build time" )
+
+		env = os.environ.copy()
+		env["GAFFERIMAGE_TILE_SIZE_LOG2"] = str( tileSizeLog2 )
+
+		outputFile = self.temporaryDirectory() / "{}.json".format( testName )
+		try :
+			subprocess.check_output(
+				[
+					str( Gaffer.executablePath() ), "test",
+					"-outputFile", str( outputFile ),
+					"{}.{}.{}".format( self.__class__.__module__, self.__class__.__name__, testName ),
+				],
+				env = env, stderr = subprocess.STDOUT
+			)
+		except subprocess.CalledProcessError as e :
+			self.fail( e.output )
+
+		with open( outputFile, encoding = "utf-8" ) as f :
+			result = next( iter( json.load( f ).values() ) )
+
+		# Stash timings and memory usage so they can be recovered
+		# by `TestRunner`, as for `PerformanceTestMethod`.
+		self.timings = result.get( "timings", [] )
+		self.memoryUsages = result.get( "memoryUsages", [] )
+
 	## Returns an image node with a set of channels that is good for testing read/write
 	def channelTestImage( self ) :
 
@@ -1913,5 +1913,126 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 			['character.Z,', '32-bit'], ['character.ZBack,', '32-bit'], ['character.custom,', '32-bit'], ['character.mask,', '32-bit']
 		] )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testLargePlatePerf( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 8192, 4320 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( checkerboard["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "large.exr" )
+
+		GafferImageTest.processTiles( checkerboard["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testLargePlatePerfWithTileSize64( self ) :
+
+		self.runWithTileSize( "testLargePlatePerf", 6 )
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testLargePlatePerfWithTileSize128( self ) :
+
+		self.runWithTileSize( "testLargePlatePerf", 7 )
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testLargePlatePerfWithTileSize256( self ) :
+
+		self.runWithTileSize( "testLargePlatePerf", 8 )
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testLargePlatePerfWithTileSize512( self ) :
+
+		self.runWithTileSize( "testLargePlatePerf", 9 )
+
+	def testCompressedMultiLayerRoundTrip( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1000, 700 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checkerboard["out"] )
+		for layer in range( 0, 8 ) :
+			for i, channel in enumerate( "RGBA" ) :
+				shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "layer{}.{}".format( layer, channel ), "RGBA"[(i + layer) % 4] ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( shuffle["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 13, 29 ), imath.V2i( 981, 687 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( crop["out"] )
+		writer["openexr"]["dataType"].setValue( "float" )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		for mode in [ GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ] :
+			for compression in [ "none", "zips", "zip", "piz" ] :
+				with self.subTest( mode = mode, compression = compression ) :
+
+					writer["openexr"]["mode"].setValue( mode )
+					writer["openexr"]["compression"].setValue( compression )
+					writer["fileName"].setValue( self.temporaryDirectory() / "{}{}.exr".format( compression, mode ) )
+					writer["task"].execute()
+
+					self.assertImagesEqual( reader["out"], crop["out"], ignoreMetadata = True )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testMultiLayerDWAAPerf( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 4096, 2160 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checkerboard["out"] )
+		for layer in range( 0, 32 ) :
+			for channel in "RGBA" :
+				shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "layer{}.{}".format( layer, channel ), channel ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( shuffle["out"] )
+		writer["openexr"]["compression"].setValue( "dwaa" )
+		writer["fileName"].setValue( self.temporaryDirectory() / "multiLayer.exr" )
+
+		GafferImageTest.processTiles( shuffle["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testMultiLayerDWAAComputeAndWritePerf( self ) :
+
+		# As above, but without precomputing the tiles, so that we
+		# measure the overlap of computing and writing as well.
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 4096, 2160 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checkerboard["out"] )
+		for layer in range( 0, 32 ) :
+			for channel in "RGBA" :
+				shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "layer{}.{}".format( layer, channel ), channel ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( shuffle["out"] )
+		grade["channels"].setValue( "*" )
+		grade["gain"].setValue( imath.Color4f( 0.5 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( grade["out"] )
+		writer["openexr"]["compression"].setValue( "dwaa" )
+		writer["fileName"].setValue( self.temporaryDirectory() / "multiLayer.exr" )
+
+		GafferImageTest.processTiles( checkerboard["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
 if __name__ == "__main__":
 	unittest.main()
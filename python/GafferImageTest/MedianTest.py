@@ -144,6 +144,32 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 			# a master
 			self.assertImagesEqual( masterMedianSingleChannel["out"], defaultMedianSingleChannel["out"] )
 
+	def testDriverChannelMatchesValues( self ) :
+
+		# The driver channel uses a different code path to find the median,
+		# so this checks that they agree for a variety of radii.
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "noisyRamp.exr" )
+
+		median = GafferImage.Median()
+		median["in"].setInput( reader["out"] )
+
+		driverMedian = GafferImage.Median()
+		driverMedian["in"].setInput( reader["out"] )
+		driverMedian["masterChannel"].setValue( "R" )
+
+		for radius in [ imath.V2i( 1 ), imath.V2i( 3, 2 ), imath.V2i( 0, 6 ), imath.V2i( 9, 4 ), imath.V2i( 20 ) ] :
+			for boundingMode in ( GafferImage.Sampler.BoundingMode.Black, GafferImage.Sampler.BoundingMode.Clamp ) :
+				with self.subTest( radius = radius, boundingMode = boundingMode ) :
+					for m in ( median, driverMedian ) :
+						m["radius"].setValue( radius )
+						m["boundingMode"].setValue( boundingMode )
+					self.assertEqual(
+						GafferImage.ImageAlgo.tiles( median["out"] )["R"],
+						GafferImage.ImageAlgo.tiles( driverMedian["out"] )["R"]
+					)
+
 	def testCancellation( self ) :
 
 		script = Gaffer.ScriptNode()
@@ -362,6 +388,40 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 		reverseOffset["offset"].setValue( imath.V2i( 1070, -1360 ) )
 		self.assertImagesEqual( reverseOffset["out"], refReader["out"], ignoreMetadata = True )
 
+	def __testPerf( self, radius ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		median = GafferImage.Median()
+		median["in"].setInput( imageReader["out"] )
+		median["radius"].setValue( imath.V2i( radius ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( median["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius1( self ) :
+
+		self.__testPerf( 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius3( self ) :
+
+		self.__testPerf( 3 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius10( self ) :
+
+		self.__testPerf( 10 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius50( self ) :
+
+		self.__testPerf( 50 )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
 	def testPerf( self ) :
 
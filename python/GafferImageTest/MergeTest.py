@@ -923,6 +923,45 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 		merge["in"][0].setInput( c1["out"] )
 		self.assertImagesEqual( merge["out"], c1["out"] )
 
+	def testManyInputsMatchChainedMerges( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		layers = []
+		for i in range( 0, 8 ) :
+			script["constant%d" % i] = GafferImage.Constant()
+			script["constant%d" % i]["format"].setValue( GafferImage.Format( 300, 200 ) )
+			script["constant%d" % i]["color"].setValue( imath.Color4f( 0.1 * i, 0.05 * ( i + 1 ), 0.5, 0.1 * ( i + 2 ) ) )
+			script["crop%d" % i] = GafferImage.Crop()
+			script["crop%d" % i]["in"].setInput( script["constant%d" % i]["out"] )
+			script["crop%d" % i]["area"].setValue( imath.Box2i( imath.V2i( 17 * i, 9 * i ), imath.V2i( 150 + 19 * i, 130 + 7 * i ) ) )
+			layers.append( script["crop%d" % i]["out"] )
+
+		script["merge"] = GafferImage.Merge()
+		for i, layer in enumerate( layers ) :
+			script["merge"]["in"][i].setInput( layer )
+
+		chained = layers[0]
+		chainedMerges = []
+		for i, layer in enumerate( layers[1:] ) :
+			script["chainedMerge%d" % i] = GafferImage.Merge()
+			script["chainedMerge%d" % i]["in"][0].setInput( chained )
+			script["chainedMerge%d" % i]["in"][1].setInput( layer )
+			chainedMerges.append( script["chainedMerge%d" % i] )
+			chained = script["chainedMerge%d" % i]["out"]
+
+		for operation in [
+			GafferImage.Merge.Operation.Over,
+			GafferImage.Merge.Operation.Add,
+			GafferImage.Merge.Operation.Atop,
+			GafferImage.Merge.Operation.Multiply,
+			GafferImage.Merge.Operation.Under,
+		] :
+			script["merge"]["operation"].setValue( operation )
+			for m in chainedMerges :
+				m["operation"].setValue( operation )
+			self.assertImagesEqual( script["merge"]["out"], chained )
+
 	def mergePerf( self, operation, mismatch ):
 		r = GafferImage.Checkerboard( "Checkerboard" )
 		r["format"].setValue( GafferImage.Format( 4096, 3112, 1.000 ) )
@@ -1115,5 +1154,59 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 	def testMaxMismatchPerf( self ):
 		self.mergePerf( GafferImage.Merge.Operation.Max, True )
 
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testManyInputsPerf( self ):
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1024, 778, 1.000 ) )
+		checkerboard["size"].setValue( imath.V2f( 64.01 ) )
+
+		alphaShuffle = GafferImage.Shuffle()
+		alphaShuffle["in"].setInput( checkerboard["out"] )
+		alphaShuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "A", "R" ) )
+
+		merge = GafferImage.Merge()
+		merge["operation"].setValue( GafferImage.Merge.Operation.Over )
+
+		offsets = []
+		for i in range( 0, 50 ) :
+			offset = GafferImage.Offset()
+			offset["in"].setInput( alphaShuffle["out"] )
+			offset["offset"].setValue( imath.V2i( 3 * i, 5 * i ) )
+			merge["in"][i].setInput( offset["out"] )
+			offsets.append( offset )
+
+		# Precache upstream network, we're only interested in the performance of Merge
+		for offset in offsets :
+			GafferImageTest.processTiles( offset["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( merge["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testOverPerfWithTileSize64( self ) :
+
+		self.runWithTileSize( "testOverPerf", 6 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testOverPerfWithTileSize128( self ) :
+
+		self.runWithTileSize( "testOverPerf", 7 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testOverPerfWithTileSize256( self ) :
+
+		self.runWithTileSize( "testOverPerf", 8 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testOverPerfWithTileSize512( self ) :
+
+		self.runWithTileSize( "testOverPerf", 9 )
+
 if __name__ == "__main__":
 	unittest.main()
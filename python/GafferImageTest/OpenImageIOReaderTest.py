@@ -770,6 +770,80 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		self.assertNotIn( "oiio:subimagename", metadata )
 		self.assertNotIn( "oiio:subimages", metadata )
 
+	def testHalfAndFloatData( self ) :
+
+		# Values chosen to be exactly representable as half.
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 301, 203 ) )
+		checker["colorA"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+		checker["colorB"].setValue( imath.Color4f( 2, 4, 0.125, 0.5 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checker["out"] )
+		shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "Z", "R" ) )
+		shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "extra.R", "B" ) )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( shuffle["out"] )
+		offset["offset"].setValue( imath.V2i( -17, 33 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( offset["out"] )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		for dataType in [ "half", "float" ] :
+			for mode in [ GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ] :
+				with self.subTest( dataType = dataType, mode = mode ) :
+					writer["openexr"]["dataType"].setValue( dataType )
+					writer["openexr"]["mode"].setValue( mode )
+					writer["fileName"].setValue( self.temporaryDirectory() / "{}{}.exr".format( dataType, mode ) )
+					writer["task"].execute()
+
+					self.assertImagesEqual( reader["out"], offset["out"], ignoreMetadata = True )
+
+	def testFlatChannelDataIsCached( self ) :
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setValue( self.fileName )
+
+		# Flat tiles are converted from the tile batch, so the result must be
+		# cached rather than converted again for each request.
+		tile1 = reader["out"].channelData( "R", imath.V2i( 0 ), _copy = False )
+		Gaffer.ValuePlug.clearHashCache()
+		tile2 = reader["out"].channelData( "R", imath.V2i( 0 ), _copy = False )
+		self.assertTrue( tile1.isSame( tile2 ) )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testReadSingleChannelPerformance( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 4096, 2160 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checker["out"] )
+		for layer in range( 0, 16 ) :
+			for channel in "RGBA" :
+				shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "layer{}.{}".format( layer, channel ), channel ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( shuffle["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "manyChannels.exr" )
+		writer["task"].execute()
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		deleteChannels = GafferImage.DeleteChannels()
+		deleteChannels["in"].setInput( reader["out"] )
+		deleteChannels["mode"].setValue( GafferImage.DeleteChannels.Mode.Keep )
+		deleteChannels["channels"].setValue( "R" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( deleteChannels["out"] )
+
 	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testImageOpenPerformance( self ):
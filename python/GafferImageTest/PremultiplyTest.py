@@ -116,3 +116,29 @@ class PremultiplyTest( GafferImageTest.ImageTestCase ) :
 						self.assertEqual( result, color[channelName] )
 					else:
 						self.assertEqual( result, color[channelName] * color[alphaChannelName] )
+
+	def testChannelGroups( self ) :
+
+		i = GafferImage.ImageReader()
+		i["fileName"].setValue( self.checkerFile )
+
+		# Copy RGB into channels which will be premultiplied individually,
+		# rather than as a group.
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( i["out"] )
+		for c in "RGB" :
+			shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "custom" + c, c ) )
+
+		premult = GafferImage.Premultiply()
+		premult["in"].setInput( shuffle["out"] )
+		premult["channels"].setValue( "*" )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			tiles = GafferImage.ImageAlgo.tiles( premult["out"] )
+		self.assertGreater( monitor.plugStatistics( premult["__channelGroup"] ).computeCount, 0 )
+
+		for c in "RGB" :
+			self.assertEqual( tiles[c], tiles["custom" + c] )
+
+		# Alpha is passed through.
+		self.assertEqual( premult["out"].channelDataHash( "A", imath.V2i( 0 ) ), shuffle["out"].channelDataHash( "A", imath.V2i( 0 ) ) )
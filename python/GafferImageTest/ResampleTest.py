@@ -175,6 +175,63 @@ class ResampleTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( resampleFastPath["out"], resampleReference["out"] )
 
+	def testSeparableMatchesSinglePass( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "resamplePatterns.exr" )
+
+		# Offset the data window so that it isn't aligned to tile boundaries,
+		# to exercise the edges of the input buffers used by the separable passes.
+		offset = GafferImage.Offset()
+		offset["in"].setInput( reader["out"] )
+		offset["offset"].setValue( imath.V2i( -23, 41 ) )
+
+		resample = GafferImage.Resample()
+		resample["in"].setInput( offset["out"] )
+
+		reference = GafferImage.Resample()
+		reference["in"].setInput( offset["out"] )
+		reference["matrix"].setInput( resample["matrix"] )
+		reference["filter"].setInput( resample["filter"] )
+		reference["filterScale"].setInput( resample["filterScale"] )
+		reference["boundingMode"].setInput( resample["boundingMode"] )
+		reference["debug"].setValue( GafferImage.Resample.Debug.SinglePass )
+
+		for filter in [ "box", "lanczos3", "mitchell", "gaussian" ] :
+			for scale in [ imath.V2f( 0.3, 0.7 ), imath.V2f( 1 ), imath.V2f( 2.5, 1.3 ) ] :
+				for boundingMode in [ GafferImage.Sampler.BoundingMode.Black, GafferImage.Sampler.BoundingMode.Clamp ] :
+					with self.subTest( filter = filter, scale = scale, boundingMode = boundingMode ) :
+						resample["filter"].setValue( filter )
+						resample["matrix"].setValue( imath.M33f().scale( scale ) )
+						resample["boundingMode"].setValue( boundingMode )
+						self.assertImagesEqual( resample["out"], reference["out"], maxDifference = 0.0001 )
+
+	def testChannelGroups( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "resamplePatterns.exr" )
+
+		# Copy RGB into channels which will be resampled individually,
+		# rather than as a group.
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( reader["out"] )
+		for c in "RGB" :
+			shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "custom" + c, c ) )
+
+		resample = GafferImage.Resample()
+		resample["in"].setInput( shuffle["out"] )
+
+		for filter in [ "box", "lanczos3", "radial-lanczos3" ] :
+			for scale in [ imath.V2f( 0.3, 0.7 ), imath.V2f( 1 ) ] :
+				with self.subTest( filter = filter, scale = scale ) :
+					resample["filter"].setValue( filter )
+					resample["matrix"].setValue( imath.M33f().scale( scale ) )
+					with Gaffer.PerformanceMonitor() as monitor :
+						tiles = GafferImage.ImageAlgo.tiles( resample["out"] )
+					self.assertGreater( monitor.plugStatistics( resample["__channelGroup"] ).computeCount, 0 )
+					for c in "RGB" :
+						self.assertEqual( tiles[c], tiles["custom" + c] )
+
 	def testSincUpsize( self ) :
 
 		c = GafferImage.Constant()
@@ -324,6 +381,46 @@ class ResampleTest( GafferImageTest.ImageTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( resample["out"] )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testPerfResizeTo4K( self ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( imageReader["out"] )
+		resize["format"].setValue( GafferImage.Format( 1920, 1080, 1.000 ) )
+
+		upsize = GafferImage.Resize()
+		upsize["in"].setInput( resize["out"] )
+		upsize["format"].setValue( GafferImage.Format( 4096, 2160, 1.000 ) )
+		upsize["filter"].setValue( "lanczos3" )
+
+		GafferImageTest.processTiles( resize["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( upsize["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testPerfResizeFrom4K( self ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		resize = GafferImage.Resize()
+		resize["in"].setInput( imageReader["out"] )
+		resize["format"].setValue( GafferImage.Format( 4096, 2160, 1.000 ) )
+
+		downsize = GafferImage.Resize()
+		downsize["in"].setInput( resize["out"] )
+		downsize["format"].setValue( GafferImage.Format( 1920, 1080, 1.000 ) )
+		downsize["filter"].setValue( "lanczos3" )
+
+		GafferImageTest.processTiles( resize["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( downsize["out"] )
+
 	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
 	def testPerfInseparableLanczos( self ) :
 
@@ -336,5 +336,25 @@ class ResizeTest( GafferImageTest.ImageTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( r["out"] )
 
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testSimpleUpscalePerfWithTileSize64( self ) :
+
+		self.runWithTileSize( "testSimpleUpscalePerf", 6 )
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testSimpleUpscalePerfWithTileSize128( self ) :
+
+		self.runWithTileSize( "testSimpleUpscalePerf", 7 )
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testSimpleUpscalePerfWithTileSize256( self ) :
+
+		self.runWithTileSize( "testSimpleUpscalePerf", 8 )
+
+	@GafferTest.TestRunner.CategorisedTestMethod( { "performance" } )
+	def testSimpleUpscalePerfWithTileSize512( self ) :
+
+		self.runWithTileSize( "testSimpleUpscalePerf", 9 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -42,6 +42,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 
@@ -82,3 +83,114 @@ class SaturationTest( GafferImageTest.ImageTestCase ) :
 		sat["saturation"].setValue( 2 )
 		ref["color"].setValue( imath.Color4f( 0.67874, 0.47874, 0.47874, 1 ) )
 		self.assertImagesEqual( sat["out"], ref["out"], maxDifference = 1e-7 )
+
+	def testChannelGroupComputedOncePerTile( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 1 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checker["out"] )
+		for outChannel, inChannel in [ ( "R", "G" ), ( "G", "B" ), ( "B", "R" ) ] :
+			shuffle["channels"].addChild( GafferImage.Shuffle.ChannelPlug( "diffuse." + outChannel, inChannel ) )
+
+		sat = GafferImage.Saturation()
+		sat["in"].setInput( shuffle["out"] )
+		sat["channels"].setValue( "[RGB] diffuse.[RGB]" )
+		sat["saturation"].setValue( 0.5 )
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as pm :
+			GafferImage.ImageAlgo.tiles( sat["out"] )
+
+		# R, G and B are computed together, once per tile for each layer.
+		numTiles = len( GafferImage.ImageAlgo.tiles( sat["out"] )["tileOrigins"] )
+		self.assertEqual( pm.plugStatistics( sat["__channelGroup"] ).computeCount, numTiles * 2 )
+
+		# And we get the same result as processing each layer separately.
+
+		satMain = GafferImage.Saturation()
+		satMain["in"].setInput( shuffle["out"] )
+		satMain["saturation"].setValue( 0.5 )
+
+		satDiffuse = GafferImage.Saturation()
+		satDiffuse["in"].setInput( satMain["out"] )
+		satDiffuse["channels"].setValue( "diffuse.[RGB]" )
+		satDiffuse["saturation"].setValue( 0.5 )
+
+		self.assertImagesEqual( sat["out"], satDiffuse["out"] )
+
+	def testFusedChain( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 0.5 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.9, 0.4, 0.2, 0 ) )
+
+		deleteBlue = GafferImage.DeleteChannels()
+		deleteBlue["in"].setInput( checker["out"] )
+		deleteBlue["channels"].setValue( "B" )
+
+		chain = []
+		for saturation, channels, processUnpremultiplied, enabled in [
+			( 0.5, "[RGB]", False, True ),
+			( 2.0, "[RGB]", True, True ),
+			( 0.0, "R", False, True ),
+			( 0.2, "[RGB]", False, False ),
+			( 1.5, "[RGB]", True, True ),
+		] :
+			s = GafferImage.Saturation()
+			s["in"].setInput( chain[-1]["out"] if chain else deleteBlue["out"] )
+			s["saturation"].setValue( saturation )
+			s["channels"].setValue( channels )
+			s["processUnpremultiplied"].setValue( processUnpremultiplied )
+			s["enabled"].setValue( enabled )
+			chain.append( s )
+
+		# The upstream nodes are fused into the computation for the last
+		# node, so they don't compute intermediate results.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as pm :
+			fusedTiles = GafferImage.ImageAlgo.tiles( chain[-1]["out"] )
+
+		for s in chain[:-1] :
+			self.assertEqual( pm.plugStatistics( s["__channelGroup"] ).computeCount, 0 )
+
+		# Connecting other readers to the intermediate images prevents
+		# fusion, but must give identical results.
+
+		readers = []
+		for s in chain[:-1] :
+			readers.append( GafferImage.Offset() )
+			readers[-1]["in"].setInput( s["out"] )
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as pm :
+			unfusedTiles = GafferImage.ImageAlgo.tiles( chain[-1]["out"] )
+
+		self.assertGreater( pm.plugStatistics( chain[0]["__channelGroup"] ).computeCount, 0 )
+		self.assertEqual( fusedTiles, unfusedTiles )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testFusedChainPerformance( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 4096, 2160 ) )
+
+		GafferImageTest.processTiles( checker["out"] )
+
+		image = checker["out"]
+		nodes = []
+		for i in range( 0, 6 ) :
+			if i % 2 :
+				node = GafferImage.CDL()
+				node["slope"].setValue( imath.Color3f( 1.1, 0.9, 1.0 ) )
+			else :
+				node = GafferImage.Saturation()
+				node["saturation"].setValue( 0.9 )
+			node["in"].setInput( image )
+			image = node["out"]
+			nodes.append( node )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( image )
@@ -91,7 +91,28 @@ Gaffer.Metadata.registerNode(
 			which the blur will bleed onto.
 			"""
 
-		]
+		],
+
+		"method" : [
+
+			"description",
+			"""
+			The algorithm used to compute the blur.
+
+			- Filter : Applies the gaussian filter directly. The cost
+			  of this increases with the radius.
+			- Recursive : Approximates the gaussian filter using a
+			  recursive filter, whose cost is independent of the radius.
+			  This is much faster for large radii, at the expense of
+			  small differences in the result.
+			""",
+
+			"preset:Filter", GafferImage.Blur.Method.Filter,
+			"preset:Recursive", GafferImage.Blur.Method.Recursive,
+
+			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
+
+		],
 
 	}
 
@@ -169,6 +169,24 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"mipMapping" : [
+
+			"description",
+			"""
+			Displays the image using reduced resolution mip levels when
+			zoomed out, so that only as many pixels are computed as can
+			be seen. This is faster for large images, but the pixels
+			displayed are only approximate, because many nodes process
+			the reduced resolution image rather than filtering their
+			full resolution output.
+			""",
+
+			"plugValueWidget:type", "GafferUI.BoolPlugValueWidget",
+			"toolbarLayout:section", "Bottom",
+			"label", "Proxy",
+
+		],
+
 		"colorInspector" : [
 			"plugValueWidget:type", "GafferUI.LayoutPlugValueWidget",
 			"toolbarLayout:section", "Bottom",
@@ -103,6 +103,46 @@ Gaffer.Metadata.registerNode(
 
 	plugs = {
 
+		"bake" : [
+
+			"description",
+			"""
+			Bakes the transform into a 3D LUT, which can be much quicker to apply
+			than the exact transform. A logarithmic shaper is applied before the
+			LUT, and values outside its range (including negative values) are
+			processed exactly. If the error of the LUT exceeds the `bakeTolerance`,
+			the exact transform is used instead.
+			""",
+
+			"layout:section", "Bake",
+
+		],
+
+		"bakeTolerance" : [
+
+			"description",
+			"""
+			The maximum error allowed for the baked LUT. This is measured as an
+			absolute error for values up to 1 and a relative error above that.
+			""",
+
+			"layout:section", "Bake",
+
+		],
+
+		"bakeError" : [
+
+			"description",
+			"""
+			Outputs the maximum error measured between the baked LUT and the exact
+			transform. This is zero if `bake` is off.
+			""",
+
+			"layout:section", "Bake",
+			"layout:activator", lambda plug : plug.node()["bake"].getValue(),
+
+		],
+
 		"context" : [
 
 			"description",
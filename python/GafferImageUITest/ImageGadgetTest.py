@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import math
 import unittest
 import imath
 
@@ -80,6 +81,100 @@ class ImageGadgetTest( GafferUITest.TestCase ) :
 		g.setImage( c["out"] )
 		self.assertTrue( g.getImage().isSame( c["out"] ) )
 
+	def testMipMapping( self ) :
+
+		g = GafferImageUI.ImageGadget()
+		self.assertFalse( g.getMipMapping() )
+
+		g.setMipMapping( True )
+		self.assertTrue( g.getMipMapping() )
+
+		# Mip mapping gives approximate results, so the ImageView
+		# only uses it on request.
+
+		view = GafferImageUI.ImageView()
+		self.assertFalse( view["mipMapping"].getValue() )
+		self.assertFalse( view.imageGadget().getMipMapping() )
+
+		view["mipMapping"].setValue( True )
+		self.assertTrue( view.imageGadget().getMipMapping() )
+
+	def testMipLevelSelection( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 2048, 2048 ) )
+
+		# Grade supports mip levels natively, so its output is only
+		# evaluated at the levels requested by the gadget.
+		grade = GafferImage.Grade()
+		grade["in"].setInput( checker["out"] )
+
+		dataWindow = grade["out"].dataWindow()
+		tileSize = GafferImage.ImagePlug.tileSize()
+
+		def numTiles( mipLevel ) :
+
+			window = GafferImage.ImageAlgo.mipLevelWindow( dataWindow, mipLevel )
+			minOrigin = GafferImage.ImagePlug.tileOrigin( window.min() )
+			maxOrigin = GafferImage.ImagePlug.tileOrigin( window.max() - imath.V2i( 1 ) )
+			return ( ( maxOrigin.x - minOrigin.x ) // tileSize + 1 ) * ( ( maxOrigin.y - minOrigin.y ) // tileSize + 1 )
+
+		def waitForCompletion( gadget ) :
+
+			while gadget.state() != gadget.State.Complete :
+				self.waitForIdle( 100 )
+
+		for mipMapping in ( False, True ) :
+
+			gadget = GafferImageUI.ImageGadget()
+			gadget.setImage( grade["out"] )
+			gadget.setMipMapping( mipMapping )
+
+			with GafferUI.Window() as window :
+				gadgetWidget = GafferUI.GadgetWidget( gadget )
+
+			window._qtWidget().resize( 256, 256 )
+			window.setVisible( True )
+
+			viewport = gadgetWidget.getViewportGadget()
+			preRenderSlot = GafferTest.CapturingSlot( viewport.preRenderSignal() )
+			while not len( preRenderSlot ) :
+				self.waitForIdle( 1 )
+
+			viewport.frame( gadget.bound() )
+			waitForCompletion( gadget )
+
+			# Dirty the image, and monitor the contexts it is recomputed in.
+
+			monitor = Gaffer.ContextMonitor( grade )
+			with monitor :
+				grade["multiply"]["r"].setValue( grade["multiply"]["r"].getValue() + 1 )
+				self.assertEqual( gadget.state(), gadget.State.Running )
+				waitForCompletion( gadget )
+
+			statistics = monitor.plugStatistics( grade["out"]["channelData"] )
+			if not mipMapping :
+				self.assertNotIn( "image:mipLevel", statistics.variableNames() )
+				self.assertEqual( statistics.numUniqueContexts(), numTiles( 0 ) * 4 )
+			else :
+				# Expect the coarsest level with at least one pixel per
+				# screen pixel, preceded by a placeholder two levels coarser.
+				rasterPixelsPerPixel = abs(
+					viewport.gadgetToRasterSpace( imath.V3f( 0, 1, 0 ), gadget ).y -
+					viewport.gadgetToRasterSpace( imath.V3f( 0 ), gadget ).y
+				)
+				mipLevel = max( 0, min( 8, int( math.floor( math.log2( 1 / rasterPixelsPerPixel ) ) ) ) )
+				self.assertGreater( mipLevel, 0 )
+
+				self.assertEqual( statistics.numUniqueValues( "image:mipLevel" ), 2 )
+				self.assertEqual(
+					statistics.numUniqueContexts(),
+					( numTiles( mipLevel ) + numTiles( mipLevel + 2 ) ) * 4
+				)
+
+			window.setVisible( False )
+			del gadget, gadgetWidget, window
+
 	def testDestroyWhileProcessing( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -34,6 +34,8 @@
 #
 ##########################################################################
 
+import inspect
+import subprocess
 import unittest
 import threading
 import weakref
@@ -794,6 +796,42 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testContextHashValidation()
 
+	def testHashIsIndependentOfProcess( self ) :
+
+		# Hashes may be used as keys for the persistent cache, which is shared
+		# between processes, so they mustn't depend on anything specific to
+		# one process, such as the addresses of the variable names.
+
+		output = subprocess.check_output(
+			[
+				str( Gaffer.executablePath() ), "env", "python", "-c",
+				inspect.cleandoc(
+					"""
+					import imath
+					import IECore
+					import Gaffer
+
+					# Intern some unrelated strings first, so that the variable names
+					# are unlikely to have the same addresses as in the test process.
+					IECore.InternedStringVectorData( [ "unrelated{}".format( i ) for i in range( 0, 1000 ) ] )
+
+					c = Gaffer.Context()
+					c["frame"] = 10.0
+					c["image:tileOrigin"] = imath.V2i( 64, 128 )
+					c["testHashIsIndependentOfProcess"] = "a"
+					print( c.hash() )
+					"""
+				)
+			],
+			universal_newlines = True
+		)
+
+		c = Gaffer.Context()
+		c["frame"] = 10.0
+		c["image:tileOrigin"] = imath.V2i( 64, 128 )
+		c["testHashIsIndependentOfProcess"] = "a"
+		self.assertEqual( output.strip(), str( c.hash() ) )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testContextHashPerformance( self ) :
 
@@ -809,6 +847,71 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testContextCopyPerformance( 10, 10 )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContextLookupPerformance( self ) :
+
+		GafferTest.testContextLookupPerformance( 10, "image:tileOrigin" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContextLookupPerformanceWithoutSlot( self ) :
+
+		GafferTest.testContextLookupPerformance( 10, "user:tileOrigin" )
+
+	def testWellKnownVariables( self ) :
+
+		# These variables are stored separately from others, for faster
+		# access. But that should be completely transparent to the user.
+
+		c = Gaffer.Context()
+		h = c.hash()
+
+		c["scene:path"] = IECore.InternedStringVectorData( [ "a", "b" ] )
+		c["image:tileOrigin"] = imath.V2i( 64 )
+		c["image:channelName"] = "R"
+		c["image:viewName"] = "left"
+		c["a"] = 10
+
+		self.assertEqual(
+			set( c.names() ),
+			{ "frame", "framesPerSecond", "scene:path", "image:tileOrigin", "image:channelName", "image:viewName", "a" }
+		)
+		self.assertEqual( c["scene:path"], IECore.InternedStringVectorData( [ "a", "b" ] ) )
+		self.assertEqual( c["image:tileOrigin"], imath.V2i( 64 ) )
+		self.assertEqual( c["image:channelName"], "R" )
+		self.assertEqual( c["image:viewName"], "left" )
+		self.assertNotEqual( c.hash(), h )
+
+		# Copies are equal, and have equal hashes.
+
+		cc = Gaffer.Context( c )
+		self.assertEqual( cc, c )
+		self.assertEqual( cc.hash(), c.hash() )
+		self.assertEqual( set( cc.names() ), set( c.names() ) )
+
+		cc["image:channelName"] = "G"
+		self.assertNotEqual( cc, c )
+		self.assertNotEqual( cc.hash(), c.hash() )
+
+		# Hash doesn't depend on the order variables are set in.
+
+		c2 = Gaffer.Context()
+		c2["a"] = 10
+		c2["image:viewName"] = "left"
+		c2["image:channelName"] = "R"
+		c2["image:tileOrigin"] = imath.V2i( 64 )
+		c2["scene:path"] = IECore.InternedStringVectorData( [ "a", "b" ] )
+		self.assertEqual( c2, c )
+		self.assertEqual( c2.hash(), c.hash() )
+
+		# Removal returns us to the original hash.
+
+		del c["scene:path"]
+		self.assertNotIn( "scene:path", c )
+		c.removeMatching( "image:* a" )
+		self.assertEqual( set( c.names() ), { "frame", "framesPerSecond" } )
+		self.assertEqual( c, Gaffer.Context() )
+		self.assertEqual( c.hash(), h )
+
 	def testCopyEditableScope( self ) :
 
 		GafferTest.testCopyEditableScope()
@@ -0,0 +1,152 @@
+##########################################################################
+#
+#  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import sys
+import unittest
+
+import Gaffer
+import GafferTest
+
+class MemoryGovernorTest( GafferTest.TestCase ) :
+
+	def setUp( self ) :
+
+		GafferTest.TestCase.setUp( self )
+
+		computeLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.addCleanup( Gaffer.ValuePlug.setCacheMemoryLimit, computeLimit )
+		hashLimit = Gaffer.ValuePlug.getHashCacheSizeLimit()
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheSizeLimit, hashLimit )
+
+		thresholds = Gaffer.MemoryGovernor.getPressureThresholds()
+		self.addCleanup( Gaffer.MemoryGovernor.setPressureThresholds, *thresholds )
+		self.addCleanup( Gaffer.MemoryGovernor.setMinimumScale, Gaffer.MemoryGovernor.getMinimumScale() )
+		self.addCleanup( Gaffer.MemoryGovernor.setGrowthRate, Gaffer.MemoryGovernor.getGrowthRate() )
+		self.addCleanup( Gaffer.MemoryGovernor.setUpdateInterval, Gaffer.MemoryGovernor.getUpdateInterval() )
+
+		# Stop the background thread from interfering with the
+		# updates we make explicitly.
+		Gaffer.MemoryGovernor.setUpdateInterval( 10000 )
+
+	@unittest.skipIf( not sys.platform.startswith( "linux" ), "Memory statistics only available on Linux" )
+	def testMemoryStatistics( self ) :
+
+		s = Gaffer.MemoryGovernor.memoryStatistics()
+		self.assertGreater( s.limit, 0 )
+		self.assertGreater( s.used, 0 )
+		self.assertLessEqual( s.used, s.limit )
+
+	def testRegisteredCaches( self ) :
+
+		self.assertIn( "ValuePlug:computeCache", Gaffer.MemoryGovernor.registeredCaches() )
+		self.assertIn( "ValuePlug:hashCache", Gaffer.MemoryGovernor.registeredCaches() )
+		self.assertIn( "ValuePlug:compressedCache", Gaffer.MemoryGovernor.registeredCaches() )
+
+		with self.assertRaisesRegex( Exception, 'Cache "notACache" is not registered' ) :
+			Gaffer.MemoryGovernor.getMaximumLimit( "notACache" )
+
+	def testUpdate( self ) :
+
+		Gaffer.MemoryGovernor.setPressureThresholds( 0.5, 0.9 )
+		Gaffer.MemoryGovernor.setMinimumScale( 0.1 )
+		Gaffer.MemoryGovernor.setGrowthRate( 0.1 )
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 1000000 )
+		Gaffer.ValuePlug.setHashCacheSizeLimit( 1000 )
+
+		Gaffer.MemoryGovernor.setEnabled( True )
+		self.addCleanup( Gaffer.MemoryGovernor.setEnabled, False )
+		self.assertTrue( Gaffer.MemoryGovernor.getEnabled() )
+
+		def assertLimits( computeLimit, hashLimit ) :
+
+			self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), computeLimit )
+			self.assertEqual( Gaffer.ValuePlug.getHashCacheSizeLimit(), hashLimit )
+
+		# No pressure, so caches are unchanged.
+
+		self.assertEqual( Gaffer.MemoryGovernor.update( Gaffer.MemoryGovernor.MemoryStatistics( used = 10, limit = 100 ) ), 1 )
+		assertLimits( 1000000, 1000 )
+
+		# High pressure, so caches shrink immediately to the minimum.
+
+		self.assertAlmostEqual( Gaffer.MemoryGovernor.update( Gaffer.MemoryGovernor.MemoryStatistics( used = 95, limit = 100 ) ), 0.1, places = 5 )
+		assertLimits( 100000, 100 )
+
+		# Moderate pressure. Caches could grow to 0.55, but growth is
+		# limited per update.
+
+		self.assertAlmostEqual( Gaffer.MemoryGovernor.update( Gaffer.MemoryGovernor.MemoryStatistics( used = 70, limit = 100 ) ), 0.2, places = 5 )
+		assertLimits( 200000, 200 )
+
+		# Relief. Caches grow back to their original size.
+
+		for i in range( 0, 20 ) :
+			Gaffer.MemoryGovernor.update( Gaffer.MemoryGovernor.MemoryStatistics( used = 0, limit = 100 ) )
+
+		self.assertEqual( Gaffer.MemoryGovernor.getScale(), 1 )
+		assertLimits( 1000000, 1000 )
+
+		# Disabling restores the original limits.
+
+		Gaffer.MemoryGovernor.update( Gaffer.MemoryGovernor.MemoryStatistics( used = 100, limit = 100 ) )
+		assertLimits( 100000, 100 )
+
+		Gaffer.MemoryGovernor.setEnabled( False )
+		self.assertFalse( Gaffer.MemoryGovernor.getEnabled() )
+		assertLimits( 1000000, 1000 )
+
+		# And updates have no effect when disabled.
+
+		Gaffer.MemoryGovernor.update( Gaffer.MemoryGovernor.MemoryStatistics( used = 100, limit = 100 ) )
+		assertLimits( 1000000, 1000 )
+
+	def testMaximumLimitFraction( self ) :
+
+		Gaffer.MemoryGovernor.setMaximumLimitFraction( "ValuePlug:computeCache", 0.25 )
+		self.addCleanup( Gaffer.MemoryGovernor.setMaximumLimitFraction, "ValuePlug:computeCache", 0 )
+
+		Gaffer.MemoryGovernor.setEnabled( True )
+		self.addCleanup( Gaffer.MemoryGovernor.setEnabled, False )
+
+		Gaffer.MemoryGovernor.update( Gaffer.MemoryGovernor.MemoryStatistics( used = 0, limit = 1000000 ) )
+		self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), 250000 )
+
+		with self.assertRaisesRegex( Exception, "Invalid fraction" ) :
+			Gaffer.MemoryGovernor.setMaximumLimitFraction( "ValuePlug:computeCache", 2 )
+
+if __name__ == "__main__":
+	unittest.main()
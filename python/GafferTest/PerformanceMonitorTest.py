@@ -135,6 +135,29 @@ class PerformanceMonitorTest( GafferTest.TestCase ) :
 		self.assertEqual( s.hashDuration, 200 )
 		self.assertEqual( s.computeDuration, 300 )
 
+	def testCollaborationStatisticsConstructorAndAccessors( self ) :
+
+		s = Gaffer.PerformanceMonitor.Statistics(
+			collaborationCount = 1,
+			cycleFallbackCount = 2,
+			waitCount = 3,
+			waitDuration = 400,
+			stolenCount = 5
+		)
+
+		self.assertEqual( s.collaborationCount, 1 )
+		self.assertEqual( s.cycleFallbackCount, 2 )
+		self.assertEqual( s.waitCount, 3 )
+		self.assertEqual( s.waitDuration, 400 )
+		self.assertEqual( s.stolenCount, 5 )
+		self.assertEqual( eval( repr( s ) ), s )
+		self.assertNotEqual( s, Gaffer.PerformanceMonitor.Statistics() )
+
+		s.waitCount = 4
+		s.waitDuration = 500
+		self.assertEqual( s.waitCount, 4 )
+		self.assertEqual( s.waitDuration, 500 )
+
 	def testEnterReturnValue( self ) :
 
 		m = Gaffer.PerformanceMonitor()
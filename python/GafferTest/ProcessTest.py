@@ -77,6 +77,12 @@ class ProcessTest( GafferTest.TestCase ) :
 			)
 
 		self.assertEqual( monitor.plugStatistics( plug ).computeCount, 1 + n + 1 )
+		# Only the root process is not collaborative, and `n+1` is only launched
+		# once, with all other requests for it either waiting on it or finding
+		# the result in the cache.
+		self.assertEqual( monitor.plugStatistics( plug ).collaborationCount, n + 1 )
+		self.assertEqual( monitor.plugStatistics( plug ).cycleFallbackCount, 0 )
+		self.assertLess( monitor.plugStatistics( plug ).waitCount, n )
 
 	@GafferTest.TestRunner.CategorisedTestMethod( { "taskCollaboration" } )
 	def testCollaborationFromNonCollaborativeProcesses( self ) :
@@ -119,6 +125,12 @@ class ProcessTest( GafferTest.TestCase ) :
 			GafferTest.runTestProcess( plug, 1, { 10 : { 10 : { 10 : {} } } } )
 
 		self.assertEqual( monitor.plugStatistics( plug ).computeCount, 4 )
+		# Each nested `10` rejects collaboration with the processes
+		# downstream of it, and falls back to running redundantly.
+		self.assertEqual( monitor.plugStatistics( plug ).collaborationCount, 3 )
+		self.assertEqual( monitor.plugStatistics( plug ).cycleFallbackCount, 2 )
+		self.assertEqual( monitor.plugStatistics( plug ).waitCount, 0 )
+		self.assertEqual( monitor.plugStatistics( plug ).waitDuration, 0 )
 
 	@GafferTest.TestRunner.CategorisedTestMethod( { "taskCollaboration" } )
 	def testNoCollaborationOnIndirectRecursion( self ) :
@@ -106,19 +106,24 @@ class TestRunner( unittest.TextTestRunner ) :
 			def wrapper( *args, **kw ) :
 
 				timings = []
+				memoryUsages = []
 				for i in range( 0, self.__repeat ) :
 					Gaffer.ValuePlug.clearCache() # Put each iteration on an equal footing
 					Gaffer.ValuePlug.clearHashCache()
 					TestRunner.PerformanceScope._total = None
+					TestRunner.PerformanceScope._memoryUsage = None
 					t = time.time()
 					result = method( *args, **kw )
 					totalTime = time.time() - t
 					scopedTime = TestRunner.PerformanceScope._total
 					timings.append( scopedTime if scopedTime is not None else totalTime )
+					if TestRunner.PerformanceScope._memoryUsage is not None :
+						memoryUsages.append( TestRunner.PerformanceScope._memoryUsage )
 
-				# Stash timings so they can be recovered
+				# Stash timings and memory usage so they can be recovered
 				# by TestRunner.__Result.
 				args[0].timings = timings
+				args[0].memoryUsages = memoryUsages
 
 				# If previous timings are available, then
 				# compare against them and throw if a regression
@@ -137,6 +142,7 @@ class TestRunner( unittest.TextTestRunner ) :
 
 		# Protected to allow access by PerformanceTestMethod.
 		_total = None
+		_memoryUsage = None
 		__numIterations = None
 
 		def __enter__( self ) :
@@ -149,6 +155,12 @@ class TestRunner( unittest.TextTestRunner ) :
 
 			self.__numIterations = iterations
 
+		# Records the memory used by the critical section, in bytes,
+		# for tests where memory is also of interest.
+		def setMemoryUsage( self, bytes ) :
+
+			TestRunner.PerformanceScope._memoryUsage = bytes
+
 		def __exit__( self, type, value, traceBack ) :
 
 			t = time.time() - self.__startTime
@@ -271,6 +283,9 @@ class TestRunner( unittest.TextTestRunner ) :
 				if self.showAll :
 					self.stream.write( "    Times : " + ", ".join( f"{t:.3g}s" for t in timings ) + "\n" )
 					self.stream.write( "    Best  : " + "{:.3g}s".format( min( timings ) ) + "\n" )
+					memoryUsages = getattr( test, "memoryUsages", None )
+					if memoryUsages :
+						self.stream.write( "    Memory : " + "{:.3g}M".format( max( memoryUsages ) / ( 1024 * 1024 ) ) + "\n" )
 				if test.previousTimings :
 					new = min( timings )
 					old = min( test.previousTimings )
@@ -310,4 +325,8 @@ class TestRunner( unittest.TextTestRunner ) :
 			if timings :
 				d["timings"] = timings
 
+			memoryUsages = getattr( test, "memoryUsages", None )
+			if memoryUsages :
+				d["memoryUsages"] = memoryUsages
+
 			self.__results[str(test)] = d
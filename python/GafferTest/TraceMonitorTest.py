@@ -0,0 +1,195 @@
+##########################################################################
+#
+#  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import json
+import os
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferTest
+
+class TraceMonitorTest( GafferTest.TestCase ) :
+
+	def __readTrace( self, monitor ) :
+
+		fileName = os.path.join( self.temporaryDirectory(), "trace.json" )
+		monitor.writeChromeTrace( fileName )
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		return [ e for e in trace["traceEvents"] if e["ph"] == "X" ]
+
+	def testConstruction( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		self.assertEqual( monitor.numEvents(), 0 )
+		self.assertEqual( self.__readTrace( monitor ), [] )
+
+	def testMonitoring( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["random"] = Gaffer.Random()
+
+		monitor = Gaffer.TraceMonitor()
+		with monitor, script.context() :
+			script["random"]["outFloat"].getValue()
+
+		events = self.__readTrace( monitor )
+		self.assertEqual( len( events ), monitor.numEvents() )
+		self.assertEqual(
+			{ e["cat"] for e in events },
+			{ "computeNode:hash", "computeNode:compute" }
+		)
+
+		compute = next( e for e in events if e["cat"] == "computeNode:compute" )
+		self.assertEqual( compute["name"], "random.outFloat" )
+		self.assertEqual( compute["tid"], Gaffer.ThreadMonitor.thisThreadId() )
+		self.assertEqual( compute["args"]["contextHash"], str( script.context().hash() ) )
+		self.assertGreaterEqual( compute["dur"], 0 )
+
+		monitor.clear()
+		self.assertEqual( monitor.numEvents(), 0 )
+
+	def testProcessMask( self ) :
+
+		random = Gaffer.Random()
+		monitor = Gaffer.TraceMonitor( processMask = { "computeNode:compute" } )
+		performanceMonitor = Gaffer.PerformanceMonitor()
+		context = Gaffer.Context()
+
+		with monitor, performanceMonitor, context :
+			for i in range( 0, 5 ) :
+				context["i"] = i # Unique context to force hashing
+				random["outFloat"].getValue()
+
+		self.assertEqual( performanceMonitor.plugStatistics( random["outFloat"] ).hashCount, 5 )
+		self.assertEqual( monitor.numEvents(), 1 )
+		self.assertEqual( self.__readTrace( monitor )[0]["cat"], "computeNode:compute" )
+
+	def testEventsPerThread( self ) :
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "test" )
+
+		monitor = Gaffer.TraceMonitor( processMask = { "computeNode:compute" }, eventsPerThread = 10 )
+		with monitor :
+			GafferTest.parallelGetValue( random["outFloat"], 100000, "test" )
+
+		events = self.__readTrace( monitor )
+		self.assertEqual( len( events ), monitor.numEvents() )
+		threads = { e["tid"] for e in events }
+		self.assertLessEqual( len( events ), 10 * len( threads ) )
+		for thread in threads :
+			threadEvents = [ e for e in events if e["tid"] == thread ]
+			self.assertLessEqual( len( threadEvents ), 10 )
+			# The oldest events are discarded, and the rest
+			# are written in chronological order.
+			self.assertEqual( threadEvents, sorted( threadEvents, key = lambda e : e["ts"] ) )
+
+	def testNesting( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["add1"] = GafferTest.AddNode()
+		script["add2"] = GafferTest.AddNode()
+		script["add2"]["op1"].setInput( script["add1"]["sum"] )
+
+		monitor = Gaffer.TraceMonitor( processMask = { "computeNode:compute" } )
+		with monitor :
+			script["add2"]["sum"].getValue()
+
+		events = { e["name"] : e for e in self.__readTrace( monitor ) }
+		self.assertEqual( set( events.keys() ), { "add1.sum", "add2.sum" } )
+
+		outer = events["add2.sum"]
+		inner = events["add1.sum"]
+		self.assertGreaterEqual( inner["ts"], outer["ts"] )
+		self.assertLessEqual( inner["ts"] + inner["dur"], outer["ts"] + outer["dur"] + 0.001 )
+
+	def testDeletedPlugs( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["add"] = GafferTest.AddNode()
+
+		monitor = Gaffer.TraceMonitor( processMask = { "computeNode:compute" } )
+		with monitor :
+			script["add"]["sum"].getValue()
+
+		# The monitor must not keep the plug alive, but must
+		# still be able to report its name.
+
+		node = script["add"]
+		del script["add"]
+		self.assertEqual( node.refCount(), 1 )
+		del node
+
+		self.assertEqual( [ e["name"] for e in self.__readTrace( monitor ) ], [ "add.sum" ] )
+
+	def testCollaboration( self ) :
+
+		# See `ProcessTest.testNoCollaborationOnRecursion()`.
+
+		GafferTest.clearTestProcessCache()
+
+		plug = Gaffer.Plug()
+		monitor = Gaffer.TraceMonitor()
+		with monitor :
+			GafferTest.runTestProcess( plug, 1, { 10 : { 10 : { 10 : {} } } } )
+
+		fileName = os.path.join( self.temporaryDirectory(), "trace.json" )
+		monitor.writeChromeTrace( fileName )
+		with open( fileName ) as f :
+			events = [ e for e in json.load( f )["traceEvents"] if e["ph"] != "M" ]
+
+		self.assertEqual( len( events ), monitor.numEvents() )
+		self.assertEqual( { e["name"] for e in events }, { "Plug" } )
+		self.assertEqual( { e["cat"] for e in events }, { "computeNode:compute" } )
+
+		processes = [ e for e in events if e["ph"] == "X" ]
+		self.assertEqual( len( processes ), 4 )
+
+		collaborations = [ e for e in events if e["ph"] == "i" ]
+		self.assertEqual( len( collaborations ), 3 )
+		self.assertEqual( [ e["args"]["cycleFallback"] for e in collaborations ].count( True ), 2 )
+		for collaboration in collaborations :
+			self.assertTrue( collaboration["args"]["collaboration"] )
+			self.assertTrue(
+				any( p["ts"] <= collaboration["ts"] <= p["ts"] + p["dur"] + 0.001 for p in processes )
+			)
+
+if __name__ == "__main__":
+	unittest.main()
@@ -38,10 +38,12 @@
 import gc
 import inspect
 import os
+import shutil
 import subprocess
 import threading
 import time
 import unittest
+import weakref
 
 import imath
 
@@ -1020,6 +1022,313 @@ class ValuePlugTest( GafferTest.TestCase ) :
 			backgroundTask2.cancelAndWait()
 			backgroundTask1.cancelAndWait()
 
+	class PersistentNode( Gaffer.ComputeNode ) :
+
+		def __init__( self, name="PersistentNode" ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self["in"] = Gaffer.IntPlug()
+			self["out"] = Gaffer.ObjectPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.NullObject.defaultNullObject() )
+
+			self.numComputes = 0
+
+		def affects( self, input ) :
+
+			outputs = Gaffer.ComputeNode.affects( self, input )
+			if input == self["in"] :
+				outputs.append( self["out"] )
+
+			return outputs
+
+		def hash( self, plug, context, h ) :
+
+			if plug == self["out"] :
+				self["in"].hash( h )
+
+		def compute( self, plug, context ) :
+
+			if plug == self["out"] :
+				self.numComputes += 1
+				plug.setValue( IECore.IntVectorData( [ self["in"].getValue() ] * 1000 ) )
+
+		def computeCachePolicy( self, plug ) :
+
+			return Gaffer.ValuePlug.CachePolicy.Persistent
+
+	IECore.registerRunTimeTyped( PersistentNode )
+
+	def testPersistentCache( self ) :
+
+		# The directory may have been set already via
+		# `GAFFER_PERSISTENT_CACHE_DIRECTORY`.
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheDirectory, Gaffer.ValuePlug.getPersistentCacheDirectory() )
+
+		directory = self.temporaryDirectory() / "persistentCache"
+		Gaffer.ValuePlug.setPersistentCacheDirectory( directory.as_posix() )
+		Gaffer.ValuePlug.setPersistentCacheCostThreshold( 0 )
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheCostThreshold, Gaffer.ValuePlug.getPersistentCacheCostThreshold() )
+
+		self.assertEqual( Gaffer.ValuePlug.getPersistentCacheDirectory(), directory.as_posix() )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		node = self.PersistentNode()
+		node["in"].setValue( 10 )
+
+		# First compute populates both caches.
+
+		self.assertEqual( node["out"].getValue(), IECore.IntVectorData( [ 10 ] * 1000 ) )
+		self.assertEqual( node.numComputes, 1 )
+		self.assertGreater( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		# Clearing the memory cache should not cause a recompute,
+		# because the result can be loaded from disk.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.IntVectorData( [ 10 ] * 1000 ) )
+		self.assertEqual( node.numComputes, 1 )
+
+		# Entries should be available to other processes using
+		# the same directory, which we simulate by resetting the
+		# directory.
+
+		Gaffer.ValuePlug.setPersistentCacheDirectory( "" )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( directory.as_posix() )
+		self.assertGreater( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.IntVectorData( [ 10 ] * 1000 ) )
+		self.assertEqual( node.numComputes, 1 )
+
+		# Clearing both caches forces a recompute.
+
+		Gaffer.ValuePlug.clearPersistentCache()
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.IntVectorData( [ 10 ] * 1000 ) )
+		self.assertEqual( node.numComputes, 2 )
+
+		# A size limit of 0 prevents anything being stored.
+
+		sizeLimit = Gaffer.ValuePlug.getPersistentCacheSizeLimit()
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheSizeLimit, sizeLimit )
+		Gaffer.ValuePlug.setPersistentCacheSizeLimit( 0 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+		self.assertEqual( list( directory.glob( "*/*.fio" ) ), [] )
+
+		node["in"].setValue( 11 )
+		self.assertEqual( node["out"].getValue(), IECore.IntVectorData( [ 11 ] * 1000 ) )
+		self.assertEqual( node.numComputes, 3 )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+	def testPersistentCacheCostThreshold( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheDirectory, Gaffer.ValuePlug.getPersistentCacheDirectory() )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( ( self.temporaryDirectory() / "persistentCache" ).as_posix() )
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheCostThreshold, Gaffer.ValuePlug.getPersistentCacheCostThreshold() )
+
+		node = self.PersistentNode()
+		Gaffer.ValuePlug.setPersistentCacheCostThreshold( node["out"].getValue().memoryUsage() + 1 )
+		Gaffer.ValuePlug.clearCache()
+
+		node["out"].getValue()
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+	def testPersistentCacheFindsEntriesWrittenLater( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheDirectory, Gaffer.ValuePlug.getPersistentCacheDirectory() )
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheCostThreshold, Gaffer.ValuePlug.getPersistentCacheCostThreshold() )
+		Gaffer.ValuePlug.setPersistentCacheCostThreshold( 0 )
+
+		# Write an entry to one directory.
+
+		otherDirectory = self.temporaryDirectory() / "otherPersistentCache"
+		Gaffer.ValuePlug.setPersistentCacheDirectory( otherDirectory.as_posix() )
+
+		node = self.PersistentNode()
+		node["out"].getValue()
+		self.assertEqual( node.numComputes, 1 )
+
+		# Switch to an empty directory, and then copy the entry into it.
+		# This simulates the entry being written by another process after
+		# we opened the directory, as happens when farm frames run at the
+		# same time.
+
+		directory = self.temporaryDirectory() / "persistentCache"
+		Gaffer.ValuePlug.setPersistentCacheDirectory( directory.as_posix() )
+		self.assertEqual( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+		shutil.copytree( otherDirectory, directory, dirs_exist_ok = True )
+
+		# The entry should be found on disk, rather than recomputed.
+
+		Gaffer.ValuePlug.clearCache()
+		node["out"].getValue()
+		self.assertEqual( node.numComputes, 1 )
+		self.assertGreater( Gaffer.ValuePlug.persistentCacheUsage(), 0 )
+
+	def testPersistentCacheKeyComponent( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheDirectory, Gaffer.ValuePlug.getPersistentCacheDirectory() )
+		Gaffer.ValuePlug.setPersistentCacheDirectory( ( self.temporaryDirectory() / "persistentCache" ).as_posix() )
+		self.addCleanup( Gaffer.ValuePlug.setPersistentCacheCostThreshold, Gaffer.ValuePlug.getPersistentCacheCostThreshold() )
+		Gaffer.ValuePlug.setPersistentCacheCostThreshold( 0 )
+
+		node = self.PersistentNode()
+		node["out"].getValue()
+		self.assertEqual( node.numComputes, 1 )
+		Gaffer.ValuePlug.persistentCacheUsage() # Waits for the write
+
+		# Entries stored with a different key component must not
+		# be reused, so we expect a recompute.
+
+		component = IECore.MurmurHash()
+		component.append( "testPersistentCacheKeyComponent" )
+		Gaffer.ValuePlug.addPersistentCacheKeyComponent( component )
+
+		Gaffer.ValuePlug.clearCache()
+		node["out"].getValue()
+		self.assertEqual( node.numComputes, 2 )
+
+		# But entries stored since are.
+
+		Gaffer.ValuePlug.persistentCacheUsage()
+		Gaffer.ValuePlug.clearCache()
+		node["out"].getValue()
+		self.assertEqual( node.numComputes, 2 )
+
+	def testHashIsIndependentOfProcess( self ) :
+
+		# The persistent cache is keyed by plug hash, so hashes must be
+		# identical in every process for results to be shared. Random is
+		# a good test, because its hash includes the hash of a context
+		# variable.
+
+		output = subprocess.check_output(
+			[
+				str( Gaffer.executablePath() ), "env", "python", "-c",
+				inspect.cleandoc(
+					"""
+					import IECore
+					import Gaffer
+
+					# Intern some unrelated strings first, so that the variable name
+					# is unlikely to have the same address as in the test process.
+					IECore.InternedStringVectorData( [ "unrelated{}".format( i ) for i in range( 0, 1000 ) ] )
+
+					random = Gaffer.Random()
+					random["seedVariable"].setValue( "testHashIsIndependentOfProcess" )
+					with Gaffer.Context() as c :
+						c["testHashIsIndependentOfProcess"] = 10
+						print( random["outFloat"].hash() )
+					"""
+				)
+			],
+			universal_newlines = True
+		)
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "testHashIsIndependentOfProcess" )
+		with Gaffer.Context() as c :
+			c["testHashIsIndependentOfProcess"] = 10
+			self.assertEqual( output.strip(), str( random["outFloat"].hash() ) )
+
+	class FloatVectorNode( Gaffer.ComputeNode ) :
+
+		def __init__( self, name="FloatVectorNode" ) :
+
+			Gaffer.ComputeNode.__init__( self, name )
+
+			self["in"] = Gaffer.FloatPlug()
+			self["out"] = Gaffer.FloatVectorDataPlug( direction = Gaffer.Plug.Direction.Out, defaultValue = IECore.FloatVectorData() )
+
+			self.numComputes = 0
+
+		def affects( self, input ) :
+
+			outputs = Gaffer.ComputeNode.affects( self, input )
+			if input == self["in"] :
+				outputs.append( self["out"] )
+
+			return outputs
+
+		def hash( self, plug, context, h ) :
+
+			if plug == self["out"] :
+				self["in"].hash( h )
+
+		def compute( self, plug, context ) :
+
+			if plug == self["out"] :
+				self.numComputes += 1
+				plug.setValue( IECore.FloatVectorData( [ self["in"].getValue() * i for i in range( 0, 4096 ) ] ) )
+
+	IECore.registerRunTimeTyped( FloatVectorNode )
+
+	def testCompressedCache( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setCompressedCacheMemoryLimit, Gaffer.ValuePlug.getCompressedCacheMemoryLimit() )
+		Gaffer.ValuePlug.setCompressedCacheMemoryLimit( 100 * 1024 * 1024 )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearCompressedCacheStatistics()
+
+		self.assertEqual( Gaffer.ValuePlug.compressedCacheMemoryUsage(), 0 )
+
+		ramp = self.FloatVectorNode()
+		ramp["in"].setValue( 1 / 4096 )
+		constant = self.FloatVectorNode()
+		intVector = self.PersistentNode()
+
+		rampValue = ramp["out"].getValue()
+		constantValue = constant["out"].getValue()
+		intVector["out"].getValue()
+
+		# Evicting from the compute cache stores the FloatVectorData in
+		# the compressed cache, and ignores everything else.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+
+		statistics = Gaffer.ValuePlug.compressedCacheStatistics()
+		self.assertEqual( statistics.entries, 2 )
+		self.assertEqual( statistics.uncompressedMemoryUsage, 2 * 4096 * 4 )
+		self.assertLess( statistics.memoryUsage, statistics.uncompressedMemoryUsage / 2 )
+		self.assertEqual( statistics.memoryUsage, Gaffer.ValuePlug.compressedCacheMemoryUsage() )
+		self.assertEqual( statistics.hits, 0 )
+
+		# Values are decompressed rather than recomputed.
+
+		self.assertEqual( ramp["out"].getValue(), rampValue )
+		self.assertEqual( constant["out"].getValue(), constantValue )
+		self.assertEqual( ramp.numComputes, 1 )
+		self.assertEqual( constant.numComputes, 1 )
+		self.assertEqual( Gaffer.ValuePlug.compressedCacheStatistics().hits, 2 )
+
+		# Only FloatVectorDataPlugs consult the compressed cache.
+
+		misses = Gaffer.ValuePlug.compressedCacheStatistics().misses
+		intVector["out"].getValue()
+		self.assertEqual( intVector.numComputes, 2 )
+		self.assertEqual( Gaffer.ValuePlug.compressedCacheStatistics().misses, misses )
+
+		# Clearing the cache clears the compressed cache too.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.compressedCacheStatistics().entries, 0 )
+		self.assertEqual( Gaffer.ValuePlug.compressedCacheMemoryUsage(), 0 )
+
+		self.assertEqual( ramp["out"].getValue(), rampValue )
+		self.assertEqual( ramp.numComputes, 2 )
+
+		# A limit of 0 disables the compressed cache.
+
+		Gaffer.ValuePlug.setCompressedCacheMemoryLimit( 0 )
+		Gaffer.ValuePlug.clearCompressedCacheStatistics()
+		self.assertEqual( ramp["out"].getValue(), rampValue )
+		self.assertEqual( ramp.numComputes, 3 )
+		self.assertEqual( Gaffer.ValuePlug.compressedCacheStatistics().entries, 0 )
+		self.assertEqual( Gaffer.ValuePlug.compressedCacheStatistics().misses, 0 )
+
 	# A node that inherits from ComputeNode, but doesn't implement a compute.
 	# We would expect the cache policies to never be evaluated
 	class NoComputeNode( Gaffer.ComputeNode ) :
@@ -1067,6 +1376,198 @@ class ValuePlugTest( GafferTest.TestCase ) :
 					node["in"].setValue( i )
 					self.assertEqual( node["out"].getValue(), i )
 
+	def testCacheStatistics( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.clearCacheStatistics )
+		self.addCleanup( Gaffer.ValuePlug.setCacheStatisticsEnabled, False )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.setCacheStatisticsEnabled( True )
+		self.assertTrue( Gaffer.ValuePlug.getCacheStatisticsEnabled() )
+
+		add = GafferTest.AddNode()
+		add["op1"].setValue( 1 )
+		multiply = GafferTest.MultiplyNode()
+		multiply["op1"].setValue( 2 )
+
+		self.assertEqual( add["sum"].getValue(), 1 )
+		self.assertEqual( add["sum"].getValue(), 1 )
+		self.assertEqual( multiply["product"].getValue(), 0 )
+
+		statistics = Gaffer.ValuePlug.cacheStatistics()
+		self.assertEqual( len( statistics ), 2 )
+		self.assertIn( add.fullName(), statistics )
+		self.assertIn( multiply.fullName(), statistics )
+		self.assertEqual( statistics[add.fullName()].nodeType, add.typeName() )
+		self.assertEqual( statistics[multiply.fullName()].nodeType, multiply.typeName() )
+
+		self.assertEqual( statistics[add.fullName()].entries, 1 )
+		self.assertGreater( statistics[add.fullName()].memoryUsage, 0 )
+		self.assertEqual( statistics[add.fullName()].misses, 1 )
+		self.assertEqual( statistics[add.fullName()].hits, 1 )
+		self.assertEqual( statistics[add.fullName()].evictions, 0 )
+
+		self.assertEqual( statistics[multiply.fullName()].entries, 1 )
+		self.assertEqual( statistics[multiply.fullName()].misses, 1 )
+		self.assertEqual( statistics[multiply.fullName()].hits, 0 )
+
+		self.assertEqual(
+			sum( s.memoryUsage for s in statistics.values() ),
+			Gaffer.ValuePlug.cacheMemoryUsage()
+		)
+
+		# Clearing the statistics resets the counts, but not occupancy.
+
+		Gaffer.ValuePlug.clearCacheStatistics()
+		statistics = Gaffer.ValuePlug.cacheStatistics()
+		self.assertEqual( statistics[add.fullName()].entries, 1 )
+		self.assertEqual( statistics[add.fullName()].misses, 0 )
+		self.assertEqual( statistics[add.fullName()].hits, 0 )
+
+		# Clearing the cache counts as eviction.
+
+		Gaffer.ValuePlug.clearCache()
+		statistics = Gaffer.ValuePlug.cacheStatistics()
+		self.assertEqual( statistics[add.fullName()].entries, 0 )
+		self.assertEqual( statistics[add.fullName()].memoryUsage, 0 )
+		self.assertEqual( statistics[add.fullName()].evictions, 1 )
+
+		# Nodes without entries are forgotten on the next clear.
+
+		Gaffer.ValuePlug.clearCacheStatistics()
+		self.assertEqual( Gaffer.ValuePlug.cacheStatistics(), {} )
+
+		# Statistics don't keep nodes alive.
+
+		self.assertEqual( add["sum"].getValue(), 1 )
+		self.assertIn( add.fullName(), Gaffer.ValuePlug.cacheStatistics() )
+		addName = add.fullName()
+		w = weakref.ref( add )
+		del add
+		while gc.collect() :
+			pass
+		IECore.RefCounted.collectGarbage()
+		self.assertIsNone( w() )
+		self.assertIn( addName, Gaffer.ValuePlug.cacheStatistics() )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearCacheStatistics()
+		self.assertEqual( Gaffer.ValuePlug.cacheStatistics(), {} )
+
+		# Disabling statistics stops further accounting.
+
+		Gaffer.ValuePlug.setCacheStatisticsEnabled( False )
+		self.assertEqual( multiply["product"].getValue(), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cacheStatistics(), {} )
+
+	def testGlobalHashCacheMode( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheMode, Gaffer.ValuePlug.getHashCacheMode() )
+		Gaffer.ValuePlug.setHashCacheMode( Gaffer.ValuePlug.HashCacheMode.Global )
+
+		node = GafferTest.AddNode()
+		node["op1"].setValue( 1 )
+		self.assertEqual( node["sum"].getValue(), 1 )
+
+		with Gaffer.PerformanceMonitor() as m :
+			self.assertEqual( node["sum"].getValue(), 1 )
+		self.assertEqual( m.plugStatistics( node["sum"] ).hashCount, 0 )
+
+		# Dirtying must invalidate the shared cache just as it does the
+		# per-thread caches.
+
+		node["op1"].setValue( 2 )
+		with Gaffer.PerformanceMonitor() as m :
+			self.assertEqual( node["sum"].getValue(), 2 )
+		self.assertEqual( m.plugStatistics( node["sum"] ).hashCount, 1 )
+
+		Gaffer.ValuePlug.clearHashCache()
+		with Gaffer.PerformanceMonitor() as m :
+			self.assertEqual( node["sum"].getValue(), 2 )
+		self.assertEqual( m.plugStatistics( node["sum"] ).hashCount, 1 )
+
+	def testGlobalHashCacheSizeLimit( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheMode, Gaffer.ValuePlug.getHashCacheMode() )
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheSizeLimit, Gaffer.ValuePlug.getHashCacheSizeLimit() )
+
+		Gaffer.ValuePlug.setHashCacheMode( Gaffer.ValuePlug.HashCacheMode.Global )
+		Gaffer.ValuePlug.setHashCacheSizeLimit( 1024 )
+		Gaffer.ValuePlug.clearHashCache( now = True )
+
+		# Unlike the per-thread caches, the limit applies to the shared cache
+		# as a whole, no matter how many threads we use.
+
+		m = GafferTest.MultiplyNode()
+		GafferTest.parallelHash( m["product"], 100000, "testVar", 5000, 32 )
+		self.assertGreater( Gaffer.ValuePlug.hashCacheTotalUsage(), 0 )
+		self.assertLessEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), 1024 )
+		# Each entry occupies a single cache line.
+		self.assertGreaterEqual( Gaffer.ValuePlug.hashCacheMemoryUsage(), 1024 * 64 )
+		self.assertLess( Gaffer.ValuePlug.hashCacheMemoryUsage(), 2 * 1024 * 64 )
+
+		# Hashes must be unaffected by eviction.
+
+		hashes = {}
+		with Gaffer.Context() as c :
+			for i in range( 0, 5000, 97 ) :
+				c["testVar"] = i
+				hashes[i] = m["product"].hash()
+
+		Gaffer.ValuePlug.setHashCacheMode( Gaffer.ValuePlug.HashCacheMode.Standard )
+		with Gaffer.Context() as c :
+			for i, h in hashes.items() :
+				c["testVar"] = i
+				self.assertEqual( m["product"].hash(), h )
+
+	def __hashCacheScalingTest( self, hashCacheMode, numThreads ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setHashCacheMode, Gaffer.ValuePlug.getHashCacheMode() )
+		Gaffer.ValuePlug.setHashCacheMode( hashCacheMode )
+		Gaffer.ValuePlug.clearHashCache( now = True )
+
+		m = GafferTest.MultiplyNode()
+		memoryBefore = Gaffer.ValuePlug.hashCacheMemoryUsage()
+		# Warm up the cache, so we are measuring the time taken for hits.
+		GafferTest.parallelHash( m["product"], 1000000, "testVar", 1000, numThreads )
+
+		with GafferTest.TestRunner.PerformanceScope() as s :
+			GafferTest.parallelHash( m["product"], 20000000, "testVar", 1000, numThreads )
+
+		# The hash cache modes trade memory against speed differently, so
+		# we record both.
+		s.setMemoryUsage( Gaffer.ValuePlug.hashCacheMemoryUsage() - memoryBefore )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testStandardHashCacheHits8Threads( self ) :
+
+		self.__hashCacheScalingTest( Gaffer.ValuePlug.HashCacheMode.Standard, 8 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testStandardHashCacheHits32Threads( self ) :
+
+		self.__hashCacheScalingTest( Gaffer.ValuePlug.HashCacheMode.Standard, 32 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testStandardHashCacheHits128Threads( self ) :
+
+		self.__hashCacheScalingTest( Gaffer.ValuePlug.HashCacheMode.Standard, 128 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGlobalHashCacheHits8Threads( self ) :
+
+		self.__hashCacheScalingTest( Gaffer.ValuePlug.HashCacheMode.Global, 8 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGlobalHashCacheHits32Threads( self ) :
+
+		self.__hashCacheScalingTest( Gaffer.ValuePlug.HashCacheMode.Global, 32 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testGlobalHashCacheHits128Threads( self ) :
+
+		self.__hashCacheScalingTest( Gaffer.ValuePlug.HashCacheMode.Global, 128 )
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
@@ -158,6 +158,8 @@ from .HiddenFilePathFilterTest import HiddenFilePathFilterTest
 from .ContextVariableTweaksTest import ContextVariableTweaksTest
 from .OptionalValuePlugTest import OptionalValuePlugTest
 from .ThreadMonitorTest import ThreadMonitorTest
+from .TraceMonitorTest import TraceMonitorTest
+from .MemoryGovernorTest import MemoryGovernorTest
 from .CollectTest import CollectTest
 from .ProcessTest import ProcessTest
 
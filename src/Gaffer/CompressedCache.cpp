@@ -0,0 +1,458 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/Private/CompressedCache.h"
+
+#include "IECore/Exception.h"
+#include "IECore/VectorTypedData.h"
+
+#include <cstring>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer::Private;
+
+//////////////////////////////////////////////////////////////////////////
+// Encoding
+//////////////////////////////////////////////////////////////////////////
+
+struct CompressedCache::Block
+{
+
+	enum class Encoding
+	{
+		Constant,
+		RunLength,
+		// Used when run length encoding would
+		// make the data bigger.
+		Raw
+	};
+
+	Encoding encoding;
+	size_t size;
+	float constant;
+	vector<uint8_t> bytes;
+
+	size_t memoryUsage() const
+	{
+		return sizeof( Block ) + bytes.capacity();
+	}
+
+	size_t uncompressedMemoryUsage() const
+	{
+		return size * sizeof( float );
+	}
+
+};
+
+namespace
+{
+
+// Separates the floats into planes holding the first, second, third and
+// fourth bytes of each value, so that the similar sign and exponent bytes
+// of neighbouring values are adjacent. Each plane is then delta encoded so
+// that constant and smoothly varying bytes become runs. This is the same
+// scheme as used by OpenEXR's RLE and ZIP compressors.
+void shuffle( const float *data, size_t size, uint8_t *result )
+{
+	const uint8_t *bytes = reinterpret_cast<const uint8_t *>( data );
+	for( size_t b = 0; b < sizeof( float ); ++b )
+	{
+		uint8_t previous = 0;
+		for( size_t i = 0; i < size; ++i )
+		{
+			const uint8_t v = bytes[i * sizeof( float ) + b];
+			*result++ = v - previous;
+			previous = v;
+		}
+	}
+}
+
+void unshuffle( const uint8_t *shuffled, size_t size, float *data )
+{
+	uint8_t *bytes = reinterpret_cast<uint8_t *>( data );
+	for( size_t b = 0; b < sizeof( float ); ++b )
+	{
+		uint8_t previous = 0;
+		for( size_t i = 0; i < size; ++i )
+		{
+			previous += *shuffled++;
+			bytes[i * sizeof( float ) + b] = previous;
+		}
+	}
+}
+
+// Runs of 3 to 130 identical bytes are stored as a control byte of
+// `128 + length - 3` followed by the byte. Everything else is stored
+// in literal runs of 1 to 128 bytes, each prefixed by a control byte
+// of `length - 1`.
+const size_t g_minRun = 3;
+const size_t g_maxRun = 130;
+const size_t g_maxLiteral = 128;
+
+void runLengthEncode( const uint8_t *data, size_t size, vector<uint8_t> &result )
+{
+	size_t literalStart = 0;
+	auto flushLiterals = [&] ( size_t end ) {
+		while( literalStart < end )
+		{
+			const size_t length = std::min( end - literalStart, g_maxLiteral );
+			result.push_back( length - 1 );
+			result.insert( result.end(), data + literalStart, data + literalStart + length );
+			literalStart += length;
+		}
+	};
+
+	size_t i = 0;
+	while( i < size )
+	{
+		size_t run = 1;
+		while( i + run < size && run < g_maxRun && data[i+run] == data[i] )
+		{
+			++run;
+		}
+
+		if( run >= g_minRun )
+		{
+			flushLiterals( i );
+			result.push_back( 128 + run - g_minRun );
+			result.push_back( data[i] );
+			literalStart = i + run;
+		}
+		i += run;
+	}
+	flushLiterals( size );
+}
+
+void runLengthDecode( const uint8_t *data, size_t size, uint8_t *result, size_t resultSize )
+{
+	const uint8_t *dataEnd = data + size;
+	const uint8_t *resultEnd = result + resultSize;
+	while( data < dataEnd )
+	{
+		const uint8_t control = *data++;
+		if( control < 128 )
+		{
+			const size_t length = control + 1;
+			if( (size_t)( dataEnd - data ) < length || (size_t)( resultEnd - result ) < length )
+			{
+				throw IECore::Exception( "CompressedCache : Corrupt literal run" );
+			}
+			memcpy( result, data, length );
+			data += length;
+			result += length;
+		}
+		else
+		{
+			const size_t length = control - 128 + g_minRun;
+			if( data == dataEnd || (size_t)( resultEnd - result ) < length )
+			{
+				throw IECore::Exception( "CompressedCache : Corrupt repeat run" );
+			}
+			memset( result, *data++, length );
+			result += length;
+		}
+	}
+
+	if( result != resultEnd )
+	{
+		throw IECore::Exception( "CompressedCache : Unexpected end of data" );
+	}
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// CompressedCache
+//////////////////////////////////////////////////////////////////////////
+
+CompressedCache::CompressedCache( size_t maxMemory )
+	:	m_cache(
+			Cache::GetterFunction(), maxMemory,
+			[this] ( const MurmurHash &key, const ConstBlockPtr &block ) { removed( key, block ); },
+			/* cacheErrors = */ false
+		),
+		m_pendingCount( 0 ), m_pendingMemory( 0 ), m_draining( false ),
+		m_generation( 0 ), m_clearScopes( 0 ),
+		m_entries( 0 ), m_uncompressedMemory( 0 ), m_hits( 0 ), m_misses( 0 )
+{
+}
+
+CompressedCache::~CompressedCache()
+{
+	wait();
+}
+
+void CompressedCache::setMaxMemory( size_t bytes )
+{
+	m_cache.setMaxCost( bytes );
+}
+
+size_t CompressedCache::getMaxMemory() const
+{
+	return m_cache.getMaxCost();
+}
+
+bool CompressedCache::enabled() const
+{
+	return m_cache.getMaxCost();
+}
+
+size_t CompressedCache::currentMemory() const
+{
+	return m_cache.currentCost();
+}
+
+size_t CompressedCache::uncompressedMemory() const
+{
+	return m_uncompressedMemory;
+}
+
+size_t CompressedCache::entries() const
+{
+	return m_entries;
+}
+
+IECore::ConstObjectPtr CompressedCache::get( const IECore::MurmurHash &key )
+{
+	std::optional<ConstBlockPtr> block = m_cache.getIfCached( key );
+	if( !block )
+	{
+		m_misses++;
+		return nullptr;
+	}
+	m_hits++;
+
+	const Block &b = **block;
+	FloatVectorDataPtr result = new FloatVectorData;
+	vector<float> &data = result->writable();
+	switch( b.encoding )
+	{
+		case Block::Encoding::Constant :
+			data.resize( b.size, b.constant );
+			break;
+		case Block::Encoding::RunLength : {
+			data.resize( b.size );
+			vector<uint8_t> shuffled( b.size * sizeof( float ) );
+			runLengthDecode( b.bytes.data(), b.bytes.size(), shuffled.data(), shuffled.size() );
+			unshuffle( shuffled.data(), b.size, data.data() );
+			break;
+		}
+		case Block::Encoding::Raw :
+			data.resize( b.size );
+			memcpy( data.data(), b.bytes.data(), b.bytes.size() );
+			break;
+	}
+
+	return result;
+}
+
+bool CompressedCache::set( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &object )
+{
+	if( !enabled() || m_clearScopes || object->typeId() != FloatVectorDataTypeId )
+	{
+		return false;
+	}
+
+	if( m_cache.cached( key ) )
+	{
+		// Common when an entry is evicted from the compute cache
+		// for a second time, after being decompressed from here.
+		// Avoid the cost of compressing it again.
+		return false;
+	}
+
+	// Limit the memory held by data awaiting compression, in case
+	// evictions outpace the compression.
+	const size_t memory = static_cast<const FloatVectorData *>( object.get() )->readable().size() * sizeof( float );
+	if( m_pendingMemory.fetch_add( memory ) + memory > getMaxMemory() )
+	{
+		m_pendingMemory -= memory;
+		return false;
+	}
+
+	m_pendingCount++;
+	m_pending.push( Pending{ key, object, m_generation } );
+
+	if( !m_draining.exchange( true ) )
+	{
+		// The drain task counts as pending itself, so that `wait()`
+		// also waits for it to finish with us.
+		m_pendingCount++;
+		m_arena.enqueue( [this] { drain(); } );
+	}
+
+	return true;
+}
+
+void CompressedCache::wait()
+{
+	// Help with the work rather than just waiting for it.
+	Pending pending;
+	while( m_pending.try_pop( pending ) )
+	{
+		store( pending );
+	}
+
+	// Wait for `drain()` to finish with any data it popped before
+	// we got here.
+	while( m_pendingCount )
+	{
+		std::this_thread::yield();
+	}
+}
+
+void CompressedCache::clear()
+{
+	std::lock_guard<std::mutex> lock( m_clearMutex );
+	m_generation++;
+	m_cache.clear();
+}
+
+void CompressedCache::drain()
+{
+	do
+	{
+		Pending pending;
+		while( m_pending.try_pop( pending ) )
+		{
+			store( pending );
+		}
+		m_draining = false;
+		// Data may have been pushed after we found the queue empty but
+		// before we reset `m_draining`, in which case nobody else will
+		// have scheduled a drain for it.
+	} while( !m_pending.empty() && !m_draining.exchange( true ) );
+
+	m_pendingCount--;
+}
+
+void CompressedCache::store( const Pending &pending )
+{
+	const vector<float> &data = static_cast<const FloatVectorData *>( pending.object.get() )->readable();
+	const size_t numBytes = data.size() * sizeof( float );
+
+	if( pending.generation == m_generation )
+	{
+		auto block = std::make_shared<Block>();
+		block->size = data.size();
+		block->constant = data.size() ? data[0] : 0.0f;
+
+		// Compare bitwise rather than by value, so that we preserve
+		// the distinction between 0 and -0, and between NaNs.
+		if( !numBytes || !memcmp( data.data(), data.data() + 1, numBytes - sizeof( float ) ) )
+		{
+			block->encoding = Block::Encoding::Constant;
+		}
+		else
+		{
+			vector<uint8_t> shuffled( numBytes );
+			shuffle( data.data(), data.size(), shuffled.data() );
+			vector<uint8_t> encoded;
+			encoded.reserve( numBytes / 2 );
+			runLengthEncode( shuffled.data(), shuffled.size(), encoded );
+			if( encoded.size() < numBytes )
+			{
+				block->encoding = Block::Encoding::RunLength;
+				// Copy rather than move, so that we don't retain
+				// excess capacity.
+				block->bytes.assign( encoded.begin(), encoded.end() );
+			}
+			else
+			{
+				block->encoding = Block::Encoding::Raw;
+				const uint8_t *bytes = reinterpret_cast<const uint8_t *>( data.data() );
+				block->bytes.assign( bytes, bytes + numBytes );
+			}
+		}
+
+		std::lock_guard<std::mutex> lock( m_clearMutex );
+		if( pending.generation == m_generation )
+		{
+			// Account for the entry before inserting it, because the
+			// removal callback may be called for it immediately if it
+			// doesn't fit.
+			const size_t uncompressedMemory = block->uncompressedMemoryUsage();
+			m_entries++;
+			m_uncompressedMemory += uncompressedMemory;
+			if( !m_cache.setIfUncached( pending.key, block, [] ( const ConstBlockPtr &b ) { return b->memoryUsage(); } ) )
+			{
+				m_entries--;
+				m_uncompressedMemory -= uncompressedMemory;
+			}
+		}
+	}
+
+	m_pendingMemory -= numBytes;
+	m_pendingCount--;
+}
+
+size_t CompressedCache::hits() const
+{
+	return m_hits;
+}
+
+size_t CompressedCache::misses() const
+{
+	return m_misses;
+}
+
+void CompressedCache::clearStatistics()
+{
+	m_hits = 0;
+	m_misses = 0;
+}
+
+CompressedCache::ClearScope::ClearScope( CompressedCache &cache )
+	:	m_cache( cache )
+{
+	m_cache.m_clearScopes++;
+}
+
+CompressedCache::ClearScope::~ClearScope()
+{
+	m_cache.clear();
+	m_cache.m_clearScopes--;
+}
+
+void CompressedCache::removed( const IECore::MurmurHash &key, const ConstBlockPtr &block )
+{
+	m_entries--;
+	m_uncompressedMemory -= block->uncompressedMemoryUsage();
+}
@@ -229,7 +229,7 @@ static InternedString g_frame( "frame" );
 static InternedString g_framesPerSecond( "framesPerSecond" );
 
 Context::Context()
-	:	m_changedSignal( nullptr ), m_hashValid( false ), m_canceller( nullptr )
+	:	m_changedSignal( nullptr ), m_canceller( nullptr )
 {
 	set( g_frame, 1.0f );
 	set( g_framesPerSecond, 24.0f );
@@ -242,8 +242,6 @@ Context::Context( const Context &other )
 
 Context::Context( const Context &other, CopyMode mode )
 	:	m_changedSignal( nullptr ),
-		m_hash( other.m_hash ),
-		m_hashValid( other.m_hashValid ),
 		m_canceller( other.m_canceller )
 {
 	// Reserving one extra spot before we copy in the existing variables means that we will
@@ -254,33 +252,36 @@ Context::Context( const Context &other, CopyMode mode )
 
 	if( mode == CopyMode::NonOwning )
 	{
+		m_slots = other.m_slots;
 		m_map = other.m_map;
+		m_hash = other.m_hash;
 	}
 	else
 	{
 		// We need ownership of the stored values so that we remain valid even
 		// if the source context is destroyed.
-		m_allocMap.reserve( other.m_map.size() + 1 );
-		for( auto &i : other.m_map )
-		{
-			auto allocIt = other.m_allocMap.find( i.first );
-			if(
-				allocIt != other.m_allocMap.end() &&
-				i.second.references( allocIt->second.get() )
-			)
-			{
-				// The value is already owned by `other`, and is immutable, so we
-				// can just add our own reference to it to share ownership
-				// and then call `internalSet()`.
-				m_allocMap[i.first] = allocIt->second;
-				internalSet( i.first, i.second );
-			}
-			else
-			{
-				// Data not owned by `other`. Take a copy that we own, and call `internalSet()`.
-				internalSet( i.first, i.second.copy( m_allocMap[i.first] ) );
+		m_allocMap.reserve( other.m_map.size() + g_numSlots + 1 );
+		other.forEachVariable(
+			[&] ( const IECore::InternedString &name, const Value &value ) {
+				auto allocIt = other.m_allocMap.find( name );
+				if(
+					allocIt != other.m_allocMap.end() &&
+					value.references( allocIt->second.get() )
+				)
+				{
+					// The value is already owned by `other`, and is immutable, so we
+					// can just add our own reference to it to share ownership
+					// and then call `internalSet()`.
+					m_allocMap[name] = allocIt->second;
+					internalSet( name, value );
+				}
+				else
+				{
+					// Data not owned by `other`. Take a copy that we own, and call `internalSet()`.
+					internalSet( name, value.copy( m_allocMap[name] ) );
+				}
 			}
-		}
+		);
 	}
 }
 
@@ -332,15 +333,30 @@ IECore::DataPtr Context::getAsData( const IECore::InternedString &name, const IE
 
 void Context::remove( const IECore::InternedString &name )
 {
-	Map::iterator it = m_map.find( name );
-	if( it != m_map.end() )
+	const int slot = slotIndex( name );
+	if( slot >= 0 )
 	{
-		m_map.erase( it );
-		m_hashValid = false;
-		if( m_changedSignal )
+		if( m_slots[slot].typeId() == IECore::InvalidTypeId )
 		{
-			(*m_changedSignal)( this, name );
+			return;
 		}
+		updateHash( m_slots[slot], Value() );
+		m_slots[slot] = Value();
+	}
+	else
+	{
+		Map::iterator it = m_map.find( name );
+		if( it == m_map.end() )
+		{
+			return;
+		}
+		updateHash( it->second, Value() );
+		m_map.erase( it );
+	}
+
+	if( m_changedSignal )
+	{
+		(*m_changedSignal)( this, name );
 	}
 }
 
@@ -351,30 +367,29 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 		return;
 	}
 
-	for( Map::iterator it = m_map.begin(); it != m_map.end(); )
-	{
-		if( StringAlgo::matchMultiple( it->first, pattern ) )
-		{
-			it = m_map.erase( it );
-			m_hashValid = false;
-			if( m_changedSignal )
+	std::vector<IECore::InternedString> toRemove;
+	forEachVariable(
+		[&] ( const IECore::InternedString &name, const Value &value ) {
+			if( StringAlgo::matchMultiple( name, pattern ) )
 			{
-				(*m_changedSignal)( this, it->first );
+				toRemove.push_back( name );
 			}
 		}
-		else
-		{
-			it++;
-		}
+	);
+
+	for( const auto &name : toRemove )
+	{
+		remove( name );
 	}
 }
 
 void Context::names( std::vector<IECore::InternedString> &names ) const
 {
-	for( Map::const_iterator it = m_map.begin(), eIt = m_map.end(); it != eIt; it++ )
-	{
-		names.push_back( it->first );
-	}
+	forEachVariable(
+		[&] ( const IECore::InternedString &name, const Value &value ) {
+			names.push_back( name );
+		}
+	);
 }
 
 float Context::getFrame() const
@@ -424,26 +439,12 @@ Context::ChangedSignal &Context::changedSignal()
 
 IECore::MurmurHash Context::hash() const
 {
-	if( m_hashValid )
-	{
-		return m_hash;
-	}
-
-	uint64_t sumH1 = 0, sumH2 = 0;
-	for( Map::const_iterator it = m_map.begin(), eIt = m_map.end(); it != eIt; ++it )
-	{
-		sumH1 += it->second.hash().h1();
-		sumH2 += it->second.hash().h2();
-	}
-
-	m_hash = MurmurHash( sumH1, sumH2 );
-	m_hashValid = true;
 	return m_hash;
 }
 
 bool Context::operator == ( const Context &other ) const
 {
-	return m_map == other.m_map;
+	return m_slots == other.m_slots && m_map == other.m_map;
 }
 
 bool Context::operator != ( const Context &other ) const
@@ -0,0 +1,568 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/MemoryGovernor.h"
+
+#include "Gaffer/ValuePlug.h"
+
+#include "IECore/Exception.h"
+#include "IECore/MessageHandler.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+using namespace Gaffer;
+using namespace Gaffer::MemoryGovernor;
+
+//////////////////////////////////////////////////////////////////////////
+// Memory statistics
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+bool readSize( const string &fileName, size_t &value )
+{
+	ifstream file( fileName );
+	string token;
+	if( !( file >> token ) || token == "max" )
+	{
+		return false;
+	}
+	try
+	{
+		value = stoull( token );
+	}
+	catch( const std::exception & )
+	{
+		return false;
+	}
+	return true;
+}
+
+// Returns the value of a `key value` line in files such as
+// `/proc/meminfo` and `memory.stat`, multiplied by `multiplier`.
+bool readKey( const string &fileName, const string &key, size_t &value, size_t multiplier = 1 )
+{
+	ifstream file( fileName );
+	string line;
+	while( getline( file, line ) )
+	{
+		istringstream stream( line );
+		string k;
+		size_t v;
+		if( stream >> k >> v && ( k == key || k == key + ":" ) )
+		{
+			value = v * multiplier;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Returns the directory for the cgroup (v2) the process belongs to,
+// or an empty string if it can't be determined.
+string cgroupDirectory()
+{
+	ifstream file( "/proc/self/cgroup" );
+	string line;
+	while( getline( file, line ) )
+	{
+		// The v2 hierarchy is listed as `0::<path>`.
+		if( line.compare( 0, 3, "0::" ) == 0 )
+		{
+			return "/sys/fs/cgroup" + line.substr( 3 );
+		}
+	}
+	return "";
+}
+
+bool cgroupStatistics( MemoryStatistics &statistics )
+{
+	const string directory = cgroupDirectory();
+	if( directory.empty() )
+	{
+		return false;
+	}
+
+	if(
+		!readSize( directory + "/memory.max", statistics.limit ) ||
+		!readSize( directory + "/memory.current", statistics.used )
+	)
+	{
+		// No limit on our cgroup, so `/proc/meminfo` is the
+		// better source of information.
+		return false;
+	}
+
+	// `memory.current` includes the page cache, which the kernel will
+	// reclaim before running out of memory. Don't count it, otherwise
+	// we'd shrink our caches every time a large file was read.
+	size_t inactiveFile = 0;
+	if( readKey( directory + "/memory.stat", "inactive_file", inactiveFile ) )
+	{
+		statistics.used -= std::min( inactiveFile, statistics.used );
+	}
+
+	return true;
+}
+
+bool memInfoStatistics( MemoryStatistics &statistics )
+{
+	size_t total = 0, available = 0;
+	if(
+		!readKey( "/proc/meminfo", "MemTotal", total, 1024 ) ||
+		!readKey( "/proc/meminfo", "MemAvailable", available, 1024 )
+	)
+	{
+		return false;
+	}
+
+	statistics.limit = total;
+	statistics.used = total - std::min( available, total );
+	return true;
+}
+
+} // namespace
+
+MemoryStatistics MemoryGovernor::memoryStatistics()
+{
+	MemoryStatistics result;
+	if( !cgroupStatistics( result ) && !memInfoStatistics( result ) )
+	{
+		// Unsupported platform. A zero limit tells the governor
+		// not to shrink anything.
+		result = MemoryStatistics();
+	}
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Governor state
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct Cache
+{
+	LimitGetter getter;
+	LimitSetter setter;
+	// Maximum specified by `setMaximumLimit()`, or captured from
+	// the cache when the governor was enabled.
+	size_t maximum = 0;
+	bool explicitMaximum = false;
+	// Maximum specified by `setMaximumLimitFraction()`. Takes
+	// precedence over `maximum` when non-zero.
+	float maximumFraction = 0.0f;
+	// The limit we last passed to `setter`.
+	size_t applied = 0;
+};
+
+struct State
+{
+
+	State()
+	{
+		caches["ValuePlug:computeCache"] = { &ValuePlug::getCacheMemoryLimit, &ValuePlug::setCacheMemoryLimit };
+		caches["ValuePlug:hashCache"] = { &ValuePlug::getHashCacheSizeLimit, &ValuePlug::setHashCacheSizeLimit };
+		caches["ValuePlug:compressedCache"] = { &ValuePlug::getCompressedCacheMemoryLimit, &ValuePlug::setCompressedCacheMemoryLimit };
+	}
+
+	~State()
+	{
+		setEnabled( false );
+	}
+
+	// All members are protected by `mutex`.
+	std::mutex mutex;
+	std::map<string, Cache> caches;
+	bool enabled = false;
+	float lowPressure = 0.8f;
+	float highPressure = 0.95f;
+	float minimumScale = 0.1f;
+	float growthRate = 0.05f;
+	std::chrono::milliseconds updateInterval = std::chrono::milliseconds( 1000 );
+	float scale = 1.0f;
+	std::thread thread;
+	std::condition_variable condition;
+
+	void setEnabled( bool e )
+	{
+		std::thread toJoin;
+		{
+			std::unique_lock<std::mutex> lock( mutex );
+			if( e == enabled )
+			{
+				return;
+			}
+			enabled = e;
+			scale = 1.0f;
+			if( enabled )
+			{
+				for( auto &[name, cache] : caches )
+				{
+					captureMaximum( cache );
+				}
+				thread = std::thread( [this] { threadFunction(); } );
+			}
+			else
+			{
+				const MemoryStatistics statistics = memoryStatistics();
+				for( auto &[name, cache] : caches )
+				{
+					applyLimit( name, cache, maximum( cache, statistics ) );
+				}
+				toJoin = std::move( thread );
+			}
+		}
+
+		if( toJoin.joinable() )
+		{
+			condition.notify_all();
+			toJoin.join();
+		}
+	}
+
+	void captureMaximum( Cache &cache )
+	{
+		if( !cache.explicitMaximum )
+		{
+			cache.maximum = cache.getter();
+		}
+		cache.applied = cache.getter();
+	}
+
+	size_t maximum( const Cache &cache, const MemoryStatistics &statistics ) const
+	{
+		if( cache.maximumFraction > 0.0f && statistics.limit )
+		{
+			return (size_t)( (double)cache.maximumFraction * (double)statistics.limit );
+		}
+		return cache.maximum;
+	}
+
+	void applyLimit( const string &name, Cache &cache, size_t limit )
+	{
+		if( limit == cache.applied )
+		{
+			return;
+		}
+		try
+		{
+			cache.setter( limit );
+			cache.applied = limit;
+		}
+		catch( const std::exception &e )
+		{
+			IECore::msg( IECore::Msg::Error, "MemoryGovernor", fmt::format( "Setting limit for \"{}\" : {}", name, e.what() ) );
+		}
+	}
+
+	// Must be called with `mutex` locked.
+	float update( const MemoryStatistics &statistics )
+	{
+		if( !enabled )
+		{
+			return scale;
+		}
+
+		float targetScale = 1.0f;
+		if( statistics.limit )
+		{
+			const float pressure = (float)( (double)statistics.used / (double)statistics.limit );
+			const float t = std::clamp( ( pressure - lowPressure ) / std::max( highPressure - lowPressure, 1e-6f ), 0.0f, 1.0f );
+			targetScale = 1.0f + t * ( minimumScale - 1.0f );
+		}
+
+		if( targetScale < scale )
+		{
+			scale = targetScale;
+		}
+		else
+		{
+			scale = std::min( targetScale, scale + growthRate );
+		}
+
+		for( auto &[name, cache] : caches )
+		{
+			const size_t max = maximum( cache, statistics );
+			size_t limit = max;
+			if( scale < 1.0f && max )
+			{
+				limit = std::max<size_t>( 1, (size_t)std::llround( (double)max * scale ) );
+			}
+
+			// Avoid churning through tiny adjustments, since some setters
+			// have side effects beyond updating a number. We always apply
+			// an exact return to the maximum though.
+			const size_t difference = limit > cache.applied ? limit - cache.applied : cache.applied - limit;
+			if( limit == max || difference > cache.applied / 100 )
+			{
+				applyLimit( name, cache, limit );
+			}
+		}
+
+		return scale;
+	}
+
+	void threadFunction()
+	{
+		std::unique_lock<std::mutex> lock( mutex );
+		while( enabled )
+		{
+			condition.wait_for( lock, updateInterval, [this] { return !enabled; } );
+			if( !enabled )
+			{
+				break;
+			}
+			// Sampling involves file IO, so we don't hold the lock
+			// while doing it.
+			lock.unlock();
+			const MemoryStatistics statistics = memoryStatistics();
+			lock.lock();
+			update( statistics );
+		}
+	}
+
+};
+
+State &state()
+{
+	static State g_state;
+	return g_state;
+}
+
+Cache &cache( State &s, const string &name )
+{
+	auto it = s.caches.find( name );
+	if( it == s.caches.end() )
+	{
+		throw IECore::Exception( fmt::format( "Cache \"{}\" is not registered", name ) );
+	}
+	return it->second;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Public API
+//////////////////////////////////////////////////////////////////////////
+
+void MemoryGovernor::registerCache( const std::string &name, const LimitGetter &getter, const LimitSetter &setter )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	Cache &c = s.caches[name];
+	c = Cache();
+	c.getter = getter;
+	c.setter = setter;
+	if( s.enabled )
+	{
+		s.captureMaximum( c );
+	}
+}
+
+void MemoryGovernor::deregisterCache( const std::string &name )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	auto it = s.caches.find( name );
+	if( it == s.caches.end() )
+	{
+		return;
+	}
+	if( s.enabled )
+	{
+		// Hand the cache back in the state we found it.
+		s.applyLimit( name, it->second, s.maximum( it->second, memoryStatistics() ) );
+	}
+	s.caches.erase( it );
+}
+
+std::vector<std::string> MemoryGovernor::registeredCaches()
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	std::vector<std::string> result;
+	for( const auto &[name, cache] : s.caches )
+	{
+		result.push_back( name );
+	}
+	return result;
+}
+
+void MemoryGovernor::setMaximumLimit( const std::string &name, size_t limit )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	Cache &c = cache( s, name );
+	c.maximum = limit;
+	c.explicitMaximum = true;
+	c.maximumFraction = 0.0f;
+}
+
+void MemoryGovernor::setMaximumLimitFraction( const std::string &name, float fraction )
+{
+	if( fraction < 0.0f || fraction > 1.0f )
+	{
+		throw IECore::Exception( fmt::format( "Invalid fraction {} (must be in the range [0, 1])", fraction ) );
+	}
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	cache( s, name ).maximumFraction = fraction;
+}
+
+size_t MemoryGovernor::getMaximumLimit( const std::string &name )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	Cache &c = cache( s, name );
+	if( c.maximumFraction > 0.0f )
+	{
+		return s.maximum( c, memoryStatistics() );
+	}
+	if( !s.enabled && !c.explicitMaximum )
+	{
+		return c.getter();
+	}
+	return c.maximum;
+}
+
+void MemoryGovernor::setPressureThresholds( float low, float high )
+{
+	if( low < 0.0f || high <= low )
+	{
+		throw IECore::Exception( fmt::format( "Invalid pressure thresholds {}, {}", low, high ) );
+	}
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	s.lowPressure = low;
+	s.highPressure = high;
+}
+
+void MemoryGovernor::getPressureThresholds( float &low, float &high )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	low = s.lowPressure;
+	high = s.highPressure;
+}
+
+void MemoryGovernor::setMinimumScale( float minimumScale )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	s.minimumScale = std::clamp( minimumScale, 0.0f, 1.0f );
+}
+
+float MemoryGovernor::getMinimumScale()
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	return s.minimumScale;
+}
+
+void MemoryGovernor::setGrowthRate( float scalePerUpdate )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	s.growthRate = std::max( scalePerUpdate, 0.0f );
+}
+
+float MemoryGovernor::getGrowthRate()
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	return s.growthRate;
+}
+
+void MemoryGovernor::setEnabled( bool enabled )
+{
+	state().setEnabled( enabled );
+}
+
+bool MemoryGovernor::getEnabled()
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	return s.enabled;
+}
+
+void MemoryGovernor::setUpdateInterval( std::chrono::milliseconds interval )
+{
+	State &s = state();
+	{
+		std::unique_lock<std::mutex> lock( s.mutex );
+		s.updateInterval = interval;
+	}
+	s.condition.notify_all();
+}
+
+std::chrono::milliseconds MemoryGovernor::getUpdateInterval()
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	return s.updateInterval;
+}
+
+float MemoryGovernor::update()
+{
+	return update( memoryStatistics() );
+}
+
+float MemoryGovernor::update( const MemoryStatistics &statistics )
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	return s.update( statistics );
+}
+
+float MemoryGovernor::getScale()
+{
+	State &s = state();
+	std::unique_lock<std::mutex> lock( s.mutex );
+	return s.scale;
+}
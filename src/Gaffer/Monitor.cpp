@@ -119,6 +119,17 @@ const Monitor::MonitorSet &Monitor::current()
 	return *ThreadState::current().m_monitors;
 }
 
+void Monitor::collaborationStarted( const Process *process, bool cycleFallback )
+{
+}
+
+void Monitor::collaborationWaitStarted()
+{
+}
+
+void Monitor::collaborationWaitFinished( const IECore::InternedString &processType, const Plug *plug )
+{
+}
 
 bool Monitor::mightForceMonitoring()
 {
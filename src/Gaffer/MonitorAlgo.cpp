@@ -204,6 +204,102 @@ struct HashesPerComputeMetric
 
 };
 
+struct CollaborationCountMetric
+{
+
+	using ResultType = size_t;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.collaborationCount;
+	}
+
+	const std::string description = "number of collaborative processes";
+	const std::string annotation = "performanceMonitor:collaborationCount";
+	const std::string annotationPrefix = "Collaboration count : ";
+
+};
+
+struct CycleFallbackCountMetric
+{
+
+	using ResultType = size_t;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.cycleFallbackCount;
+	}
+
+	const std::string description = "number of redundant processes run to avoid collaboration cycles";
+	const std::string annotation = "performanceMonitor:cycleFallbackCount";
+	const std::string annotationPrefix = "Cycle fallback count : ";
+
+};
+
+struct WaitCountMetric
+{
+
+	using ResultType = size_t;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.waitCount;
+	}
+
+	const std::string description = "number of waits for collaborative processes";
+	const std::string annotation = "performanceMonitor:waitCount";
+	const std::string annotationPrefix = "Wait count : ";
+
+};
+
+struct WaitDurationMetric
+{
+
+	using ResultType = boost::chrono::duration<double>;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.waitDuration;
+	}
+
+	const std::string description = "time spent waiting for collaborative processes";
+	const std::string annotation = "performanceMonitor:waitDuration";
+	const std::string annotationPrefix = "Wait time : ";
+
+};
+
+struct WaitsPerCollaborationMetric
+{
+
+	using ResultType = double;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return static_cast<double>( s.waitCount ) / std::max( 1.0, static_cast<double>( s.collaborationCount ) );
+	}
+
+	const std::string description = "number of waiting threads per collaborative process";
+	const std::string annotation = "performanceMonitor:waitsPerCollaboration";
+	const std::string annotationPrefix = "Waits per collaboration : ";
+
+};
+
+struct StolenCountMetric
+{
+
+	using ResultType = size_t;
+
+	ResultType operator() ( const PerformanceMonitor::Statistics &s ) const
+	{
+		return s.stolenCount;
+	}
+
+	const std::string description = "number of processes run by threads waiting for collaborative processes";
+	const std::string annotation = "performanceMonitor:stolenCount";
+	const std::string annotationPrefix = "Stolen process count : ";
+
+};
+
 // Utility for invoking a templated functor with a particular metric.
 template<typename F>
 std::result_of_t<F(const HashCountMetric &)> dispatchMetric( const F &f, MonitorAlgo::PerformanceMetric performanceMetric )
@@ -226,6 +322,18 @@ std::result_of_t<F(const HashCountMetric &)> dispatchMetric( const F &f, Monitor
 			return f( PerComputeDurationMetric() );
 		case MonitorAlgo::HashesPerCompute :
 			return f( HashesPerComputeMetric() );
+		case MonitorAlgo::CollaborationCount :
+			return f( CollaborationCountMetric() );
+		case MonitorAlgo::CycleFallbackCount :
+			return f( CycleFallbackCountMetric() );
+		case MonitorAlgo::WaitCount :
+			return f( WaitCountMetric() );
+		case MonitorAlgo::WaitDuration :
+			return f( WaitDurationMetric() );
+		case MonitorAlgo::WaitsPerCollaboration :
+			return f( WaitsPerCollaborationMetric() );
+		case MonitorAlgo::StolenCount :
+			return f( StolenCountMetric() );
 		default :
 			return f( InvalidMetric() );
 	}
@@ -49,8 +49,13 @@ static PerformanceMonitor::Statistics g_emptyStatistics;
 // PerformanceMonitor::Statistics
 //////////////////////////////////////////////////////////////////////////
 
-PerformanceMonitor::Statistics::Statistics( size_t hashCount, size_t computeCount, boost::chrono::nanoseconds hashDuration, boost::chrono::nanoseconds computeDuration )
-	:	hashCount( hashCount ), computeCount( computeCount ), hashDuration( hashDuration ), computeDuration( computeDuration )
+PerformanceMonitor::Statistics::Statistics(
+	size_t hashCount, size_t computeCount, boost::chrono::nanoseconds hashDuration, boost::chrono::nanoseconds computeDuration,
+	size_t collaborationCount, size_t cycleFallbackCount, size_t waitCount, boost::chrono::nanoseconds waitDuration, size_t stolenCount
+)
+	:	hashCount( hashCount ), computeCount( computeCount ), hashDuration( hashDuration ), computeDuration( computeDuration ),
+		collaborationCount( collaborationCount ), cycleFallbackCount( cycleFallbackCount ), waitCount( waitCount ),
+		waitDuration( waitDuration ), stolenCount( stolenCount )
 {
 }
 
@@ -60,6 +65,11 @@ PerformanceMonitor::Statistics & PerformanceMonitor::Statistics::operator += ( c
 	computeCount += rhs.computeCount;
 	hashDuration += rhs.hashDuration;
 	computeDuration += rhs.computeDuration;
+	collaborationCount += rhs.collaborationCount;
+	cycleFallbackCount += rhs.cycleFallbackCount;
+	waitCount += rhs.waitCount;
+	waitDuration += rhs.waitDuration;
+	stolenCount += rhs.stolenCount;
 	return *this;
 }
 
@@ -69,7 +79,12 @@ bool PerformanceMonitor::Statistics::operator == ( const Statistics &rhs )
 		hashCount == rhs.hashCount &&
 		computeCount == rhs.computeCount &&
 		hashDuration == rhs.hashDuration &&
-		computeDuration == rhs.computeDuration
+		computeDuration == rhs.computeDuration &&
+		collaborationCount == rhs.collaborationCount &&
+		cycleFallbackCount == rhs.cycleFallbackCount &&
+		waitCount == rhs.waitCount &&
+		waitDuration == rhs.waitDuration &&
+		stolenCount == rhs.stolenCount
 	;
 }
 
@@ -131,6 +146,11 @@ void PerformanceMonitor::processStarted( const Process *process )
 	}
 	threadData.then = now;
 
+	if( !threadData.waitStack.empty() )
+	{
+		threadData.waitStack.top().stolenCount++;
+	}
+
 	Statistics &s = threadData.statistics[process->plug()];
 	if( type == g_hashType )
 	{
@@ -159,6 +179,61 @@ void PerformanceMonitor::processFinished( const Process *process )
 	threadData.then = now;
 }
 
+void PerformanceMonitor::collaborationStarted( const Process *process, bool cycleFallback )
+{
+	const IECore::InternedString type = process->type();
+	if( type != g_hashType && type != g_computeType )
+	{
+		return;
+	}
+
+	Statistics &s = m_threadData.local().statistics[process->plug()];
+	s.collaborationCount++;
+	if( cycleFallback )
+	{
+		s.cycleFallbackCount++;
+	}
+}
+
+void PerformanceMonitor::collaborationWaitStarted()
+{
+	ThreadData &threadData = m_threadData.local();
+
+	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
+	if( !threadData.durationStack.empty() )
+	{
+		*(threadData.durationStack.top()) += now - threadData.then;
+	}
+	threadData.then = now;
+
+	// Bill the wait itself, but leave any processes started while
+	// waiting to bill their own durations.
+	threadData.waitStack.push( ThreadData::Wait() );
+	threadData.durationStack.push( &threadData.waitStack.top().duration );
+}
+
+void PerformanceMonitor::collaborationWaitFinished( const IECore::InternedString &processType, const Plug *plug )
+{
+	ThreadData &threadData = m_threadData.local();
+	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
+	*(threadData.durationStack.top()) += now - threadData.then;
+	threadData.durationStack.pop();
+	threadData.then = now;
+
+	const ThreadData::Wait wait = threadData.waitStack.top();
+	threadData.waitStack.pop();
+
+	if( processType != g_hashType && processType != g_computeType )
+	{
+		return;
+	}
+
+	Statistics &s = threadData.statistics[plug];
+	s.waitCount++;
+	s.waitDuration += wait.duration;
+	s.stolenCount += wait.stolenCount;
+}
+
 void PerformanceMonitor::collate() const
 {
 	tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance>::iterator it, eIt;
@@ -0,0 +1,430 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/Private/PersistentCache.h"
+
+#include "IECore/FileIndexedIO.h"
+#include "IECore/MessageHandler.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace IECore;
+using namespace Gaffer::Private;
+
+namespace
+{
+
+const IndexedIO::EntryID g_objectEntry( "object" );
+const std::string g_extension( ".fio" );
+
+std::string keyString( const MurmurHash &key )
+{
+	return fmt::format( "{:016x}{:016x}", key.h1(), key.h2() );
+}
+
+bool keyFromString( const std::string &s, MurmurHash &key )
+{
+	if( s.size() != 32 || s.find_first_not_of( "0123456789abcdef" ) != std::string::npos )
+	{
+		return false;
+	}
+	key = MurmurHash( std::stoull( s.substr( 0, 16 ), nullptr, 16 ), std::stoull( s.substr( 16 ), nullptr, 16 ) );
+	return true;
+}
+
+// Used to give temporary files names that are unique to this process.
+const uint64_t g_processId = std::random_device()();
+std::atomic_uint64_t g_tempFileCount( 0 );
+
+// Limits the memory held by objects awaiting writing, in case computes
+// outpace the disk.
+const size_t g_maxPendingMemory = 1024 * 1024 * 1024;
+
+} // namespace
+
+PersistentCache::PersistentCache( size_t maxSize )
+	:	m_maxSize( maxSize ), m_currentSize( 0 ),
+		m_pendingCount( 0 ), m_pendingMemory( 0 ), m_draining( false )
+{
+}
+
+PersistentCache::~PersistentCache()
+{
+	wait();
+}
+
+void PersistentCache::setDirectory( const std::filesystem::path &directory )
+{
+	// Complete writes to the old directory before switching.
+	wait();
+
+	std::lock_guard<std::mutex> lock( m_mutex );
+	if( directory == m_directory )
+	{
+		return;
+	}
+
+	m_directory = directory;
+	m_entries.clear();
+	m_keys.clear();
+	m_currentSize = 0;
+
+	if( m_directory.empty() )
+	{
+		return;
+	}
+
+	std::filesystem::create_directories( m_directory );
+
+	// Find any entries left by previous processes, and add them in order
+	// of their last access.
+
+	struct ExistingEntry
+	{
+		std::filesystem::file_time_type time;
+		MurmurHash key;
+		size_t size;
+	};
+	vector<ExistingEntry> existingEntries;
+
+	std::error_code ec;
+	for( std::filesystem::recursive_directory_iterator it( m_directory, ec ), eIt; it != eIt; it.increment( ec ) )
+	{
+		if( ec )
+		{
+			break;
+		}
+		if( !it->is_regular_file( ec ) || it->path().extension() != g_extension )
+		{
+			continue;
+		}
+		MurmurHash key;
+		if( !keyFromString( it->path().stem().string(), key ) )
+		{
+			continue;
+		}
+		existingEntries.push_back( { it->last_write_time( ec ), key, it->file_size( ec ) } );
+	}
+
+	std::sort(
+		existingEntries.begin(), existingEntries.end(),
+		[] ( const ExistingEntry &a, const ExistingEntry &b ) { return a.time < b.time; }
+	);
+
+	for( const auto &e : existingEntries )
+	{
+		addEntry( e.key, e.size );
+	}
+
+	limitSize();
+}
+
+std::filesystem::path PersistentCache::getDirectory() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return m_directory;
+}
+
+bool PersistentCache::enabled() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return !m_directory.empty();
+}
+
+void PersistentCache::setMaxSize( size_t bytes )
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	m_maxSize = bytes;
+	limitSize();
+}
+
+size_t PersistentCache::getMaxSize() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return m_maxSize;
+}
+
+size_t PersistentCache::currentSize() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return m_currentSize;
+}
+
+IECore::ConstObjectPtr PersistentCache::get( const IECore::MurmurHash &key )
+{
+	std::filesystem::path fileName;
+	bool adopt = false;
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		if( m_directory.empty() )
+		{
+			return nullptr;
+		}
+		fileName = path( key );
+		auto it = m_entries.find( key );
+		if( it == m_entries.end() )
+		{
+			// The entry may have been written by another process since
+			// we scanned the directory, so we must check the disk.
+			adopt = true;
+		}
+		else
+		{
+			// Move to the most recently used position.
+			m_keys.splice( m_keys.end(), m_keys, it->second.position );
+		}
+	}
+
+	size_t size = 0;
+	if( adopt )
+	{
+		std::error_code ec;
+		size = std::filesystem::file_size( fileName, ec );
+		if( ec )
+		{
+			return nullptr;
+		}
+	}
+
+	// Load the object without holding the mutex, so that
+	// other threads can access the cache concurrently.
+
+	try
+	{
+		ConstIndexedIOPtr io = new FileIndexedIO( fileName.string(), IndexedIO::rootPath, IndexedIO::Read );
+		ConstObjectPtr result = Object::load( io, g_objectEntry );
+		// Record the access for the benefit of other processes.
+		std::error_code ec;
+		std::filesystem::last_write_time( fileName, std::filesystem::file_time_type::clock::now(), ec );
+
+		if( adopt )
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			if( m_entries.find( key ) == m_entries.end() && path( key ) == fileName )
+			{
+				addEntry( key, size );
+				limitSize();
+			}
+		}
+
+		return result;
+	}
+	catch( ... )
+	{
+		// The file may have been evicted by another process sharing
+		// the same directory, or may be corrupt. Either way, we treat
+		// it as a miss.
+		std::lock_guard<std::mutex> lock( m_mutex );
+		auto it = m_entries.find( key );
+		if( it != m_entries.end() && path( key ) == fileName )
+		{
+			removeEntry( it, /* removeFile = */ true );
+		}
+		return nullptr;
+	}
+}
+
+bool PersistentCache::set( const IECore::MurmurHash &key, const IECore::ConstObjectPtr &object )
+{
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		if( m_directory.empty() || m_entries.find( key ) != m_entries.end() )
+		{
+			return false;
+		}
+	}
+
+	const size_t memory = object->memoryUsage();
+	if( m_pendingMemory.fetch_add( memory ) + memory > g_maxPendingMemory )
+	{
+		m_pendingMemory -= memory;
+		return false;
+	}
+
+	m_pendingCount++;
+	m_pending.push( Pending{ key, object, memory } );
+
+	if( !m_draining.exchange( true ) )
+	{
+		// The drain task counts as pending itself, so that `wait()`
+		// also waits for it to finish with us.
+		m_pendingCount++;
+		m_arena.enqueue( [this] { drain(); } );
+	}
+
+	return true;
+}
+
+void PersistentCache::wait()
+{
+	// Help with the work rather than just waiting for it.
+	Pending pending;
+	while( m_pending.try_pop( pending ) )
+	{
+		write( pending );
+	}
+
+	// Wait for `drain()` to finish with any object it popped before
+	// we got here.
+	while( m_pendingCount )
+	{
+		std::this_thread::yield();
+	}
+}
+
+void PersistentCache::clear()
+{
+	wait();
+
+	std::lock_guard<std::mutex> lock( m_mutex );
+	while( !m_entries.empty() )
+	{
+		removeEntry( m_entries.begin(), /* removeFile = */ true );
+	}
+}
+
+void PersistentCache::drain()
+{
+	do
+	{
+		Pending pending;
+		while( m_pending.try_pop( pending ) )
+		{
+			write( pending );
+		}
+		m_draining = false;
+		// An object may have been pushed after we found the queue empty but
+		// before we reset `m_draining`, in which case nobody else will
+		// have scheduled a drain for it.
+	} while( !m_pending.empty() && !m_draining.exchange( true ) );
+
+	m_pendingCount--;
+}
+
+void PersistentCache::write( const Pending &pending )
+{
+	std::filesystem::path fileName;
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		if( !m_directory.empty() && m_entries.find( pending.key ) == m_entries.end() )
+		{
+			fileName = path( pending.key );
+		}
+	}
+
+	// Write the object without holding the mutex. We write to a temporary
+	// file and then rename it, so that other threads and processes never see
+	// a partially written file.
+
+	size_t size = 0;
+	if( !fileName.empty() )
+	{
+		try
+		{
+			std::filesystem::create_directories( fileName.parent_path() );
+			std::filesystem::path tempFileName = fileName;
+			tempFileName += fmt::format( ".{:x}.{}.tmp", g_processId, g_tempFileCount++ );
+			{
+				IndexedIOPtr io = new FileIndexedIO( tempFileName.string(), IndexedIO::rootPath, IndexedIO::Write );
+				pending.object->save( io, g_objectEntry );
+			}
+			std::filesystem::rename( tempFileName, fileName );
+			size = std::filesystem::file_size( fileName );
+		}
+		catch( const std::exception &e )
+		{
+			IECore::msg( IECore::Msg::Warning, "PersistentCache", fmt::format( "Failed to write \"{}\" : {}", fileName.string(), e.what() ) );
+			fileName.clear();
+		}
+	}
+
+	if( !fileName.empty() )
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		if( m_entries.find( pending.key ) == m_entries.end() && path( pending.key ) == fileName )
+		{
+			addEntry( pending.key, size );
+			limitSize();
+		}
+	}
+
+	m_pendingMemory -= pending.memory;
+	m_pendingCount--;
+}
+
+std::filesystem::path PersistentCache::path( const IECore::MurmurHash &key ) const
+{
+	if( m_directory.empty() )
+	{
+		return std::filesystem::path();
+	}
+	const std::string s = keyString( key );
+	return m_directory / s.substr( 0, 2 ) / ( s + g_extension );
+}
+
+void PersistentCache::addEntry( const IECore::MurmurHash &key, size_t size )
+{
+	auto position = m_keys.insert( m_keys.end(), key );
+	m_entries[key] = { size, position };
+	m_currentSize += size;
+}
+
+void PersistentCache::removeEntry( EntryMap::iterator it, bool removeFile )
+{
+	if( removeFile )
+	{
+		std::error_code ec;
+		std::filesystem::remove( path( it->first ), ec );
+	}
+	m_currentSize -= it->second.size;
+	m_keys.erase( it->second.position );
+	m_entries.erase( it );
+}
+
+void PersistentCache::limitSize()
+{
+	while( m_currentSize > m_maxSize && !m_keys.empty() )
+	{
+		removeEntry( m_entries.find( m_keys.front() ), /* removeFile = */ true );
+	}
+}
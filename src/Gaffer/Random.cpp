@@ -294,11 +294,10 @@ unsigned long int Random::computeSeed( const Context *context ) const
 	if( seedVariable.size() )
 	{
 		// \todo:  It is wasteful to call getAsData, allocating a fresh data here.
-		// We should be able to just use `seed += context->variableHash( contextEntry ).h1()`,
-		// however this would yield inconsistent hashes due to variableHash including the
-		// entry name as the address of an internal string.  If we come up with a way to do
-		// fast consistent hashes of InternedString ( ie. the proposal of storing a hash in
-		// the InternedString table ) then we should switch this to the less wasteful version
+		// Now that `variableHash()` hashes the characters of the variable name rather
+		// than its address, we could just use `seed += context->variableHash( contextEntry ).h1()`.
+		// But that would change the values generated for existing scripts, so should
+		// wait for a major version.
 		IECore::DataPtr contextData = context->getAsData( seedVariable, nullptr );
 		if( contextData )
 		{
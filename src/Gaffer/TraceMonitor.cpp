@@ -0,0 +1,286 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/TraceMonitor.h"
+
+#include "Gaffer/Context.h"
+#include "Gaffer/Plug.h"
+#include "Gaffer/Process.h"
+#include "Gaffer/ScriptNode.h"
+#include "Gaffer/ThreadMonitor.h"
+
+#include "IECore/Exception.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <fstream>
+
+using namespace Gaffer;
+
+namespace
+{
+
+void writeEscaped( std::ostream &o, const std::string &s )
+{
+	for( char c : s )
+	{
+		switch( c )
+		{
+			case '"' :
+				o << "\\\"";
+				break;
+			case '\\' :
+				o << "\\\\";
+				break;
+			default :
+				if( static_cast<unsigned char>( c ) < 0x20 )
+				{
+					o << fmt::format( "\\u{:04x}", static_cast<int>( c ) );
+				}
+				else
+				{
+					o << c;
+				}
+		}
+	}
+}
+
+std::string plugName( const Plug *plug )
+{
+	// Omit the ScriptNode name so that names match those displayed in the UI.
+	const ScriptNode *script = plug->ancestor<ScriptNode>();
+	return plug->relativeName( script );
+}
+
+} // namespace
+
+TraceMonitor::ThreadData::ThreadData()
+	:	id( ThreadMonitor::thisThreadId() ), next( 0 )
+{
+}
+
+TraceMonitor::TraceMonitor( const std::vector<IECore::InternedString> &processMask, size_t eventsPerThread )
+	:	m_processMask( processMask ), m_eventsPerThread( std::max( eventsPerThread, (size_t)1 ) ), m_startTime( Clock::now() )
+{
+}
+
+TraceMonitor::~TraceMonitor()
+{
+}
+
+size_t TraceMonitor::numEvents() const
+{
+	size_t result = 0;
+	for( const auto &threadData : m_threadData )
+	{
+		result += threadData.events.size();
+	}
+	return result;
+}
+
+void TraceMonitor::writeChromeTrace( const std::filesystem::path &fileName ) const
+{
+	std::ofstream f( fileName );
+	if( !f.good() )
+	{
+		throw IECore::IOException( "Unable to open file \"" + fileName.string() + "\"" );
+	}
+
+	auto microseconds = [this] ( Clock::time_point t ) {
+		return std::chrono::duration<double, std::micro>( t - m_startTime ).count();
+	};
+
+	f << "{\"traceEvents\":[\n";
+	bool first = true;
+	for( const auto &threadData : m_threadData )
+	{
+		f << ( first ? "" : ",\n" );
+		f << fmt::format( "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":\"Thread {0}\"}}}}", threadData.id );
+		first = false;
+
+		// Write in chronological order, starting from the oldest event in the ring.
+		const size_t size = threadData.events.size();
+		for( size_t i = 0; i < size; ++i )
+		{
+			const Event &event = threadData.events[(threadData.next + i) % size];
+			f << ",\n{\"name\":\"";
+			writeEscaped( f, threadData.plugNames.at( event.plug ) );
+			f << "\",\"cat\":\"";
+			switch( event.type )
+			{
+				case Event::Type::Process :
+					writeEscaped( f, event.processType.string() );
+					f << fmt::format(
+						"\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"contextHash\":\"{}\"}}}}",
+						threadData.id, microseconds( event.begin ), microseconds( event.end ) - microseconds( event.begin ),
+						event.contextHash.toString()
+					);
+					break;
+				case Event::Type::Collaboration :
+				case Event::Type::CycleFallback :
+					writeEscaped( f, event.processType.string() );
+					f << fmt::format(
+						"\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"args\":{{\"contextHash\":\"{}\",\"collaboration\":true,\"cycleFallback\":{}}}}}",
+						threadData.id, microseconds( event.begin ), event.contextHash.toString(),
+						event.type == Event::Type::CycleFallback
+					);
+					break;
+				case Event::Type::CollaborationWait :
+					f << "collaborationWait\",\"args\":{\"processType\":\"";
+					writeEscaped( f, event.processType.string() );
+					f << fmt::format(
+						"\"}},\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+						threadData.id, microseconds( event.begin ), microseconds( event.end ) - microseconds( event.begin )
+					);
+					break;
+			}
+		}
+	}
+	f << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	if( !f.good() )
+	{
+		throw IECore::IOException( "Failed to write to \"" + fileName.string() + "\"" );
+	}
+}
+
+void TraceMonitor::clear()
+{
+	m_threadData.clear();
+}
+
+bool TraceMonitor::recording( const IECore::InternedString &processType ) const
+{
+	return m_processMask.empty() || std::find( m_processMask.begin(), m_processMask.end(), processType ) != m_processMask.end();
+}
+
+void TraceMonitor::record( ThreadData &threadData, const Event &event ) const
+{
+	// We resolve the plug name now rather than holding a reference to the
+	// plug, which would keep it alive and add refcounting overhead to
+	// every event. But we only need to do so once per plug.
+	auto [it, inserted] = threadData.plugNames.try_emplace( event.plug );
+	if( inserted )
+	{
+		it->second = plugName( event.plug );
+	}
+
+	if( threadData.events.size() < m_eventsPerThread )
+	{
+		threadData.events.push_back( event );
+	}
+	else
+	{
+		threadData.events[threadData.next] = event;
+		threadData.next = ( threadData.next + 1 ) % m_eventsPerThread;
+	}
+}
+
+void TraceMonitor::processStarted( const Process *process )
+{
+	if( !recording( process->type() ) )
+	{
+		return;
+	}
+
+	m_threadData.local().stack.push_back( Clock::now() );
+}
+
+void TraceMonitor::processFinished( const Process *process )
+{
+	if( !recording( process->type() ) )
+	{
+		return;
+	}
+
+	const Clock::time_point end = Clock::now();
+	ThreadData &threadData = m_threadData.local();
+	if( threadData.stack.empty() )
+	{
+		// Process started before the monitor was made active.
+		return;
+	}
+
+	record( threadData, { Event::Type::Process, process->plug(), process->type(), process->context()->hash(), threadData.stack.back(), end } );
+	threadData.stack.pop_back();
+}
+
+void TraceMonitor::collaborationStarted( const Process *process, bool cycleFallback )
+{
+	if( !recording( process->type() ) )
+	{
+		return;
+	}
+
+	const Clock::time_point now = Clock::now();
+	record(
+		m_threadData.local(),
+		{
+			cycleFallback ? Event::Type::CycleFallback : Event::Type::Collaboration,
+			process->plug(), process->type(), process->context()->hash(), now, now
+		}
+	);
+}
+
+void TraceMonitor::collaborationWaitStarted()
+{
+	// We don't know the process type until the wait is finished, so
+	// must push unconditionally.
+	m_threadData.local().stack.push_back( Clock::now() );
+}
+
+void TraceMonitor::collaborationWaitFinished( const IECore::InternedString &processType, const Plug *plug )
+{
+	const Clock::time_point end = Clock::now();
+	ThreadData &threadData = m_threadData.local();
+	if( threadData.stack.empty() )
+	{
+		// Wait started before the monitor was made active.
+		return;
+	}
+
+	const Clock::time_point begin = threadData.stack.back();
+	threadData.stack.pop_back();
+
+	if( !plug || !recording( processType ) )
+	{
+		// Either the process failed to start, or it is masked out.
+		return;
+	}
+
+	record( threadData, { Event::Type::CollaborationWait, plug, processType, IECore::MurmurHash(), begin, end } );
+}
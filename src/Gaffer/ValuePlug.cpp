@@ -40,18 +40,31 @@
 #include "Gaffer/Action.h"
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/Private/CompressedCache.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
+#include "Gaffer/Private/PersistentCache.h"
 #include "Gaffer/Process.h"
+#include "Gaffer/Version.h"
 
 #include "IECore/MessageHandler.h"
 
 #include "boost/bind/bind.hpp"
+#include "boost/noncopyable.hpp"
 
+#include "tbb/concurrent_hash_map.h"
 #include "tbb/enumerable_thread_specific.h"
+#include "tbb/spin_rw_mutex.h"
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 #include <unordered_set>
 
 using namespace Gaffer;
@@ -147,6 +160,383 @@ size_t tbb_hasher( const HashCacheKey &key )
 	return hash_value( key );
 }
 
+// A single hash cache shared by all threads, used by `HashCacheMode::Global`.
+// Rather than use a lock per bin like the LRUCache, this is an open-addressed
+// table of fixed-size slots, each protected by a sequence lock. Lookups never
+// block : they just retry if they observe a concurrent write, and treat a slot
+// that is still being written as a miss. Insertions claim a slot using a
+// compare-and-swap and simply give up if another thread is writing to it,
+// which is perfectly acceptable for a cache. Eviction uses the CLOCK algorithm
+// within the probe window for each key.
+//
+// Clearing or resizing replaces the table wholesale. Old tables are retired
+// and only deleted once no thread can still be reading from them, using a
+// simple epoch-based reclamation scheme.
+class SharedHashCache : boost::noncopyable
+{
+
+	public :
+
+		SharedHashCache( size_t maxEntries )
+			:	m_table( nullptr ), m_epoch( 1 ), m_capacity( capacity( maxEntries ) )
+		{
+		}
+
+		~SharedHashCache()
+		{
+			delete m_table.load();
+			for( auto &r : m_retired )
+			{
+				delete r.second;
+			}
+		}
+
+		std::optional<IECore::MurmurHash> get( const HashCacheKey &key )
+		{
+			ReadScope scope( *this );
+			Table *table = scope.table();
+			if( !table )
+			{
+				return std::nullopt;
+			}
+
+			const size_t h = hash_value( key );
+			uint64_t words[g_numWords];
+			for( size_t i = 0; i < g_probeLength; ++i )
+			{
+				Slot &slot = table->slots[(h + i) & table->mask];
+				if( !read( slot, words ) )
+				{
+					continue;
+				}
+				if( !words[0] )
+				{
+					// Empty slot. We never remove entries except by
+					// replacing the whole table, so the key can't be
+					// any further along the probe sequence.
+					return std::nullopt;
+				}
+				if( matches( words, key ) )
+				{
+					if( !slot.referenced.load( std::memory_order_relaxed ) )
+					{
+						slot.referenced.store( 1, std::memory_order_relaxed );
+					}
+					return IECore::MurmurHash( words[4], words[5] );
+				}
+			}
+			return std::nullopt;
+		}
+
+		void set( const HashCacheKey &key, const IECore::MurmurHash &value )
+		{
+			ReadScope scope( *this );
+			Table *table = scope.table();
+			if( !table )
+			{
+				scope.release();
+				allocateTable();
+				scope.acquire();
+				table = scope.table();
+			}
+
+			const size_t h = hash_value( key );
+			Slot *victim = nullptr;
+			uint64_t words[g_numWords];
+			for( size_t i = 0; i < g_probeLength; ++i )
+			{
+				Slot &slot = table->slots[(h + i) & table->mask];
+				if( !read( slot, words ) )
+				{
+					continue;
+				}
+				if( !words[0] )
+				{
+					victim = &slot;
+					break;
+				}
+				if( matches( words, key ) )
+				{
+					return;
+				}
+				if( !victim )
+				{
+					// CLOCK eviction : recently used entries get a second chance.
+					if( slot.referenced.load( std::memory_order_relaxed ) )
+					{
+						slot.referenced.store( 0, std::memory_order_relaxed );
+					}
+					else
+					{
+						victim = &slot;
+					}
+				}
+			}
+
+			if( !victim )
+			{
+				// Everything in the window was referenced, and we've
+				// just cleared all the reference bits, so the hand
+				// comes round to the start.
+				victim = &table->slots[h & table->mask];
+			}
+
+			uint64_t version = victim->version.load( std::memory_order_relaxed );
+			if( ( version & 1 ) || !victim->version.compare_exchange_strong( version, version + 1, std::memory_order_relaxed ) )
+			{
+				// Another thread is writing to the slot.
+				return;
+			}
+			std::atomic_thread_fence( std::memory_order_release );
+
+			const bool wasEmpty = !victim->words[0].load( std::memory_order_relaxed );
+			victim->words[0].store( reinterpret_cast<uint64_t>( key.plug ), std::memory_order_relaxed );
+			victim->words[1].store( key.contextHash.h1(), std::memory_order_relaxed );
+			victim->words[2].store( key.contextHash.h2(), std::memory_order_relaxed );
+			victim->words[3].store( key.dirtyCount, std::memory_order_relaxed );
+			victim->words[4].store( value.h1(), std::memory_order_relaxed );
+			victim->words[5].store( value.h2(), std::memory_order_relaxed );
+			victim->version.store( version + 2, std::memory_order_release );
+			victim->referenced.store( 1, std::memory_order_relaxed );
+
+			if( wasEmpty )
+			{
+				table->size.fetch_add( 1, std::memory_order_relaxed );
+			}
+		}
+
+		void setMaxEntries( size_t maxEntries )
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			const size_t c = capacity( maxEntries );
+			if( c == m_capacity )
+			{
+				return;
+			}
+			m_capacity = c;
+			if( m_table.load() )
+			{
+				replaceTableWhileLocked( new Table( m_capacity ) );
+			}
+		}
+
+		void clear()
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			if( m_table.load() )
+			{
+				// We don't allocate a new table until the
+				// next call to `set()`.
+				replaceTableWhileLocked( nullptr );
+			}
+		}
+
+		size_t size() const
+		{
+			ReadScope scope( *this );
+			const Table *table = scope.table();
+			return table ? std::min( table->size.load( std::memory_order_relaxed ), table->mask + 1 ) : 0;
+		}
+
+		// The table is allocated at full capacity, so this is independent
+		// of `size()`.
+		size_t memoryUsage() const
+		{
+			ReadScope scope( *this );
+			const Table *table = scope.table();
+			return table ? sizeof( Table ) + ( table->mask + 1 ) * sizeof( Slot ) : 0;
+		}
+
+	private :
+
+		static constexpr size_t g_probeLength = 8;
+		static constexpr size_t g_numWords = 6;
+
+		// Sized and aligned to occupy a single cache line, so that
+		// writes to one slot don't disturb readers of another.
+		struct alignas( 64 ) Slot
+		{
+			Slot()
+				:	version( 0 ), referenced( 0 )
+			{
+				for( auto &w : words )
+				{
+					w.store( 0, std::memory_order_relaxed );
+				}
+			}
+
+			// Odd while a write is in progress.
+			std::atomic<uint64_t> version;
+			// Plug, context hash (2 words), dirty count, value (2 words).
+			// A null plug denotes an empty slot.
+			std::atomic<uint64_t> words[g_numWords];
+			std::atomic<uint8_t> referenced;
+		};
+
+		static_assert( sizeof( Slot ) == 64, "Expected Slot to occupy a single cache line" );
+
+		struct Table
+		{
+			Table( size_t capacity )
+				:	mask( capacity - 1 ), slots( new Slot[capacity] ), size( 0 )
+			{
+			}
+
+			const size_t mask;
+			std::unique_ptr<Slot[]> slots;
+			// Number of non-empty slots.
+			std::atomic_size_t size;
+		};
+
+		// Returns the table capacity for the specified number of entries,
+		// rounded up to a power of two so that we can use a mask to index.
+		static size_t capacity( size_t maxEntries )
+		{
+			size_t result = g_probeLength;
+			while( result < maxEntries )
+			{
+				result *= 2;
+			}
+			return result;
+		}
+
+		static bool read( const Slot &slot, uint64_t *words )
+		{
+			for( int attempt = 0; attempt < 4; ++attempt )
+			{
+				const uint64_t version = slot.version.load( std::memory_order_acquire );
+				if( version & 1 )
+				{
+					continue;
+				}
+				for( size_t i = 0; i < g_numWords; ++i )
+				{
+					words[i] = slot.words[i].load( std::memory_order_relaxed );
+				}
+				std::atomic_thread_fence( std::memory_order_acquire );
+				if( slot.version.load( std::memory_order_relaxed ) == version )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		static bool matches( const uint64_t *words, const HashCacheKey &key )
+		{
+			return
+				words[0] == reinterpret_cast<uint64_t>( key.plug ) &&
+				words[1] == key.contextHash.h1() &&
+				words[2] == key.contextHash.h2() &&
+				words[3] == key.dirtyCount
+			;
+		}
+
+		// Epoch-based reclamation. While a thread is using a table, it
+		// publishes the global epoch it observed before loading the table
+		// pointer. A table retired at epoch `e` may be deleted once no thread
+		// is publishing an epoch earlier than `e`. ReadScopes are only held
+		// for the duration of a single table operation, and are never nested.
+
+		struct ThreadEpoch
+		{
+			std::atomic<uint64_t> epoch = { 0 };
+		};
+
+		class ReadScope : boost::noncopyable
+		{
+
+			public :
+
+				ReadScope( const SharedHashCache &cache )
+					:	m_cache( cache ), m_threadEpoch( cache.m_threadEpochs.local() )
+				{
+					acquire();
+				}
+
+				~ReadScope()
+				{
+					release();
+				}
+
+				void acquire()
+				{
+					m_threadEpoch.epoch.store( m_cache.m_epoch.load() );
+					m_table = m_cache.m_table.load();
+				}
+
+				void release()
+				{
+					m_threadEpoch.epoch.store( 0, std::memory_order_release );
+					m_table = nullptr;
+				}
+
+				Table *table() const
+				{
+					return m_table;
+				}
+
+			private :
+
+				const SharedHashCache &m_cache;
+				ThreadEpoch &m_threadEpoch;
+				Table *m_table;
+
+		};
+
+		void allocateTable()
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			if( !m_table.load() )
+			{
+				m_table.store( new Table( m_capacity ) );
+			}
+		}
+
+		void replaceTableWhileLocked( Table *table )
+		{
+			Table *oldTable = m_table.exchange( table );
+			const uint64_t retiredEpoch = m_epoch.fetch_add( 1 ) + 1;
+			if( oldTable )
+			{
+				m_retired.push_back( { retiredEpoch, oldTable } );
+			}
+
+			uint64_t minEpoch = std::numeric_limits<uint64_t>::max();
+			for( const auto &t : m_threadEpochs )
+			{
+				const uint64_t e = t.epoch.load();
+				if( e )
+				{
+					minEpoch = std::min( minEpoch, e );
+				}
+			}
+
+			auto it = std::remove_if(
+				m_retired.begin(), m_retired.end(),
+				[minEpoch] ( const std::pair<uint64_t, Table *> &r ) {
+					if( r.first <= minEpoch )
+					{
+						delete r.second;
+						return true;
+					}
+					return false;
+				}
+			);
+			m_retired.erase( it, m_retired.end() );
+		}
+
+		std::atomic<Table *> m_table;
+		std::atomic<uint64_t> m_epoch;
+		mutable tbb::enumerable_thread_specific<ThreadEpoch, tbb::cache_aligned_allocator<ThreadEpoch>, tbb::ets_key_per_instance> m_threadEpochs;
+
+		// Protects everything below.
+		std::mutex m_mutex;
+		size_t m_capacity;
+		std::vector<std::pair<uint64_t, Table *>> m_retired;
+
+};
+
 ValuePlug::HashCacheMode defaultHashCacheMode()
 {
 	/// \todo Remove
@@ -166,9 +556,13 @@ ValuePlug::HashCacheMode defaultHashCacheMode()
 		{
 			return ValuePlug::HashCacheMode::Standard;
 		}
+		else if( !strcmp( e, "Global" ) )
+		{
+			return ValuePlug::HashCacheMode::Global;
+		}
 		else
 		{
-			IECore::msg( IECore::Msg::Warning, "ValuePlug", "Invalid value for GAFFER_HASHCACHE_MODE. Must be Standard, Checked or Legacy." );
+			IECore::msg( IECore::Msg::Warning, "ValuePlug", "Invalid value for GAFFER_HASHCACHE_MODE. Must be Standard, Global, Checked or Legacy." );
 		}
 	}
 	return ValuePlug::HashCacheMode::Standard;
@@ -224,18 +618,25 @@ class ValuePlug::HashProcess : public Process
 				return HashProcess( p, plug, computeNode ).run();
 			}
 
-			// Perform any pending adjustments to our thread-local cache.
+			// Perform any pending adjustments to our thread-local cache. In
+			// `Global` mode, we use `g_sharedCache` instead, which needs no
+			// such maintenance.
 
-			ThreadData &threadData = g_threadData.local();
-			if( threadData.clearCache.load( std::memory_order_acquire ) )
+			const bool sharedCache = g_hashCacheMode == HashCacheMode::Global;
+			ThreadData *threadData = nullptr;
+			if( !sharedCache )
 			{
-				threadData.cache.clear();
-				threadData.clearCache.store( 0, std::memory_order_release );
-			}
+				threadData = &g_threadData.local();
+				if( threadData->clearCache.load( std::memory_order_acquire ) )
+				{
+					threadData->cache.clear();
+					threadData->clearCache.store( 0, std::memory_order_release );
+				}
 
-			if( threadData.cache.getMaxCost() != g_cacheSizeLimit )
-			{
-				threadData.cache.setMaxCost( g_cacheSizeLimit );
+				if( threadData->cache.getMaxCost() != g_cacheSizeLimit )
+				{
+					threadData->cache.setMaxCost( g_cacheSizeLimit );
+				}
 			}
 
 			// Then get our hash. We do this using this `acquireHash()` functor so that
@@ -254,10 +655,11 @@ class ValuePlug::HashProcess : public Process
 					throw IECore::Exception(  "Dirty count exceeded max. Either you've left Gaffer running for 100 million years, or a strange bug is incrementing dirty counts way too fast." );
 				}
 
-				// Check for an already-cached value in our thread-local cache, and return it if we have one.
+				// Check for an already-cached value in our thread-local (or shared) cache,
+				// and return it if we have one.
 				if( !forceMonitoring )
 				{
-					if( auto result = threadData.cache.getIfCached( cacheKey ) )
+					if( auto result = sharedCache ? g_sharedCache.get( cacheKey ) : threadData->cache.getIfCached( cacheKey ) )
 					{
 						return *result;
 					}
@@ -287,12 +689,19 @@ class ValuePlug::HashProcess : public Process
 					}
 				}
 				// Update local cache and return result
-				threadData.cache.setIfUncached( cacheKey, result, cacheCostFunction );
+				if( sharedCache )
+				{
+					g_sharedCache.set( cacheKey, result );
+				}
+				else
+				{
+					threadData->cache.setIfUncached( cacheKey, result, cacheCostFunction );
+				}
 				return result;
 			};
 
 			const HashCacheKey cacheKey( p, currentContext, p->m_dirtyCount );
-			if( g_hashCacheMode == HashCacheMode::Standard )
+			if( g_hashCacheMode == HashCacheMode::Standard || g_hashCacheMode == HashCacheMode::Global )
 			{
 				return acquireHash( cacheKey );
 			}
@@ -337,11 +746,13 @@ class ValuePlug::HashProcess : public Process
 		{
 			g_cacheSizeLimit = maxEntriesPerThread;
 			g_cache.setMaxCost( g_cacheSizeLimit );
+			g_sharedCache.setMaxEntries( g_cacheSizeLimit );
 		}
 
 		static void clearCache( bool now = false )
 		{
 			g_cache.clear();
+			g_sharedCache.clear();
 			// It's not documented explicitly, but it is safe to iterate over an
 			// `enumerable_thread_specific` while `local()` is being called on
 			// other threads, because the underlying container is a
@@ -368,18 +779,17 @@ class ValuePlug::HashProcess : public Process
 
 		static size_t totalCacheUsage()
 		{
-			size_t usage = g_cache.currentCost();
-			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
-			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
-			{
-				usage += it->cache.currentCost();
-			}
-			return usage;
+			return lruCacheUsage() + g_sharedCache.size();
+		}
+
+		static size_t totalCacheMemoryUsage()
+		{
+			return lruCacheUsage() * g_lruCacheEntryMemoryUsage + g_sharedCache.memoryUsage();
 		}
 
 		static void dirtyLegacyCache()
 		{
-			if( g_hashCacheMode != HashCacheMode::Standard )
+			if( g_hashCacheMode != HashCacheMode::Standard && g_hashCacheMode != HashCacheMode::Global )
 			{
 				uint64_t count = g_legacyGlobalDirtyCount;
 				uint64_t newCount;
@@ -447,6 +857,23 @@ class ValuePlug::HashProcess : public Process
 
 	private :
 
+		// Returns the number of entries in the LRUCaches used by all modes
+		// other than `HashCacheMode::Global`.
+		static size_t lruCacheUsage()
+		{
+			size_t usage = g_cache.currentCost();
+			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
+			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
+			{
+				usage += it->cache.currentCost();
+			}
+			return usage;
+		}
+
+		// Approximate memory used by each LRUCache entry, including the
+		// key, the value and the overhead of the cache's containers.
+		static constexpr size_t g_lruCacheEntryMemoryUsage = 200;
+
 		const ComputeNode *m_computeNode;
 
 		static std::atomic<uint64_t> g_legacyGlobalDirtyCount;
@@ -464,6 +891,7 @@ class ValuePlug::HashProcess : public Process
 
 		static tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance > g_threadData;
 		static std::atomic_size_t g_cacheSizeLimit;
+		static SharedHashCache g_sharedCache;
 
 };
 
@@ -471,11 +899,241 @@ const IECore::InternedString ValuePlug::HashProcess::staticType( ValuePlug::hash
 tbb::enumerable_thread_specific<ValuePlug::HashProcess::ThreadData, tbb::cache_aligned_allocator<ValuePlug::HashProcess::ThreadData>, tbb::ets_key_per_instance > ValuePlug::HashProcess::g_threadData;
 // Default limit corresponds to a cost of roughly 25Mb per thread.
 std::atomic_size_t ValuePlug::HashProcess::g_cacheSizeLimit( 128000 );
+SharedHashCache ValuePlug::HashProcess::g_sharedCache( g_cacheSizeLimit );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( CacheType::GetterFunction(), g_cacheSizeLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false );
 std::atomic<uint64_t> ValuePlug::HashProcess::g_legacyGlobalDirtyCount( 0 );
 ValuePlug::HashCacheMode ValuePlug::HashProcess::g_hashCacheMode( defaultHashCacheMode() );
 
+//////////////////////////////////////////////////////////////////////////
+// Optional per-node accounting for the compute cache. The cache itself
+// only knows about hashes, so when enabled we maintain a side table
+// mapping the hash for each cached result to the node that computed it.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+class ComputeCacheStatistics : boost::noncopyable
+{
+
+	public :
+
+		ComputeCacheStatistics()
+			:	m_enabled( false ), m_numEntries( 0 )
+		{
+		}
+
+		void setEnabled( bool enabled )
+		{
+			m_enabled = enabled;
+		}
+
+		bool getEnabled() const
+		{
+			return m_enabled.load( std::memory_order_relaxed );
+		}
+
+		void hit( const Node *node )
+		{
+			Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+			nodeStatistics( node, lock ).hits++;
+		}
+
+		void miss( const Node *node )
+		{
+			Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+			nodeStatistics( node, lock ).misses++;
+		}
+
+		// Accounts for a result that may have been stored in `cache`. With task
+		// collaboration, only the cache knows which thread stored a result, so
+		// this is called by every thread that receives one, and only the first
+		// call for each entry has any effect.
+		template<typename Cache>
+		void stored( const Cache &cache, const IECore::MurmurHash &hash, const Node *node )
+		{
+			// Reuse the cost the cache computed when storing the result, rather
+			// than calling `memoryUsage()` again. No cost means the result was
+			// never stored, because it exceeded the memory limit, or that it has
+			// been evicted already.
+			const std::optional<size_t> cost = cache.cost( hash );
+			if( !cost )
+			{
+				return;
+			}
+
+			{
+				Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+				// Must be called before we acquire the accessor, because it may
+				// need to reacquire the lock.
+				NodeStatistics &statistics = nodeStatistics( node, lock );
+				EntryMap::accessor accessor;
+				if( !m_entries.insert( accessor, hash ) )
+				{
+					return;
+				}
+				accessor->second.statistics = &statistics;
+				accessor->second.cost = *cost;
+				statistics.entries++;
+				statistics.memoryUsage += accessor->second.cost;
+				m_numEntries++;
+			}
+
+			// The result may have been evicted after we queried the cost but
+			// before we recorded it. We can only check this once we no longer
+			// hold the accessor, because the cache holds its own locks while
+			// calling `removed()`.
+			if( !cache.cached( hash ) )
+			{
+				erase( hash );
+			}
+		}
+
+		// Must be called whenever an entry is removed from the cache.
+		void removed( const IECore::MurmurHash &hash )
+		{
+			if( !m_numEntries.load( std::memory_order_relaxed ) )
+			{
+				return;
+			}
+			if( NodeStatistics *statistics = erase( hash ) )
+			{
+				statistics->evictions++;
+			}
+		}
+
+		ValuePlug::CacheStatisticsMap statistics() const
+		{
+			Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+			ValuePlug::CacheStatisticsMap result;
+			for( const auto &[key, statistics] : m_nodes )
+			{
+				// Several nodes may have had the same name over time, for
+				// instance if a node was deleted and recreated by undo/redo.
+				ValuePlug::CacheStatistics &s = result[statistics->nodeName];
+				s.nodeType = statistics->nodeType;
+				s.entries += statistics->entries;
+				s.memoryUsage += statistics->memoryUsage;
+				s.hits += statistics->hits;
+				s.misses += statistics->misses;
+				s.evictions += statistics->evictions;
+			}
+			return result;
+		}
+
+		void clear()
+		{
+			Mutex::scoped_lock lock( m_mutex, /* write = */ true );
+			for( auto it = m_nodes.begin(); it != m_nodes.end(); )
+			{
+				NodeStatistics &statistics = *it->second;
+				if( statistics.entries )
+				{
+					// Still referenced by `m_entries`, so we must keep it.
+					statistics.hits = 0;
+					statistics.misses = 0;
+					statistics.evictions = 0;
+					++it;
+				}
+				else
+				{
+					it = m_nodes.erase( it );
+				}
+			}
+		}
+
+	private :
+
+		// We don't hold references to the nodes themselves, as that would keep
+		// them alive long after they have been deleted from the graph. Instead
+		// we record the names needed for reporting when we first see a node.
+		struct NodeStatistics
+		{
+			NodeStatistics( const Node *node )
+				:	nodeName( node->fullName() ), nodeType( node->typeName() ),
+					entries( 0 ), memoryUsage( 0 ), hits( 0 ), misses( 0 ), evictions( 0 )
+			{
+			}
+
+			const std::string nodeName;
+			const std::string nodeType;
+			std::atomic_size_t entries;
+			std::atomic_size_t memoryUsage;
+			std::atomic_size_t hits;
+			std::atomic_size_t misses;
+			std::atomic_size_t evictions;
+		};
+
+		struct Entry
+		{
+			NodeStatistics *statistics;
+			size_t cost;
+		};
+
+		// Lock ordering is always `m_mutex` first, then `m_entries`.
+		using Mutex = tbb::spin_rw_mutex;
+		// Because we don't keep nodes alive, a node may be deleted and a new
+		// one allocated at the same address. Including the name in the key
+		// keeps their statistics separate in all but the rarest cases, while
+		// still being cheap to compute for every cache access.
+		using NodeKey = std::pair<const Node *, IECore::InternedString>;
+		using NodeMap = std::map<NodeKey, std::unique_ptr<NodeStatistics>>;
+		using EntryMap = tbb::concurrent_hash_map<IECore::MurmurHash, Entry>;
+
+		NodeStatistics &nodeStatistics( const Node *node, Mutex::scoped_lock &lock )
+		{
+			const NodeKey key( node, node->getName() );
+			auto it = m_nodes.find( key );
+			if( it != m_nodes.end() )
+			{
+				return *it->second;
+			}
+
+			// Construct without holding the lock, because `typeName()` will
+			// need to acquire the GIL for nodes implemented in Python.
+			lock.release();
+			auto statistics = std::make_unique<NodeStatistics>( node );
+			lock.acquire( m_mutex, /* write = */ true );
+			// Another thread may have inserted the node in the meantime,
+			// in which case we use theirs.
+			return *m_nodes.emplace( key, std::move( statistics ) ).first->second;
+		}
+
+		NodeStatistics *erase( const IECore::MurmurHash &hash )
+		{
+			Mutex::scoped_lock lock( m_mutex, /* write = */ false );
+			EntryMap::accessor accessor;
+			if( !m_entries.find( accessor, hash ) )
+			{
+				return nullptr;
+			}
+			NodeStatistics *statistics = accessor->second.statistics;
+			statistics->entries--;
+			statistics->memoryUsage -= accessor->second.cost;
+			m_entries.erase( accessor );
+			m_numEntries--;
+			return statistics;
+		}
+
+		std::atomic_bool m_enabled;
+		mutable Mutex m_mutex;
+		NodeMap m_nodes;
+		EntryMap m_entries;
+		std::atomic_size_t m_numEntries;
+
+};
+
+ComputeCacheStatistics &computeCacheStatistics()
+{
+	// Deliberately leaked, because it is accessed by `cacheRemovalCallback()`,
+	// which may be called during static destruction of the cache.
+	static ComputeCacheStatistics *g_statistics = new ComputeCacheStatistics;
+	return *g_statistics;
+}
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // The ComputeProcess manages the task of calling ComputeNode::compute()
 // and storing a cache of recently computed results.
@@ -505,9 +1163,42 @@ class ValuePlug::ComputeProcess : public Process
 
 		static void clearCache()
 		{
+			// Entries removed by clearing are discarded rather than being
+			// moved to the compressed cache, which is cleared too.
+			Private::CompressedCache::ClearScope compressedCacheClearScope( compressedCache() );
 			g_cache.clear();
 		}
 
+		static Private::CompressedCache &compressedCache()
+		{
+			// Deliberately leaked, because it is accessed by `cacheRemovalCallback()`,
+			// which may be called during destruction of `g_cache`.
+			static Private::CompressedCache *g_compressedCache = new Private::CompressedCache( 0 );
+			return *g_compressedCache;
+		}
+
+		static Private::PersistentCache &persistentCache()
+		{
+			static Private::PersistentCache g_persistentCache( 1024 * 1024 * 1024 * 10ull ); // 10 gigs
+			return g_persistentCache;
+		}
+
+		static std::atomic_size_t g_persistentCacheCostThreshold;
+
+		// Appended to the hash of each result to form its key in the persistent
+		// cache, so that entries are only shared between compatible processes.
+		static IECore::MurmurHash persistentKeySuffix()
+		{
+			std::lock_guard<std::mutex> lock( persistentKeySuffixMutex() );
+			return persistentKeySuffixInternal();
+		}
+
+		static void appendToPersistentKeySuffix( const IECore::MurmurHash &h )
+		{
+			std::lock_guard<std::mutex> lock( persistentKeySuffixMutex() );
+			persistentKeySuffixInternal().append( h );
+		}
+
 		static const IECore::Object *value( const ValuePlug *plug, IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash )
 		{
 			const ValuePlug *p = sourcePlug( plug );
@@ -569,16 +1260,47 @@ class ValuePlug::ComputeProcess : public Process
 			// > calling `getValueInternal()`.
 			const IECore::MurmurHash hash = precomputedHash ? *precomputedHash : p->ValuePlug::hash();
 
-			if( !Process::forceMonitoring( threadState, plug, staticType ) )
+			const Node *statisticsNode = computeCacheStatistics().getEnabled() ? p->node() : nullptr;
+
+			const bool forceMonitoring = Process::forceMonitoring( threadState, plug, staticType );
+			if( !forceMonitoring )
 			{
 				if( auto result = g_cache.getIfCached( hash ) )
 				{
+					if( statisticsNode )
+					{
+						computeCacheStatistics().hit( statisticsNode );
+					}
 					// Move avoids unnecessary additional addRef/removeRef.
 					owner = std::move( *result );
 					return owner.get();
 				}
 			}
 
+			if( statisticsNode )
+			{
+				computeCacheStatistics().miss( statisticsNode );
+			}
+
+			// The value may have been evicted to the compressed cache, in which
+			// case decompressing it is much cheaper than computing it again.
+
+			if( !forceMonitoring && p->typeId() == FloatVectorDataPlugTypeId && compressedCache().enabled() )
+			{
+				if( auto result = compressedCache().get( hash ) )
+				{
+					// We don't know the original compute duration, so the entry
+					// gets the lowest priority for cost-aware eviction.
+					g_cache.setIfUncached( hash, result, cacheCostFunction );
+					if( statisticsNode )
+					{
+						computeCacheStatistics().stored( g_cache, hash, statisticsNode );
+					}
+					owner = std::move( result );
+					return owner.get();
+				}
+			}
+
 			// The value isn't in the cache, so we'll need to compute it,
 			// taking account of the cache policy.
 
@@ -589,7 +1311,9 @@ class ValuePlug::ComputeProcess : public Process
 				// lightweight enough and unlikely enough to be shared that in
 				// the worst case it's OK to do it redundantly on a few threads
 				// before it gets cached.
+				const auto start = std::chrono::steady_clock::now();
 				owner = ComputeProcess( p, plug, computeNode ).run();
+				const auto duration = std::chrono::duration_cast<CacheType::Duration>( std::chrono::steady_clock::now() - start );
 				// Store the value in the cache, but only if it isn't there already.
 				// The check is useful because it's common for an upstream compute
 				// triggered by us to have already done the work, and calling
@@ -600,14 +1324,29 @@ class ValuePlug::ComputeProcess : public Process
 				// upstream node will already have computed the same result) and the
 				// attribute data itself consists of many small objects for which
 				// computing memory usage is slow.
-				g_cache.setIfUncached( hash, owner, cacheCostFunction );
+				g_cache.setIfUncached( hash, owner, cacheCostFunction, duration );
+				if( statisticsNode )
+				{
+					computeCacheStatistics().stored( g_cache, hash, statisticsNode );
+				}
 				return owner.get();
 			}
 			else
 			{
+				// Results may also be available from the persistent cache,
+				// which is consulted by `run()` so that only one thread
+				// reads from disk for each collaboration.
+				const IECore::MurmurHash *persistentHash =
+					cachePolicy == CachePolicy::Persistent && !forceMonitoring && persistentCache().enabled() ?
+					&hash : nullptr
+				;
 				owner = acquireCollaborativeResult<ComputeProcess>(
-					hash, p, plug, computeNode
+					hash, p, plug, computeNode, persistentHash
 				);
+				if( statisticsNode )
+				{
+					computeCacheStatistics().stored( g_cache, hash, statisticsNode );
+				}
 				return owner.get();
 			}
 		}
@@ -633,8 +1372,8 @@ class ValuePlug::ComputeProcess : public Process
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode, const IECore::MurmurHash *persistentHash = nullptr )
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ), m_persistentHash( persistentHash )
 		{
 		}
 
@@ -642,6 +1381,23 @@ class ValuePlug::ComputeProcess : public Process
 		{
 			try
 			{
+				IECore::MurmurHash persistentKey;
+				if( m_persistentHash )
+				{
+					// The serialised results may outlive this version of Gaffer,
+					// and the computes that produced them may change between
+					// versions, so we must not share entries between versions.
+					// Nor may we share entries between processes whose computes
+					// depend on different process-wide settings, which are
+					// registered via `addPersistentCacheKeyComponent()`.
+					persistentKey = *m_persistentHash;
+					persistentKey.append( persistentKeySuffix() );
+					if( IECore::ConstObjectPtr result = persistentCache().get( persistentKey ) )
+					{
+						return result;
+					}
+				}
+
 				// Cast is safe because our constructor takes ValuePlugs.
 				const ValuePlug *valuePlug = static_cast<const ValuePlug *>( plug() );
 				if( const ValuePlug *input = valuePlug->getInput<ValuePlug>() )
@@ -667,6 +1423,12 @@ class ValuePlug::ComputeProcess : public Process
 				{
 					throw IECore::Exception( "Compute did not set plug value." );
 				}
+				if( m_persistentHash && m_result->memoryUsage() >= g_persistentCacheCostThreshold )
+				{
+					// Written on a background thread, so that we don't block
+					// threads waiting on this process while the file is written.
+					persistentCache().set( persistentKey, m_result );
+				}
 				// Move to avoid unnecessary reference count increment/decrement - we don't
 				// need `m_result` any more.
 				return std::move( m_result );
@@ -686,9 +1448,36 @@ class ValuePlug::ComputeProcess : public Process
 			return v->memoryUsage();
 		}
 
+		static void cacheRemovalCallback( const IECore::MurmurHash &hash, const IECore::ConstObjectPtr &v )
+		{
+			computeCacheStatistics().removed( hash );
+			// Only has an effect for FloatVectorData, and only if the compressed
+			// cache is enabled. Compression is deferred to a background task.
+			compressedCache().set( hash, v );
+		}
+
 	private :
 
+		// Function-local statics, because components may be registered during
+		// static initialisation of other libraries.
+		static std::mutex &persistentKeySuffixMutex()
+		{
+			static std::mutex g_mutex;
+			return g_mutex;
+		}
+
+		static IECore::MurmurHash &persistentKeySuffixInternal()
+		{
+			static IECore::MurmurHash g_suffix = [] {
+				IECore::MurmurHash h;
+				h.append( versionString() );
+				return h;
+			}();
+			return g_suffix;
+		}
+
 		const ComputeNode *m_computeNode;
+		const IECore::MurmurHash *m_persistentHash;
 		IECore::ConstObjectPtr m_result;
 
 };
@@ -696,7 +1485,14 @@ class ValuePlug::ComputeProcess : public Process
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
-ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+// We use the cost-aware eviction policy so that under memory pressure we
+// keep results which were expensive to compute in favour of cheap ones.
+ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache(
+	CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, cacheRemovalCallback, /* cacheErrors = */ false,
+	CacheType::EvictionPolicy::CostAware
+); // 1 gig
+// Small results are typically cheaper to recompute than to load from disk.
+std::atomic_size_t ValuePlug::ComputeProcess::g_persistentCacheCostThreshold( 1024 * 1024 );
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1156,6 +1952,106 @@ void ValuePlug::clearCache()
 	ComputeProcess::clearCache();
 }
 
+void ValuePlug::setCompressedCacheMemoryLimit( size_t bytes )
+{
+	ComputeProcess::compressedCache().setMaxMemory( bytes );
+}
+
+size_t ValuePlug::getCompressedCacheMemoryLimit()
+{
+	return ComputeProcess::compressedCache().getMaxMemory();
+}
+
+size_t ValuePlug::compressedCacheMemoryUsage()
+{
+	ComputeProcess::compressedCache().wait();
+	return ComputeProcess::compressedCache().currentMemory();
+}
+
+ValuePlug::CompressedCacheStatistics ValuePlug::compressedCacheStatistics()
+{
+	Private::CompressedCache &cache = ComputeProcess::compressedCache();
+	cache.wait();
+	CompressedCacheStatistics result;
+	result.entries = cache.entries();
+	result.memoryUsage = cache.currentMemory();
+	result.uncompressedMemoryUsage = cache.uncompressedMemory();
+	result.hits = cache.hits();
+	result.misses = cache.misses();
+	return result;
+}
+
+void ValuePlug::clearCompressedCacheStatistics()
+{
+	ComputeProcess::compressedCache().clearStatistics();
+}
+
+void ValuePlug::setCacheStatisticsEnabled( bool enabled )
+{
+	computeCacheStatistics().setEnabled( enabled );
+}
+
+bool ValuePlug::getCacheStatisticsEnabled()
+{
+	return computeCacheStatistics().getEnabled();
+}
+
+ValuePlug::CacheStatisticsMap ValuePlug::cacheStatistics()
+{
+	return computeCacheStatistics().statistics();
+}
+
+void ValuePlug::clearCacheStatistics()
+{
+	computeCacheStatistics().clear();
+}
+
+void ValuePlug::setPersistentCacheDirectory( const std::string &directory )
+{
+	ComputeProcess::persistentCache().setDirectory( directory );
+}
+
+std::string ValuePlug::getPersistentCacheDirectory()
+{
+	return ComputeProcess::persistentCache().getDirectory().string();
+}
+
+void ValuePlug::setPersistentCacheSizeLimit( size_t bytes )
+{
+	ComputeProcess::persistentCache().setMaxSize( bytes );
+}
+
+size_t ValuePlug::getPersistentCacheSizeLimit()
+{
+	return ComputeProcess::persistentCache().getMaxSize();
+}
+
+void ValuePlug::setPersistentCacheCostThreshold( size_t bytes )
+{
+	ComputeProcess::g_persistentCacheCostThreshold = bytes;
+}
+
+size_t ValuePlug::getPersistentCacheCostThreshold()
+{
+	return ComputeProcess::g_persistentCacheCostThreshold;
+}
+
+size_t ValuePlug::persistentCacheUsage()
+{
+	ComputeProcess::persistentCache().wait();
+	return ComputeProcess::persistentCache().currentSize();
+}
+
+void ValuePlug::clearPersistentCache()
+{
+	ComputeProcess::persistentCache().clear();
+}
+
+void ValuePlug::addPersistentCacheKeyComponent( const IECore::MurmurHash &component )
+{
+	ComputeProcess::appendToPersistentKeySuffix( component );
+}
+
 size_t ValuePlug::getHashCacheSizeLimit()
 {
 	return HashProcess::getCacheSizeLimit();
@@ -1176,6 +2072,11 @@ size_t ValuePlug::hashCacheTotalUsage()
 	return HashProcess::totalCacheUsage();
 }
 
+size_t ValuePlug::hashCacheMemoryUsage()
+{
+	return HashProcess::totalCacheMemoryUsage();
+}
+
 void ValuePlug::setHashCacheMode( ValuePlug::HashCacheMode hashCacheMode )
 {
 	HashProcess::setHashCacheMode( hashCacheMode );
@@ -36,12 +36,20 @@
 
 #include "GafferImage/Blur.h"
 
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/FilterAlgo.h"
+#include "GafferImage/ImageAlgo.h"
 #include "GafferImage/Resample.h"
+#include "GafferImage/Sampler.h"
 
 #include "Gaffer/StringPlug.h"
 
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
 using namespace Imath;
+using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
@@ -49,6 +57,159 @@ GAFFER_NODE_DEFINE_TYPE( Blur );
 
 const char *g_blurFilterName = "smoothGaussian";
 
+//////////////////////////////////////////////////////////////////////////
+// Recursive gaussian
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// The "smoothGaussian" filter used by the Filter method has weights of
+// `exp( -5 * ( d / ( 1 + radius ) )^2 )`, so this is the standard deviation
+// of the gaussian we must approximate to match it.
+float sigma( float radius )
+{
+	return radius > 0.0f ? ( 1.0f + radius ) / sqrtf( 10.0f ) : 0.0f;
+}
+
+// Coefficients for the third order recursive filter described in
+// "Recursive implementation of the Gaussian filter" (Young and van Vliet,
+// Signal Processing 44, 1995).
+struct RecursiveGaussian
+{
+
+	RecursiveGaussian( float sigma )
+	{
+		// The approximation breaks down for smaller values.
+		sigma = std::max( sigma, 0.5f );
+		const float q = sigma >= 2.5f ? 0.98711f * sigma - 0.96330f : 3.97156f - 4.14554f * sqrtf( 1.0f - 0.26891f * sigma );
+		const float q2 = q * q;
+		const float q3 = q2 * q;
+		const float b0 = 1.57825f + 2.44413f * q + 1.4281f * q2 + 0.422205f * q3;
+		b1 = ( 2.44413f * q + 2.85619f * q2 + 1.26661f * q3 ) / b0;
+		b2 = -( 1.4281f * q2 + 1.26661f * q3 ) / b0;
+		b3 = 0.422205f * q3 / b0;
+		b = 1.0f - ( b1 + b2 + b3 );
+		// The filter response is negligible beyond this distance,
+		// so we only need to run the recursion this far past the
+		// ends of the input and output.
+		margin = (int)ceilf( 4.0f * sigma );
+	}
+
+	float b;
+	float b1;
+	float b2;
+	float b3;
+	int margin;
+
+};
+
+// Filters `width` interleaved signals, with `in` providing the samples in
+// the range `[inMin, inMax)` and `out` receiving the samples in the range
+// `[outMin, outMax)`. Samples outside the input range are treated according
+// to `boundingMode`. Interleaving lets us filter many rows or columns in
+// lockstep, with inner loops over contiguous memory that the compiler can
+// vectorise.
+void recursiveGaussian( const vector<float> &in, int inMin, int inMax, float *out, int outMin, int outMax, int width, Sampler::BoundingMode boundingMode, float sigma, const IECore::Canceller *canceller )
+{
+	const vector<float> zeros( width, 0.0f );
+	auto input = [&] ( int i ) {
+		if( i < inMin )
+		{
+			return boundingMode == Sampler::Clamp ? in.data() : zeros.data();
+		}
+		else if( i >= inMax )
+		{
+			return boundingMode == Sampler::Clamp ? in.data() + ( inMax - inMin - 1 ) * width : zeros.data();
+		}
+		return in.data() + ( i - inMin ) * width;
+	};
+
+	if( inMin >= inMax )
+	{
+		std::fill( out, out + ( outMax - outMin ) * width, 0.0f );
+		return;
+	}
+
+	if( sigma <= 0.0f )
+	{
+		for( int i = outMin; i < outMax; ++i )
+		{
+			const float *x = input( i );
+			std::copy( x, x + width, out + ( i - outMin ) * width );
+		}
+		return;
+	}
+
+	const RecursiveGaussian g( sigma );
+	const int begin = std::min( inMin, outMin ) - g.margin;
+	const int size = std::max( inMax, outMax ) + g.margin - begin;
+
+	// Three extra samples at either end, to initialise the recursion
+	// as if the first and last samples extended to infinity.
+	vector<float> buffer( ( size + 6 ) * width );
+	float *w = buffer.data() + 3 * width;
+	for( int i = -3; i < 0; ++i )
+	{
+		const float *x = input( begin );
+		std::copy( x, x + width, w + i * width );
+	}
+
+	// Causal pass.
+
+	for( int i = 0; i < size; ++i )
+	{
+		IECore::Canceller::check( canceller );
+		const float *x = input( begin + i );
+		float *wi = w + i * width;
+		const float *w1 = wi - width;
+		const float *w2 = wi - 2 * width;
+		const float *w3 = wi - 3 * width;
+		for( int k = 0; k < width; ++k )
+		{
+			wi[k] = g.b * x[k] + g.b1 * w1[k] + g.b2 * w2[k] + g.b3 * w3[k];
+		}
+	}
+
+	// Anticausal pass, performed in place.
+
+	for( int i = size; i < size + 3; ++i )
+	{
+		std::copy( w + ( size - 1 ) * width, w + size * width, w + i * width );
+	}
+
+	for( int i = size - 1; i >= 0; --i )
+	{
+		IECore::Canceller::check( canceller );
+		float *yi = w + i * width;
+		const float *y1 = yi + width;
+		const float *y2 = yi + 2 * width;
+		const float *y3 = yi + 3 * width;
+		for( int k = 0; k < width; ++k )
+		{
+			yi[k] = g.b * yi[k] + g.b1 * y1[k] + g.b2 * y2[k] + g.b3 * y3[k];
+		}
+	}
+
+	std::copy( w + ( outMin - begin ) * width, w + ( outMax - begin ) * width, out );
+}
+
+// Region of the input needed by the horizontal pass for the row of
+// tiles starting at `tileOriginY`.
+Box2i horizontalPassRegion( int tileOriginY, const Box2i &inDataWindow )
+{
+	return BufferAlgo::intersection(
+		inDataWindow,
+		Box2i( V2i( inDataWindow.min.x, tileOriginY ), V2i( inDataWindow.max.x, tileOriginY + ImagePlug::tileSize() ) )
+	);
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Blur
+//////////////////////////////////////////////////////////////////////////
+
 size_t Blur::g_firstPlugIndex = 0;
 
 Blur::Blur( const std::string &name )
@@ -61,12 +222,16 @@ Blur::Blur( const std::string &name )
 	addChild( new V2fPlug( "radius", Plug::In, V2f( 0 ), V2f( 0 ) ) );
 	addChild( resample->boundingModePlug()->createCounterpart( "boundingMode", Plug::In ) );
 	addChild( new BoolPlug( "expandDataWindow" ) );
+	addChild( new IntPlug( "method", Plug::In, Filter, Filter, Recursive ) );
 
 	addChild( new V2fPlug( "__filterScale", Plug::Out ) );
 
 	addChild( new AtomicBox2iPlug( "__resampledDataWindow", Plug::In, Box2i(), Plug::Default & ~Plug::Serialisable ) );
 	addChild( new FloatVectorDataPlug( "__resampledChannelData", Plug::In, ImagePlug::blackTile(), Plug::Default & ~Plug::Serialisable ) );
 
+	addChild( new FloatVectorDataPlug( "__horizontalPass", Plug::Out, ImagePlug::blackTile() ) );
+	addChild( new FloatVectorDataPlug( "__verticalPass", Plug::Out, ImagePlug::blackTile() ) );
+
 	addChild( resample );
 
 	resample->inPlug()->setInput( inPlug() );
@@ -118,44 +283,74 @@ const Gaffer::BoolPlug *Blur::expandDataWindowPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 2 );
 }
 
+Gaffer::IntPlug *Blur::methodPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::IntPlug *Blur::methodPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
 Gaffer::V2fPlug *Blur::filterScalePlug()
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 const Gaffer::V2fPlug *Blur::filterScalePlug() const
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug()
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 const Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug() const
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug()
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
 }
 
 const Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug() const
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
+}
+
+Gaffer::FloatVectorDataPlug *Blur::horizontalPassPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
+}
+
+const Gaffer::FloatVectorDataPlug *Blur::horizontalPassPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
+}
+
+Gaffer::FloatVectorDataPlug *Blur::verticalPassPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 8 );
+}
+
+const Gaffer::FloatVectorDataPlug *Blur::verticalPassPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 8 );
 }
 
 Resample *Blur::resample()
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 9 );
 }
 
 const Resample *Blur::resample() const
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 9 );
 }
 
 void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -176,11 +371,40 @@ void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs )
 		outputs.push_back( outPlug()->channelDataPlug() );
 	}
 	else if(
-		input == resampledChannelDataPlug()
+		input == resampledChannelDataPlug() ||
+		input == methodPlug() ||
+		input == verticalPassPlug()
 	)
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
 	}
+
+	// Both passes depend on the output data window, which in
+	// turn depends on the radius and the expansion settings.
+	const bool affectsDataWindows =
+		input->parent<V2fPlug>() == radiusPlug() ||
+		input == expandDataWindowPlug() ||
+		input == resampledDataWindowPlug() ||
+		input == inPlug()->dataWindowPlug()
+	;
+
+	if(
+		affectsDataWindows ||
+		input == inPlug()->channelDataPlug() ||
+		input == boundingModePlug()
+	)
+	{
+		outputs.push_back( horizontalPassPlug() );
+	}
+
+	if(
+		affectsDataWindows ||
+		input == horizontalPassPlug() ||
+		input == boundingModePlug()
+	)
+	{
+		outputs.push_back( verticalPassPlug() );
+	}
 }
 
 void Blur::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
@@ -191,6 +415,59 @@ void Blur::hash( const ValuePlug *output, const Context *context, IECore::Murmur
 	{
 		radiusPlug()->getChild<ValuePlug>( output->getName() )->hash( h );
 	}
+	else if( output == horizontalPassPlug() )
+	{
+		Box2i inDataWindow;
+		{
+			ImagePlug::GlobalScope c( context );
+			radiusPlug()->getChild<FloatPlug>( 0 )->hash( h );
+			boundingModePlug()->hash( h );
+			inDataWindow = inPlug()->dataWindowPlug()->getValue();
+			h.append( inDataWindow );
+			const Box2i outDataWindow = outPlug()->dataWindowPlug()->getValue();
+			h.append( outDataWindow.min.x );
+			h.append( outDataWindow.max.x );
+		}
+
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i region = horizontalPassRegion( tileOrigin.y, inDataWindow );
+		if( !BufferAlgo::empty( region ) )
+		{
+			Sampler sampler( inPlug(), context->get<std::string>( ImagePlug::channelNameContextName ), region );
+			sampler.hash( h );
+		}
+		// Another row might happen to contain the same input tiles,
+		// so we must include the tile origin to make sure each row
+		// has a unique hash.
+		h.append( tileOrigin.y );
+	}
+	else if( output == verticalPassPlug() )
+	{
+		Box2i inDataWindow;
+		{
+			ImagePlug::GlobalScope c( context );
+			radiusPlug()->getChild<FloatPlug>( 1 )->hash( h );
+			boundingModePlug()->hash( h );
+			inDataWindow = inPlug()->dataWindowPlug()->getValue();
+			h.append( inDataWindow );
+			h.append( outPlug()->dataWindowPlug()->getValue() );
+		}
+
+		h.append( context->get<V2i>( ImagePlug::tileOriginContextName ).x );
+		ImageAlgo::parallelGatherTiles(
+			inPlug(),
+			[this] ( const ImagePlug *imagePlug, const V2i &tileOrigin )
+			{
+				return horizontalPassPlug()->hash();
+			},
+			[&h] ( const ImagePlug *imagePlug, const V2i &tileOrigin, const IECore::MurmurHash &rowHash )
+			{
+				h.append( rowHash );
+			},
+			Box2i( V2i( 0, inDataWindow.min.y ), V2i( 1, inDataWindow.max.y ) ),
+			ImageAlgo::TopToBottom
+		);
+	}
 }
 
 void Blur::compute( ValuePlug *output, const Context *context ) const
@@ -214,10 +491,140 @@ void Blur::compute( ValuePlug *output, const Context *context ) const
 		);
 		return;
 	}
+	else if( output == horizontalPassPlug() )
+	{
+		// Filters a whole row of tiles at once, so that the cost per pixel
+		// is independent of the radius. The result stores the pixels for
+		// each column of the output data window in turn, with the values for
+		// all the rows interleaved.
+
+		float radius;
+		Sampler::BoundingMode boundingMode;
+		Box2i inDataWindow;
+		Box2i outDataWindow;
+		{
+			ImagePlug::GlobalScope c( context );
+			radius = radiusPlug()->getChild<FloatPlug>( 0 )->getValue();
+			boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+			inDataWindow = inPlug()->dataWindowPlug()->getValue();
+			outDataWindow = outPlug()->dataWindowPlug()->getValue();
+		}
+
+		const int tileSize = ImagePlug::tileSize();
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i region = horizontalPassRegion( tileOrigin.y, inDataWindow );
+
+		vector<float> input( inDataWindow.size().x * tileSize, 0.0f );
+		if( !BufferAlgo::empty( region ) )
+		{
+			Sampler sampler( inPlug(), context->get<std::string>( ImagePlug::channelNameContextName ), region );
+			sampler.populate();
+			sampler.visitPixels(
+				region,
+				[&input, &inDataWindow, &tileOrigin, tileSize] ( float v, int x, int y )
+				{
+					input[( x - inDataWindow.min.x ) * tileSize + y - tileOrigin.y] = v;
+				}
+			);
+		}
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		resultData->writable().resize( outDataWindow.size().x * tileSize );
+		recursiveGaussian(
+			input, inDataWindow.min.x, inDataWindow.max.x,
+			resultData->writable().data(), outDataWindow.min.x, outDataWindow.max.x,
+			tileSize, boundingMode, sigma( radius ), context->canceller()
+		);
+
+		static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+		return;
+	}
+	else if( output == verticalPassPlug() )
+	{
+		// Filters a whole column of tiles at once, using the rows from the
+		// horizontal pass. The result stores the pixels for each row of the
+		// output data window in turn, with the values for all the columns
+		// interleaved, which is just the layout needed to extract tiles.
+
+		float radius;
+		Sampler::BoundingMode boundingMode;
+		Box2i inDataWindow;
+		Box2i outDataWindow;
+		{
+			ImagePlug::GlobalScope c( context );
+			radius = radiusPlug()->getChild<FloatPlug>( 1 )->getValue();
+			boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+			inDataWindow = inPlug()->dataWindowPlug()->getValue();
+			outDataWindow = outPlug()->dataWindowPlug()->getValue();
+		}
+
+		const int tileSize = ImagePlug::tileSize();
+		const int columnOrigin = context->get<V2i>( ImagePlug::tileOriginContextName ).x;
+		const int minX = std::max( columnOrigin, outDataWindow.min.x );
+		const int maxX = std::min( columnOrigin + tileSize, outDataWindow.max.x );
+
+		vector<float> input( inDataWindow.size().y * tileSize, 0.0f );
+		ImageAlgo::parallelProcessTiles(
+			inPlug(),
+			[&] ( const ImagePlug *imagePlug, const V2i &tileOrigin )
+			{
+				ConstFloatVectorDataPtr rowData = horizontalPassPlug()->getValue();
+				const vector<float> &row = rowData->readable();
+				const int minY = std::max( tileOrigin.y, inDataWindow.min.y );
+				const int maxY = std::min( tileOrigin.y + tileSize, inDataWindow.max.y );
+				for( int y = minY; y < maxY; ++y )
+				{
+					float *dst = input.data() + ( y - inDataWindow.min.y ) * tileSize - columnOrigin;
+					for( int x = minX; x < maxX; ++x )
+					{
+						dst[x] = row[( x - outDataWindow.min.x ) * tileSize + y - tileOrigin.y];
+					}
+				}
+			},
+			Box2i( V2i( 0, inDataWindow.min.y ), V2i( 1, inDataWindow.max.y ) )
+		);
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		resultData->writable().resize( outDataWindow.size().y * tileSize );
+		recursiveGaussian(
+			input, inDataWindow.min.y, inDataWindow.max.y,
+			resultData->writable().data(), outDataWindow.min.y, outDataWindow.max.y,
+			tileSize, boundingMode, sigma( radius ), context->canceller()
+		);
+
+		static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+		return;
+	}
 
 	FlatImageProcessor::compute( output, context );
 }
 
+Gaffer::ValuePlug::CachePolicy Blur::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == horizontalPassPlug() || output == verticalPassPlug() )
+	{
+		// Both passes spawn TBB tasks to fetch their inputs.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	else if( output == outPlug()->channelDataPlug() )
+	{
+		// Our channel data is either a redirect to the internal Resample,
+		// or a copy of part of the vertical pass, both of which are cached
+		// already.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return FlatImageProcessor::computeCachePolicy( output );
+}
+
+Gaffer::ValuePlug::CachePolicy Blur::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == verticalPassPlug() )
+	{
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return FlatImageProcessor::hashCachePolicy( output );
+}
+
 void Blur::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	if( radiusPlug()->getValue() != V2f( 0 ) && expandDataWindowPlug()->getValue() )
@@ -244,24 +651,69 @@ Imath::Box2i Blur::computeDataWindow( const Gaffer::Context *context, const Imag
 
 void Blur::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	if( radiusPlug()->getValue() == V2f( 0 ) )
 	{
-		h = resampledChannelDataPlug()->hash();
+		h = inPlug()->channelDataPlug()->hash();
+	}
+	else if( methodPlug()->getValue() == Recursive )
+	{
+		FlatImageProcessor::hashChannelData( parent, context, h );
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		{
+			ImagePlug::ChannelDataScope s( context );
+			const V2i columnOrigin( tileOrigin.x, 0 );
+			s.setTileOrigin( &columnOrigin );
+			verticalPassPlug()->hash( h );
+		}
+		h.append( tileOrigin.y );
 	}
 	else
 	{
-		h = inPlug()->channelDataPlug()->hash();
+		h = resampledChannelDataPlug()->hash();
 	}
 }
 
 IECore::ConstFloatVectorDataPtr Blur::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	if( radiusPlug()->getValue() == V2f( 0 ) )
 	{
-		return resampledChannelDataPlug()->getValue();
+		return inPlug()->channelDataPlug()->getValue();
+	}
+	else if( methodPlug()->getValue() == Recursive )
+	{
+		Box2i dataWindow;
+		{
+			ImagePlug::GlobalScope c( context );
+			dataWindow = outPlug()->dataWindowPlug()->getValue();
+		}
+
+		ConstFloatVectorDataPtr columnData;
+		{
+			ImagePlug::ChannelDataScope s( context );
+			const V2i columnOrigin( tileOrigin.x, 0 );
+			s.setTileOrigin( &columnOrigin );
+			columnData = verticalPassPlug()->getValue();
+		}
+		const vector<float> &column = columnData->readable();
+
+		const int tileSize = ImagePlug::tileSize();
+		const Box2i tileBound = BufferAlgo::intersection(
+			dataWindow, Box2i( tileOrigin, tileOrigin + V2i( tileSize ) )
+		);
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		vector<float> &result = resultData->writable();
+		result.resize( tileSize * tileSize, 0.0f );
+		for( int y = tileBound.min.y; y < tileBound.max.y; ++y )
+		{
+			const float *src = column.data() + ( y - dataWindow.min.y ) * tileSize - tileOrigin.x;
+			float *dst = result.data() + ( y - tileOrigin.y ) * tileSize - tileOrigin.x;
+			std::copy( src + tileBound.min.x, src + tileBound.max.x, dst + tileBound.min.x );
+		}
+		return resultData;
 	}
 	else
 	{
-		return inPlug()->channelDataPlug()->getValue();
+		return resampledChannelDataPlug()->getValue();
 	}
 }
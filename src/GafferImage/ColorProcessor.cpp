@@ -59,8 +59,6 @@ struct ColorProcessorData : public IECore::Data
 
 IE_CORE_DECLAREPTR( ColorProcessorData );
 
-const IECore::InternedString g_layerNameKey( "image:colorProcessor:__layerName" );
-
 } // namespace
 
 GAFFER_NODE_DEFINE_TYPE( ColorProcessor );
@@ -83,13 +81,7 @@ ColorProcessor::ColorProcessor( const std::string &name )
 		)
 	);
 
-	addChild(
-		new ObjectPlug(
-			"__colorData",
-			Gaffer::Plug::Out,
-			new ObjectVector
-		)
-	);
+	addChild( new ObjectPlug( "__channelGroup", Gaffer::Plug::Out, new ObjectVector ) );
 
 	// We don't ever want to change the these, so we make pass-through connections.
 	outPlug()->formatPlug()->setInput( inPlug()->formatPlug() );
@@ -135,12 +127,7 @@ const Gaffer::ObjectPlug *ColorProcessor::colorProcessorPlug() const
 	return getChild<ObjectPlug>( g_firstPlugIndex + 2 );
 }
 
-Gaffer::ObjectPlug *ColorProcessor::colorDataPlug()
-{
-	return getChild<ObjectPlug>( g_firstPlugIndex + 3 );
-}
-
-const Gaffer::ObjectPlug *ColorProcessor::colorDataPlug() const
+const Gaffer::ObjectPlug *ColorProcessor::channelGroupPlug() const
 {
 	return getChild<ObjectPlug>( g_firstPlugIndex + 3 );
 }
@@ -161,13 +148,12 @@ void ColorProcessor::affects( const Gaffer::Plug *input, AffectedPlugsContainer
 		input == colorProcessorPlug()
 	)
 	{
-		outputs.push_back( colorDataPlug() );
+		outputs.push_back( channelGroupPlug() );
 	}
 
 	if(
 		input == colorProcessorPlug() ||
-		input == channelsPlug() ||
-		input == colorDataPlug()
+		input == channelsPlug()
 	)
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
@@ -182,250 +168,319 @@ void ColorProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Contex
 	{
 		hashColorProcessor( context, h );
 	}
-	else if( output == colorDataPlug() )
+}
+
+void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	if( output == colorProcessorPlug() )
 	{
-		ConstStringVectorDataPtr channelNamesData;
-		bool unpremult;
+		ColorProcessorDataPtr data = new ColorProcessorData;
+		data->colorProcessor = colorProcessor( context );
+		static_cast<ObjectPlug *>( output )->setValue( data );
+		return;
+	}
+
+	ImageProcessor::compute( output, context );
+}
+
+Gaffer::ValuePlug::CachePolicy ColorProcessor::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() )
+	{
+		// Because the processed channels are just views onto our
+		// intermediate channelGroupPlug(), and the others are passed
+		// through unchanged, it is actually quicker not to cache the result.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return ImageProcessor::computeCachePolicy( output );
+}
+
+bool ColorProcessor::mipLevelsSupported( const Gaffer::Context *context ) const
+{
+	return true;
+}
+
+std::vector<std::string> ColorProcessor::channelGroup( const std::string &channel, const Gaffer::Context *context ) const
+{
+	std::string channels;
+	ConstColorProcessorDataPtr colorProcessorData;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
+		channels = channelsPlug()->getValue();
+	}
+
+	if( !colorProcessorData->colorProcessor )
+	{
+		// No processor - pass through.
+		return {};
+	}
+
+	const std::string &baseName = ImageAlgo::baseName( channel );
+	if(
+		( baseName != "R" && baseName != "G" && baseName != "B" ) ||
+		!StringAlgo::matchMultiple( channel, channels )
+	)
+	{
+		// Auxiliary channel, or not in channel mask. Pass through.
+		return {};
+	}
+
+	// Process R, G and B together, regardless of which of them
+	// are present in the input or the channel mask.
+	const std::string layerName = ImageAlgo::layerName( channel );
+	return {
+		ImageAlgo::channelName( layerName, "R" ),
+		ImageAlgo::channelName( layerName, "G" ),
+		ImageAlgo::channelName( layerName, "B" )
+	};
+}
+
+void ColorProcessor::hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	ImageProcessor::hashChannelGroup( channels, tileOrigin, context, h );
+
+	ConstStringVectorDataPtr channelNamesData;
+	bool unpremult;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		channelNamesData = inPlug()->channelNamesPlug()->getValue();
+		unpremult = processUnpremultipliedPlug()->getValue();
+		colorProcessorPlug()->hash( h );
+	}
+	const vector<string> &channelNames = channelNamesData->readable();
+
+	ImagePlug::ChannelDataScope channelDataScope( context );
+	for( const auto &channelName : channels )
+	{
+		if( ImageAlgo::channelExists( channelNames, channelName ) )
 		{
-			ImagePlug::GlobalScope globalScope( context );
-			channelNamesData = inPlug()->channelNamesPlug()->getValue();
-			unpremult = processUnpremultipliedPlug()->getValue();
-			colorProcessorPlug()->hash( h );
+			channelDataScope.setChannelName( &channelName );
+			inPlug()->channelDataPlug()->hash( h );
+		}
+		else
+		{
+			ImagePlug::blackTile()->hash( h );
 		}
-		const vector<string> &channelNames = channelNamesData->readable();
+	}
+
+	if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
+	{
+		channelDataScope.setChannelName( &ImageAlgo::channelNameA );
+		inPlug()->channelDataPlug()->hash( h );
+	}
+}
+
+IECore::ConstObjectVectorPtr ColorProcessor::computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const
+{
+	// Rather than fetching our input from an upstream ColorProcessor, which would
+	// compute and cache an intermediate group of its own, we fuse any chain of
+	// ColorProcessors directly upstream of us, applying all their transforms in
+	// turn to the same buffers. This produces exactly the same result as the
+	// unfused computation, so our hash is unaffected.
+
+	vector<const ColorProcessor *> chain = { this };
+	while( const ColorProcessor *upstream = chain.back()->fusableInput() )
+	{
+		chain.push_back( upstream );
+	}
+
+	// Get the input to the chain. Channel names and alpha are passed
+	// through by all ColorProcessors, so these are the same for all stages.
 
-		const string &layerName = context->get<string>( g_layerNameKey );
+	const ImagePlug *chainInPlug = chain.back()->inPlug();
 
+	ConstStringVectorDataPtr channelNamesData;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		channelNamesData = chainInPlug->channelNamesPlug()->getValue();
+	}
+	const vector<string> &channelNames = channelNamesData->readable();
+
+	const bool alphaExists = ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA );
+	bool channelExists[3];
+
+	FloatVectorDataPtr rgb[3];
+	ConstFloatVectorDataPtr alpha;
+	int samples = -1;
+	{
 		ImagePlug::ChannelDataScope channelDataScope( context );
-		for( const auto &baseName : { "R", "G", "B" } )
+
+		for( int i = 0; i < 3; i++ )
 		{
-			string channelName = ImageAlgo::channelName( layerName, baseName );
-			if( ImageAlgo::channelExists( channelNames, channelName ) )
+			const string &channelName = channels[i];
+			channelExists[i] = ImageAlgo::channelExists( channelNames, channelName );
+			if( channelExists[i] )
 			{
 				channelDataScope.setChannelName( &channelName );
-				inPlug()->channelDataPlug()->hash( h );
-			}
-			else
-			{
-				ImagePlug::blackTile()->hash( h );
+				rgb[i] = chainInPlug->channelDataPlug()->getValue()->copy();
+				samples = rgb[i]->readable().size();
 			}
 		}
 
-		if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
+		if( samples == -1 )
 		{
-			channelDataScope.setChannelName( &ImageAlgo::channelNameA );
-			inPlug()->channelDataPlug()->hash( h );
+			throw IECore::Exception( "Cannot evaluate color data plug with no source channels" );
 		}
-	}
-}
 
-void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
-{
-	if( output == colorProcessorPlug() )
-	{
-		ColorProcessorDataPtr data = new ColorProcessorData;
-		data->colorProcessor = colorProcessor( context );
-		static_cast<ObjectPlug *>( output )->setValue( data );
-		return;
+		for( int k = 0; k < 3; k++ )
+		{
+			if( !rgb[k] )
+			{
+				rgb[k] = new FloatVectorData();
+				rgb[k]->writable().resize( samples, 0.0f );
+			}
+		}
 	}
-	else if( output == colorDataPlug() )
+
+	// Apply each stage of the chain, starting upstream.
+
+	for( auto it = chain.rbegin(); it != chain.rend(); ++it )
 	{
-		ConstStringVectorDataPtr channelNamesData;
+		const ColorProcessor *stage = *it;
+
 		ConstColorProcessorDataPtr colorProcessorData;
 		bool unpremult;
+		bool enabled;
 		{
 			ImagePlug::GlobalScope globalScope( context );
-			channelNamesData = inPlug()->channelNamesPlug()->getValue();
-			unpremult = processUnpremultipliedPlug()->getValue();
-			colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
+			colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( stage->colorProcessorPlug()->getValue() );
+			unpremult = stage->processUnpremultipliedPlug()->getValue();
+			enabled = stage->enabled();
 		}
-		const vector<string> &channelNames = channelNamesData->readable();
 
-		const string &layerName = context->get<string>( g_layerNameKey );
+		// Determine which channels the stage outputs from its group, rather than
+		// passing through. This is all of them for the final stage, since we are
+		// computing the group itself.
 
-		FloatVectorDataPtr rgb[3];
-		ConstFloatVectorDataPtr alpha;
-		int samples = -1;
+		bool processed[3] = { true, true, true };
+		if( stage != this )
 		{
 			ImagePlug::ChannelDataScope channelDataScope( context );
-
-			if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
+			for( int i = 0; i < 3; i++ )
 			{
-				channelDataScope.setChannelName( &ImageAlgo::channelNameA );
-				alpha = inPlug()->channelDataPlug()->getValue();
+				channelDataScope.setChannelName( &channels[i] );
+				processed[i] = enabled && stage->channelEnabled( channels[i] ) && !stage->channelGroup( channels[i], context ).empty();
 			}
+		}
 
-			int i = 0;
-			for( const auto &baseName : { "R", "G", "B" } )
-			{
-				string channelName = ImageAlgo::channelName( layerName, baseName );
-				if( ImageAlgo::channelExists( channelNames, channelName ) )
-				{
-					channelDataScope.setChannelName( &channelName );
-					rgb[i] = inPlug()->channelDataPlug()->getValue()->copy();
+		if( !processed[0] && !processed[1] && !processed[2] )
+		{
+			continue;
+		}
 
-					samples = rgb[i]->readable().size();
+		// A downstream node only reads the channels that exist, so non-existent
+		// channels always enter a stage as black.
 
-					if( unpremult && alpha )
-					{
-						const float *A = &alpha->readable().front();
-						float *C = &rgb[i]->writable().front();
-						for( int j = 0; j < samples; j++ )
-						{
-							if( *A != 0 )
-							{
-								*C /= *A;
-							}
-							A++;
-							C++;
-						}
-					}
-				}
-				else
-				{
-					rgb[i] = nullptr;
-				}
-				i++;
+		for( int i = 0; i < 3; i++ )
+		{
+			if( !channelExists[i] && it != chain.rbegin() )
+			{
+				std::fill( rgb[i]->writable().begin(), rgb[i]->writable().end(), 0.0f );
 			}
+		}
 
-			if( samples == -1 )
+		ConstFloatVectorDataPtr passThrough[3];
+		for( int i = 0; i < 3; i++ )
+		{
+			if( !processed[i] )
 			{
-				throw IECore::Exception( "Cannot evaluate color data plug with no source channels" );
+				passThrough[i] = rgb[i]->copy();
 			}
+		}
 
-			for( int k = 0; k < 3; k++ )
+		if( unpremult && alphaExists && !alpha )
+		{
+			ImagePlug::ChannelDataScope channelDataScope( context );
+			channelDataScope.setChannelName( &ImageAlgo::channelNameA );
+			alpha = chainInPlug->channelDataPlug()->getValue();
+		}
+
+		const bool useAlpha = unpremult && alpha;
+		if( useAlpha )
+		{
+			for( int i = 0; i < 3; i++ )
 			{
-				if( !rgb[k] )
+				const float *A = &alpha->readable().front();
+				float *C = &rgb[i]->writable().front();
+				for( int j = 0; j < samples; j++ )
 				{
-					rgb[k] = new FloatVectorData();
-					rgb[k]->writable().resize( samples, 0.0f );
+					if( *A != 0 )
+					{
+						*C /= *A;
+					}
+					A++;
+					C++;
 				}
 			}
-
 		}
 
 		colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
 
-		if( unpremult && alpha )
+		if( useAlpha )
 		{
 			for( int i = 0; i < 3; i++ )
 			{
-				if( unpremult && alpha )
+				const float *A = &alpha->readable().front();
+				float *C = &rgb[i]->writable().front();
+				for( int j = 0; j < samples; j++ )
 				{
-					const float *A = &alpha->readable().front();
-					float *C = &rgb[i]->writable().front();
-					for( int j = 0; j < samples; j++ )
+					// Pixels with no alpha aren't touched by either the unpremult or repremult
+					if( *A != 0 )
 					{
-						// Pixels with no alpha aren't touched by either the unpremult or repremult
-						if( *A != 0 )
-						{
-							*C *= *A;
-						}
-						A++;
-						C++;
+						*C *= *A;
 					}
+					A++;
+					C++;
 				}
 			}
 		}
 
-		ObjectVectorPtr result = new ObjectVector();
-		result->members().push_back( rgb[0] );
-		result->members().push_back( rgb[1] );
-		result->members().push_back( rgb[2] );
-
-		static_cast<ObjectPlug *>( output )->setValue( result );
-		return;
+		for( int i = 0; i < 3; i++ )
+		{
+			if( passThrough[i] )
+			{
+				rgb[i]->writable() = passThrough[i]->readable();
+			}
+		}
 	}
 
-	ImageProcessor::compute( output, context );
-}
+	ObjectVectorPtr result = new ObjectVector();
+	result->members().push_back( rgb[0] );
+	result->members().push_back( rgb[1] );
+	result->members().push_back( rgb[2] );
 
-Gaffer::ValuePlug::CachePolicy ColorProcessor::computeCachePolicy( const Gaffer::ValuePlug *output ) const
-{
-	if( output == outPlug()->channelDataPlug() )
-	{
-		// Because our implementation of computeChannelData() is so simple,
-		// just copying data out of our intermediate colorDataPlug(), it is
-		// actually quicker not to cache the result.
-		return ValuePlug::CachePolicy::Uncached;
-	}
-	return ImageProcessor::computeCachePolicy( output );
+	return result;
 }
 
-void ColorProcessor::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+const ColorProcessor *ColorProcessor::fusableInput() const
 {
-	std::string channels;
-	ConstColorProcessorDataPtr colorProcessorData;
+	const Plug *input = inPlug()->getInput();
+	const ColorProcessor *upstream = input ? runTimeCast<const ColorProcessor>( input->node() ) : nullptr;
+	if( !upstream || input != upstream->outPlug() )
 	{
-		ImagePlug::GlobalScope globalScope( context );
-		colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
-		channels = channelsPlug()->getValue();
+		return nullptr;
 	}
 
-	if( !colorProcessorData->colorProcessor )
+	// If anything else reads the upstream image, it is better to compute
+	// and cache its output once than to recompute it for every reader. This
+	// is also the case when the upstream image is being viewed.
+	if( upstream->outPlug()->outputs().size() != 1 )
 	{
-		// No processor - pass through.
-		h = inPlug()->channelDataPlug()->hash();
-		return;
+		return nullptr;
 	}
 
-	const std::string &channel = context->get<std::string>( ImagePlug::channelNameContextName );
-	const std::string &baseName = ImageAlgo::baseName( channel );
-
-	if(
-		( baseName != "R" && baseName != "G" && baseName != "B" ) ||
-		!StringAlgo::matchMultiple( channel, channels )
-	)
-	{
-		// Auxiliary channel, or not in channel mask. Pass through.
-		h = inPlug()->channelDataPlug()->hash();
-		return;
-	}
+	return upstream;
+}
 
-	ImageProcessor::hashChannelData( output, context, h );
-	h.append( baseName );
-	{
-		Context::EditableScope layerScope( context );
-		std::string layerNameStr = ImageAlgo::layerName( channel );
-		layerScope.set( g_layerNameKey, &layerNameStr );
-		colorDataPlug()->hash( h );
-	}
+void ColorProcessor::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	// Only called for channels not returned by `channelGroup()`,
+	// which we pass through unchanged.
+	h = inPlug()->channelDataPlug()->hash();
 }
 
 IECore::ConstFloatVectorDataPtr ColorProcessor::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	std::string channels;
-	ConstColorProcessorDataPtr colorProcessorData;
-	{
-		ImagePlug::GlobalScope globalScope( context );
-		colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
-		channels = channelsPlug()->getValue();
-	}
-
-	if( !colorProcessorData->colorProcessor )
-	{
-		// No processor - pass through.
-		return inPlug()->channelDataPlug()->getValue();
-	}
-
-	const std::string &channel = context->get<std::string>( ImagePlug::channelNameContextName );
-	const std::string &baseName = ImageAlgo::baseName( channel );
-
-	if(
-		( baseName != "R" && baseName != "G" && baseName != "B" ) ||
-		!StringAlgo::matchMultiple( channel, channels )
-	)
-	{
-		// Auxiliary channel, or not in channel mask. Pass through.
-		return inPlug()->channelDataPlug()->getValue();
-	}
-
-	ConstObjectVectorPtr colorData;
-	{
-		Context::EditableScope layerScope( context );
-		std::string layerNameStr = ImageAlgo::layerName( channel );
-		layerScope.set( g_layerNameKey, &layerNameStr );
-		colorData = boost::static_pointer_cast<const ObjectVector>( colorDataPlug()->getValue() );
-	}
-	return boost::static_pointer_cast<const FloatVectorData>( colorData->members()[ImageAlgo::colorIndex( baseName)] );
+	return inPlug()->channelDataPlug()->getValue();
 }
@@ -1229,6 +1229,12 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	static_cast<CompoundObjectPlug *>( output )->setValue( result );
 }
 
+bool DeepState::mipLevelsSupported( const Gaffer::Context *context ) const
+{
+	ImagePlug::GlobalScope s( context );
+	return !inPlug()->deepPlug()->getValue();
+}
+
 void DeepState::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageProcessor::hashChannelData( output, context, h );
@@ -54,8 +54,11 @@
 #include "boost/lexical_cast.hpp"
 #include "boost/multi_array.hpp"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 #include "tbb/spin_mutex.h"
 
+#include <chrono>
 #include <memory>
 
 using namespace std;
@@ -64,6 +67,67 @@ using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
+//////////////////////////////////////////////////////////////////////////
+// Utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Copies `width` pixels from the interleaved `source` into a separate
+// `destinations` buffer per channel. The channel count is a template
+// parameter so that the compiler can vectorise the strided loads.
+template<int NumChannels>
+void deinterleave( const float *source, float * const *destinations, int width )
+{
+	for( int c = 0; c < NumChannels; ++c )
+	{
+		const float *s = source + c;
+		float *d = destinations[c];
+		for( int x = 0; x < width; ++x )
+		{
+			d[x] = s[x * NumChannels];
+		}
+	}
+}
+
+void deinterleave( const float *source, int numChannels, float * const *destinations, int width )
+{
+	switch( numChannels )
+	{
+		case 1 :
+			std::copy( source, source + width, destinations[0] );
+			return;
+		case 2 :
+			deinterleave<2>( source, destinations, width );
+			return;
+		case 3 :
+			deinterleave<3>( source, destinations, width );
+			return;
+		case 4 :
+			deinterleave<4>( source, destinations, width );
+			return;
+		case 8 :
+			deinterleave<8>( source, destinations, width );
+			return;
+		case 16 :
+			deinterleave<16>( source, destinations, width );
+			return;
+		default :
+			for( int c = 0; c < numChannels; ++c )
+			{
+				const float *s = source + c;
+				float *d = destinations[c];
+				for( int x = 0; x < width; ++x )
+				{
+					d[x] = s[x * numChannels];
+				}
+			}
+	}
+}
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // Implementation of a DisplayDriver to support the node itself
 //////////////////////////////////////////////////////////////////////////
@@ -162,46 +226,26 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 
 		void imageData( const Imath::Box2i &box, const float *data, size_t dataSize ) override
 		{
-			Box2i gafferBox = m_gafferFormat.fromEXRSpace( box );
+			const Box2i gafferBox = m_gafferFormat.fromEXRSpace( box );
 
 			const V2i boxMinTileOrigin = ImagePlug::tileOrigin( gafferBox.min );
 			const V2i boxMaxTileOrigin = ImagePlug::tileOrigin( gafferBox.max - Imath::V2i( 1 ) );
-			for( int tileOriginY = boxMinTileOrigin.y; tileOriginY <= boxMaxTileOrigin.y; tileOriginY += ImagePlug::tileSize() )
-			{
-				for( int tileOriginX = boxMinTileOrigin.x; tileOriginX <= boxMaxTileOrigin.x; tileOriginX += ImagePlug::tileSize() )
-				{
-					for( int channelIndex = 0, numChannels = channelNames().size(); channelIndex < numChannels; ++channelIndex )
+			const V2i numTiles = ( boxMaxTileOrigin - boxMinTileOrigin ) / ImagePlug::tileSize() + V2i( 1 );
+
+			// Buckets are often smaller than a tile, but large buckets can
+			// span several, in which case we transfer the tiles in parallel.
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<int>( 0, numTiles.x * numTiles.y ),
+				[&] ( const tbb::blocked_range<int> &range ) {
+					for( int i = range.begin(); i != range.end(); ++i )
 					{
-						const V2i tileOrigin( tileOriginX, tileOriginY );
-						Tile * tile = getTile( tileOrigin, channelIndex );
-						if( !tile )
-						{
-							// we've been sent data outside of the data window
-							continue;
-						}
-
-						vector<float> &buffer = tile->backBuffer;
-						const Box2i tileBound( tileOrigin, tileOrigin + Imath::V2i( GafferImage::ImagePlug::tileSize() ) );
-						const Box2i transferBound = IECore::boxIntersection( tileBound, gafferBox );
-
-						for( int y = transferBound.min.y; y<transferBound.max.y; ++y )
-						{
-							int srcY = m_gafferFormat.toEXRSpace( y );
-							size_t srcIndex = ( ( srcY - box.min.y ) * ( box.size().x + 1 ) + ( transferBound.min.x - box.min.x ) ) * numChannels + channelIndex;
-							size_t dstIndex = ( y - tileBound.min.y ) * ImagePlug::tileSize() + transferBound.min.x - tileBound.min.x;
-							const size_t srcEndIndex = srcIndex + transferBound.size().x * numChannels;
-							while( srcIndex < srcEndIndex )
-							{
-								buffer[dstIndex] = data[srcIndex];
-								srcIndex += numChannels;
-								dstIndex++;
-							}
-						}
-
-						tile->dirty = true;
+						const V2i tileOrigin = boxMinTileOrigin + V2i( i % numTiles.x, i / numTiles.x ) * ImagePlug::tileSize();
+						transferTile( tileOrigin, box, gafferBox, data );
 					}
-				}
-			}
+				},
+				taskGroupContext
+			);
 
 			dataReceivedSignal()( this, box );
 		}
@@ -349,6 +393,45 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			int cachedForDataCount;
 		};
 
+		// Transfers the part of `data` that overlaps the tile at `tileOrigin`
+		// into the back buffers for all channels of that tile.
+		void transferTile( const V2i &tileOrigin, const Imath::Box2i &box, const Imath::Box2i &gafferBox, const float *data )
+		{
+			const int numChannels = channelNames().size();
+			vector<Tile *> tiles( numChannels );
+			for( int channelIndex = 0; channelIndex < numChannels; ++channelIndex )
+			{
+				tiles[channelIndex] = getTile( tileOrigin, channelIndex );
+				if( !tiles[channelIndex] )
+				{
+					// we've been sent data outside of the data window
+					return;
+				}
+			}
+
+			const Box2i tileBound( tileOrigin, tileOrigin + Imath::V2i( GafferImage::ImagePlug::tileSize() ) );
+			const Box2i transferBound = IECore::boxIntersection( tileBound, gafferBox );
+			const size_t srcStride = ( box.size().x + 1 ) * numChannels;
+
+			vector<float *> buffers( numChannels );
+			for( int y = transferBound.min.y; y<transferBound.max.y; ++y )
+			{
+				const int srcY = m_gafferFormat.toEXRSpace( y );
+				const float *src = data + ( srcY - box.min.y ) * srcStride + ( transferBound.min.x - box.min.x ) * numChannels;
+				const size_t dstIndex = ( y - tileBound.min.y ) * ImagePlug::tileSize() + transferBound.min.x - tileBound.min.x;
+				for( int channelIndex = 0; channelIndex < numChannels; ++channelIndex )
+				{
+					buffers[channelIndex] = tiles[channelIndex]->backBuffer.data() + dstIndex;
+				}
+				deinterleave( src, numChannels, buffers.data(), transferBound.size().x );
+			}
+
+			for( auto tile : tiles )
+			{
+				tile->dirty = true;
+			}
+		}
+
 		Tile *getTile( const V2i &tileOrigin, unsigned int channelIndex )
 		{
 			V3i tileCoord( tileOrigin.x / ImagePlug::tileSize(), tileOrigin.y / ImagePlug::tileSize(), channelIndex );
@@ -681,9 +764,17 @@ struct PendingUpdates
 
 	tbb::spin_mutex mutex;
 	PlugSetPtr plugs;
+	// True while a call to `dataReceivedUI()` is queued.
+	bool scheduled = false;
+	// Time at which `dataReceivedUI()` last propagated dirtiness.
+	std::chrono::steady_clock::time_point lastUpdateTime;
 
 };
 
+// Each update causes the Viewer to request all the tiles it is showing,
+// so we limit the number of updates to 20 per second.
+const std::chrono::milliseconds g_minimumUpdateInterval( 50 );
+
 PendingUpdates &pendingUpdates()
 {
 	static PendingUpdates *p = new PendingUpdates;
@@ -705,19 +796,23 @@ void Display::dataReceived()
 	bool scheduleUpdate = false;
 	{
 		// To minimise overhead we perform updates in batches by storing
-		// a set of plugs which are pending update. If we're the creator
-		// of a new batch then we are responsible for scheduling a call
-		// to `dataReceivedUI()` to process the batch. Otherwise we just
-		// add to the current batch.
+		// a set of plugs which are pending update. Renderers may send many
+		// small buckets in quick succession, so we also allow only a single
+		// call to `dataReceivedUI()` to be queued at any time. Data received
+		// while it is queued just joins the current batch.
 		PendingUpdates &pending = pendingUpdates();
 		tbb::spin_mutex::scoped_lock lock( pending.mutex );
 		if( !pending.plugs.get() )
 		{
-			scheduleUpdate = true;
 			pending.plugs.reset( new PlugSet );
 		}
 		pending.plugs->insert( outPlug() );
+		if( !pending.scheduled )
+		{
+			pending.scheduled = scheduleUpdate = true;
+		}
 	}
+
 	if( scheduleUpdate )
 	{
 		ParallelAlgo::callOnUIThread( &Display::dataReceivedUI );
@@ -733,11 +828,22 @@ void Display::dataReceivedUI()
 	// affect performance.  We do this by "stealing" the current batch, so the
 	// background thread will create a new batch and we are safe to iterate our
 	// batch without holding the lock.
+	PendingUpdates &pending = pendingUpdates();
 	PlugSetPtr batch;
 	{
-		PendingUpdates &pending = pendingUpdates();
 		tbb::spin_mutex::scoped_lock lock( pending.mutex );
+		pending.scheduled = false;
+		const auto now = std::chrono::steady_clock::now();
+		if( !pending.plugs || now - pending.lastUpdateTime < g_minimumUpdateInterval )
+		{
+			// Too soon after the last update. Rather than wait, which would
+			// block the UI, we leave the batch pending. The next call to
+			// `dataReceived()` will schedule us again, and `imageReceivedUI()`
+			// flushes any updates still pending when the image is complete.
+			return;
+		}
 		batch.reset( pending.plugs.release() );
+		pending.lastUpdateTime = now;
 	}
 
 	// Now increment the update count for the Display nodes
@@ -768,5 +874,14 @@ void Display::imageReceived()
 
 void Display::imageReceivedUI( Ptr display )
 {
+	// Flush any updates held back by the rate limit in `dataReceivedUI()`,
+	// so that the final buckets are shown.
+	{
+		PendingUpdates &pending = pendingUpdates();
+		tbb::spin_mutex::scoped_lock lock( pending.mutex );
+		pending.lastUpdateTime = std::chrono::steady_clock::time_point();
+	}
+	dataReceivedUI();
+
 	imageReceivedSignal()( display->outPlug() );
 }
@@ -529,6 +529,21 @@ void GafferImage::ImageAlgo::throwIfSampleOffsetsMismatch( const IECore::IntVect
 	}
 }
 
+Imath::Box2i GafferImage::ImageAlgo::mipLevelWindow( const Imath::Box2i &window, int level )
+{
+	if( level <= 0 || BufferAlgo::empty( window ) )
+	{
+		return window;
+	}
+
+	// Arithmetic shifts round towards negative infinity, giving us floor
+	// for the inclusive min and ceil ( via negation ) for the exclusive max.
+	return Imath::Box2i(
+		Imath::V2i( window.min.x >> level, window.min.y >> level ),
+		Imath::V2i( -( -window.max.x >> level ), -( -window.max.y >> level ) )
+	);
+}
+
 bool GafferImage::ImageAlgo::viewIsValid( const Gaffer::Context *context, const std::vector< std::string > &viewNames )
 {
 	const std::string &viewName = context->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName );
@@ -37,11 +37,17 @@
 
 #include "GafferImage/ImageNode.h"
 
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/FormatPlug.h"
+#include "GafferImage/ImageAlgo.h"
 
 #include "Gaffer/Context.h"
 #include "Gaffer/ScriptNode.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -89,6 +95,16 @@ bool ImageNode::enabled() const
 	return enabledPlug()->getValue();
 };
 
+bool ImageNode::mipLevelsSupported( const Gaffer::Context *context ) const
+{
+	return false;
+}
+
+bool ImageNode::mipLevelFallback( const Gaffer::Context *context ) const
+{
+	return context->get<int>( ImagePlug::mipLevelContextName, 0 ) > 0 && !mipLevelsSupported( context );
+}
+
 void ImageNode::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	const ImagePlug *imagePlug = output->parent<ImagePlug>();
@@ -99,6 +115,12 @@ void ImageNode::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *co
 	}
 	if( imagePlug && enabledValue )
 	{
+		if( imagePlug == outPlug() && mipLevelFallback( context ) )
+		{
+			hashMipLevel( output, context, h );
+			return;
+		}
+
 		// We don't call ComputeNode::hash() immediately here, because for subclasses which
 		// want to pass through a specific hash in the hash*() methods it's a waste of time (the
 		// hash will get overwritten anyway). Instead we call ComputeNode::hash() in our
@@ -215,6 +237,12 @@ void ImageNode::compute( ValuePlug *output, const Context *context ) const
 		return;
 	}
 
+	if( imagePlug == outPlug() && mipLevelFallback( context ) )
+	{
+		computeMipLevel( output, context );
+		return;
+	}
+
 	// node is enabled - defer to our derived classes to perform the appropriate computation
 
 	if( output == imagePlug->viewNamesPlug() )
@@ -345,3 +373,234 @@ void ImageNode::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 		}
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////
+// Mip level fallback
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Scope used to evaluate the full resolution image.
+struct FullResolutionScope : public Context::EditableScope
+{
+	FullResolutionScope( const Context *context )
+		:	EditableScope( context )
+	{
+		remove( ImagePlug::mipLevelContextName );
+	}
+};
+
+void throwIfDeep( const ImagePlug *image )
+{
+	if( image->deepPlug()->getValue() )
+	{
+		throw IECore::Exception( "Mip levels are not supported for deep images" );
+	}
+}
+
+} // namespace
+
+void ImageNode::hashMipLevel( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	const ImagePlug *image = outPlug();
+	if( output == image->channelDataPlug() )
+	{
+		hashMipLevelChannelData( context, h );
+		return;
+	}
+
+	const int mipLevel = context->get<int>( ImagePlug::mipLevelContextName );
+	FullResolutionScope fullResolutionScope( context );
+
+	if( output == image->sampleOffsetsPlug() )
+	{
+		fullResolutionScope.remove( ImagePlug::tileOriginContextName );
+		throwIfDeep( image );
+		h = ImagePlug::flatTileSampleOffsets()->Object::hash();
+	}
+	else if( output == image->formatPlug() || output == image->dataWindowPlug() )
+	{
+		h = output->hash();
+		h.append( mipLevel );
+	}
+	else
+	{
+		// Everything else is independent of resolution, so we
+		// can share the full resolution result.
+		h = output->hash();
+	}
+}
+
+void ImageNode::computeMipLevel( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	const ImagePlug *image = outPlug();
+	if( output == image->channelDataPlug() )
+	{
+		static_cast<FloatVectorDataPlug *>( output )->setValue(
+			computeMipLevelChannelData( context )
+		);
+		return;
+	}
+
+	const int mipLevel = context->get<int>( ImagePlug::mipLevelContextName );
+	FullResolutionScope fullResolutionScope( context );
+
+	if( output == image->sampleOffsetsPlug() )
+	{
+		fullResolutionScope.remove( ImagePlug::tileOriginContextName );
+		throwIfDeep( image );
+		static_cast<IntVectorDataPlug *>( output )->setValue( ImagePlug::flatTileSampleOffsets() );
+	}
+	else if( output == image->formatPlug() )
+	{
+		const Format format = image->formatPlug()->getValue();
+		static_cast<AtomicFormatPlug *>( output )->setValue(
+			Format( ImageAlgo::mipLevelWindow( format.getDisplayWindow(), mipLevel ), format.getPixelAspect() )
+		);
+	}
+	else if( output == image->dataWindowPlug() )
+	{
+		static_cast<AtomicBox2iPlug *>( output )->setValue(
+			ImageAlgo::mipLevelWindow( image->dataWindowPlug()->getValue(), mipLevel )
+		);
+	}
+	else
+	{
+		// Everything else is independent of the mip level, so we want the
+		// full resolution value of this same plug. `output` is the plug we
+		// are computing, but `setFrom()` evaluates its source with
+		// `getValue()`, and the FullResolutionScope above has removed the
+		// mip level from the current context. This is therefore a separate,
+		// re-entrant evaluation of the plug in the full resolution context,
+		// where `mipLevelFallback()` is false. It dispatches to the usual
+		// `compute*()` methods, and it shares the full resolution cache
+		// entry, matching the hash from `hashMipLevel()`. It cannot recurse
+		// back to here.
+		const ValuePlug *fullResolutionOutput = output;
+		output->setFrom( fullResolutionOutput );
+	}
+}
+
+// Each level is computed by box filtering the four tiles of the level above
+// which it covers. These are evaluated from `outPlug()->channelDataPlug()`,
+// so each level is cached according to the node's own cache policy and
+// reused by the next. Nodes whose channel data is uncached recompute each
+// coarser level from the finer ones on every request.
+
+void ImageNode::hashMipLevelChannelData( const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	ComputeNode::hash( outPlug()->channelDataPlug(), context, h );
+
+	const int finerLevel = context->get<int>( ImagePlug::mipLevelContextName ) - 1;
+	const V2i &tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+
+	Box2i finerDataWindow;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		globalScope.remove( ImagePlug::mipLevelContextName );
+		throwIfDeep( outPlug() );
+		finerDataWindow = ImageAlgo::mipLevelWindow( outPlug()->dataWindowPlug()->getValue(), finerLevel );
+	}
+
+	ImagePlug::ChannelDataScope finerScope( context );
+	if( finerLevel > 0 )
+	{
+		finerScope.set( ImagePlug::mipLevelContextName, &finerLevel );
+	}
+	else
+	{
+		finerScope.remove( ImagePlug::mipLevelContextName );
+	}
+
+	const int tileSize = ImagePlug::tileSize();
+	for( int i = 0; i < 4; ++i )
+	{
+		const V2i finerTileOrigin = tileOrigin * 2 + V2i( i % 2, i / 2 ) * tileSize;
+		const Box2i validBound = BufferAlgo::intersection( finerDataWindow, Box2i( finerTileOrigin, finerTileOrigin + V2i( tileSize ) ) );
+		h.append( validBound );
+		if( !BufferAlgo::empty( validBound ) )
+		{
+			finerScope.setTileOrigin( &finerTileOrigin );
+			outPlug()->channelDataPlug()->hash( h );
+		}
+	}
+}
+
+IECore::ConstFloatVectorDataPtr ImageNode::computeMipLevelChannelData( const Gaffer::Context *context ) const
+{
+	const int finerLevel = context->get<int>( ImagePlug::mipLevelContextName ) - 1;
+	const V2i &tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+
+	Box2i finerDataWindow;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		globalScope.remove( ImagePlug::mipLevelContextName );
+		finerDataWindow = ImageAlgo::mipLevelWindow( outPlug()->dataWindowPlug()->getValue(), finerLevel );
+	}
+
+	const int tileSize = ImagePlug::tileSize();
+	const int halfTileSize = tileSize / 2;
+
+	FloatVectorDataPtr resultData = new FloatVectorData;
+	vector<float> &result = resultData->writable();
+	result.resize( ImagePlug::tilePixels(), 0.0f );
+
+	// Each quadrant of the result is filtered from a different tile
+	// of the finer level, so we can fetch them in parallel. We don't
+	// know the cache policy our derived class has chosen for the channel
+	// data, so we isolate the tasks. This means this thread will not steal
+	// outer tasks while it waits, so it can never wait on itself.
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::this_task_arena::isolate(
+		[&] {
+			tbb::parallel_for(
+				tbb::blocked_range<int>( 0, 4, 1 ),
+				[&] ( const tbb::blocked_range<int> &range ) {
+
+					ImagePlug::ChannelDataScope finerScope( threadState );
+					if( finerLevel > 0 )
+					{
+						finerScope.set( ImagePlug::mipLevelContextName, &finerLevel );
+					}
+					else
+					{
+						finerScope.remove( ImagePlug::mipLevelContextName );
+					}
+
+					for( int i = range.begin(); i != range.end(); ++i )
+					{
+						const V2i quadrant( i % 2, i / 2 );
+						const V2i finerTileOrigin = tileOrigin * 2 + quadrant * tileSize;
+						const Box2i validBound = BufferAlgo::intersection( finerDataWindow, Box2i( finerTileOrigin, finerTileOrigin + V2i( tileSize ) ) );
+						if( BufferAlgo::empty( validBound ) )
+						{
+							continue;
+						}
+
+						finerScope.setTileOrigin( &finerTileOrigin );
+						ConstFloatVectorDataPtr finerData = outPlug()->channelDataPlug()->getValue();
+						const float *finer = finerData->readable().data();
+
+						// Pixels outside the data window are treated as black.
+						const Box2i localBound( validBound.min - finerTileOrigin, validBound.max - finerTileOrigin );
+						for( int y = localBound.min.y; y < localBound.max.y; ++y )
+						{
+							const float *in = finer + y * tileSize;
+							float *out = result.data() + ( quadrant.y * halfTileSize + y / 2 ) * tileSize + quadrant.x * halfTileSize;
+							for( int x = localBound.min.x; x < localBound.max.x; ++x )
+							{
+								out[x/2] += in[x] * 0.25f;
+							}
+						}
+					}
+				},
+				taskGroupContext
+			);
+		}
+	);
+
+	return resultData;
+}
@@ -46,6 +46,10 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
 
+#include "IECore/MessageHandler.h"
+
+#include <cstdlib>
+
 using namespace std;
 using namespace tbb;
 using namespace Imath;
@@ -62,6 +66,7 @@ GAFFER_PLUG_DEFINE_TYPE( ImagePlug );
 const IECore::InternedString ImagePlug::channelNameContextName = "image:channelName";
 const IECore::InternedString ImagePlug::viewNameContextName = "image:viewName";
 const IECore::InternedString ImagePlug::tileOriginContextName = "image:tileOrigin";
+const IECore::InternedString ImagePlug::mipLevelContextName = "image:mipLevel";
 
 const std::string ImagePlug::defaultViewName = "default";
 
@@ -70,7 +75,71 @@ static ContextAlgo::GlobalScope::Registration g_globalScopeRegistration(
 	{ ImagePlug::channelNameContextName, ImagePlug::tileOriginContextName }
 );
 
+namespace
+{
+
+#if GAFFERIMAGE_TILE_SIZE_LOG2
+
+bool warnIfTileSizeEnvironmentIgnored()
+{
+	const char *e = getenv( "GAFFERIMAGE_TILE_SIZE_LOG2" );
+	if( e && atoi( e ) != ImagePlug::tileSizeLog2() )
+	{
+		IECore::msg( IECore::Msg::Warning, "ImagePlug", "Ignoring GAFFERIMAGE_TILE_SIZE_LOG2 because the tile size was fixed when Gaffer was built." );
+	}
+	return true;
+}
+
+const bool g_warnedIfTileSizeEnvironmentIgnored = warnIfTileSizeEnvironmentIgnored();
+
+#else
+
+int tileSizeLog2FromEnvironment()
+{
+	const char *e = getenv( "GAFFERIMAGE_TILE_SIZE_LOG2" );
+	if( !e )
+	{
+		return 7;
+	}
+
+	const int result = atoi( e );
+	if( result < 6 || result > 9 )
+	{
+		IECore::msg( IECore::Msg::Warning, "ImagePlug", "Invalid value for GAFFERIMAGE_TILE_SIZE_LOG2. Must be between 6 and 9." );
+		return 7;
+	}
+
+	return result;
+}
+
+#endif
+
+} // namespace
+
 size_t ImagePlug::g_firstPlugIndex = 0;
+#if !GAFFERIMAGE_TILE_SIZE_LOG2
+int ImagePlug::g_tileSizeLog2 = tileSizeLog2FromEnvironment();
+#endif
+
+namespace
+{
+
+// Tile data computed with one tile size is not valid for another, so we
+// must not share persistent cache entries between processes using different
+// tile sizes. Must be defined after `g_tileSizeLog2` so that it is initialised
+// first.
+bool registerPersistentCacheKeyComponent()
+{
+	IECore::MurmurHash h;
+	h.append( "GafferImage:tileSizeLog2" );
+	h.append( ImagePlug::tileSizeLog2() );
+	ValuePlug::addPersistentCacheKeyComponent( h );
+	return true;
+}
+
+const bool g_persistentCacheKeyComponentRegistered = registerPersistentCacheKeyComponent();
+
+} // namespace
 
 ImagePlug::ImagePlug( const std::string &name, Direction direction, unsigned flags )
 	:	ValuePlug( name, direction, flags )
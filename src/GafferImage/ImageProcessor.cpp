@@ -40,9 +40,60 @@
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
 
+#include "boost/algorithm/string/join.hpp"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
+namespace
+{
+
+const InternedString g_channelGroupContextName( "image:imageProcessor:__channelGroup" );
+
+// Scope used to evaluate `channelGroupPlug()` for a particular group.
+// The channel name is removed so that all channels in the group share
+// the same cache entry.
+class ChannelGroupScope : public Context::EditableScope
+{
+
+	public :
+
+		ChannelGroupScope( const Context *context, const vector<string> &channels )
+			:	EditableScope( context ), m_channels( channels.begin(), channels.end() )
+		{
+			remove( ImagePlug::channelNameContextName );
+			set( g_channelGroupContextName, &m_channels );
+		}
+
+	private :
+
+		vector<InternedString> m_channels;
+
+};
+
+vector<string> channelGroupFromContext( const Context *context )
+{
+	const vector<InternedString> &channels = context->get<vector<InternedString>>( g_channelGroupContextName );
+	return vector<string>( channels.begin(), channels.end() );
+}
+
+size_t channelGroupIndex( const vector<string> &group, const string &channel )
+{
+	const size_t result = std::find( group.begin(), group.end(), channel ) - group.begin();
+	if( result == group.size() )
+	{
+		throw IECore::Exception( "Channel \"" + channel + "\" not found in channel group \"" + boost::algorithm::join( group, " " ) + "\"" );
+	}
+	return result;
+}
+
+} // namespace
+
 GAFFER_NODE_DEFINE_TYPE( ImageProcessor );
 
 size_t ImageProcessor::g_firstPlugIndex = 0;
@@ -123,8 +174,51 @@ const Plug *ImageProcessor::correspondingInput( const Plug *output ) const
 	return ImageNode::correspondingInput( output );
 }
 
+const Gaffer::ObjectPlug *ImageProcessor::channelGroupPlug() const
+{
+	return nullptr;
+}
+
+void ImageProcessor::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
+{
+	ImageNode::affects( input, outputs );
+
+	if( input == channelGroupPlug() )
+	{
+		outputs.push_back( outPlug()->channelDataPlug() );
+	}
+}
+
+std::vector<std::string> ImageProcessor::channelGroup( const std::string &channel, const Gaffer::Context *context ) const
+{
+	return {};
+}
+
+void ImageProcessor::hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	ComputeNode::hash( channelGroupPlug(), context, h );
+}
+
+IECore::ConstObjectVectorPtr ImageProcessor::computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const
+{
+	throw IECore::NotImplementedException( string( typeName() ) + "::computeChannelGroup" );
+}
+
 void ImageProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
+	if( output == channelGroupPlug() )
+	{
+		const vector<string> channels = channelGroupFromContext( context );
+		// Remove the group so that it isn't seen by upstream evaluations.
+		Context::EditableScope scope( context );
+		scope.remove( g_channelGroupContextName );
+		hashChannelGroup(
+			channels, context->get<V2i>( ImagePlug::tileOriginContextName ),
+			scope.context(), h
+		);
+		return;
+	}
+
 	const ImagePlug *imagePlug = output->parent<ImagePlug>();
 	if( !imagePlug )
 	{
@@ -153,16 +247,51 @@ void ImageProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Contex
 	if( passThrough )
 	{
 		h = inPlug()->getChild<ValuePlug>( output->getName() )->hash();
+		return;
 	}
-	else
+
+	if( output == outPlug()->channelDataPlug() && channelGroupPlug() && !mipLevelFallback( context ) )
 	{
-		// normal operation - just let the base class take care of it.
-		ImageNode::hash( output, context, h );
+		const std::string &channel = context->get<std::string>( ImagePlug::channelNameContextName );
+		const vector<string> group = channelGroup( channel, context );
+		if( !group.empty() )
+		{
+			// View onto the group result.
+			const size_t index = channelGroupIndex( group, channel );
+			ChannelGroupScope channelGroupScope( context, group );
+			h = channelGroupPlug()->hash();
+			h.append( (uint64_t)index );
+			return;
+		}
 	}
+
+	// normal operation - just let the base class take care of it.
+	ImageNode::hash( output, context, h );
 }
 
 void ImageProcessor::compute( ValuePlug *output, const Context *context ) const
 {
+	if( output == channelGroupPlug() )
+	{
+		const vector<string> channels = channelGroupFromContext( context );
+		Context::EditableScope scope( context );
+		scope.remove( g_channelGroupContextName );
+		ConstObjectVectorPtr result = computeChannelGroup( channels, context->get<V2i>( ImagePlug::tileOriginContextName ), scope.context() );
+		if( result->members().size() != channels.size() )
+		{
+			throw IECore::Exception( "Channel group result has wrong number of channels" );
+		}
+		for( const auto &m : result->members() )
+		{
+			if( !runTimeCast<const FloatVectorData>( m.get() ) )
+			{
+				throw IECore::Exception( "Channel group result must contain only FloatVectorData" );
+			}
+		}
+		static_cast<ObjectPlug *>( output )->setValue( result );
+		return;
+	}
+
 	const ImagePlug *imagePlug = output->parent<ImagePlug>();
 	if( !imagePlug )
 	{
@@ -189,10 +318,28 @@ void ImageProcessor::compute( ValuePlug *output, const Context *context ) const
 	if( passThrough )
 	{
 		output->setFrom( inPlug()->getChild<ValuePlug>( output->getName() ) );
+		return;
 	}
-	else
+
+	if( output == outPlug()->channelDataPlug() && channelGroupPlug() && !mipLevelFallback( context ) )
 	{
-		// normal operation - just let the base class take care of it.
-		ImageNode::compute( output, context );
+		const std::string &channel = context->get<std::string>( ImagePlug::channelNameContextName );
+		const vector<string> group = channelGroup( channel, context );
+		if( !group.empty() )
+		{
+			const size_t index = channelGroupIndex( group, channel );
+			ConstObjectVectorPtr groupData;
+			{
+				ChannelGroupScope channelGroupScope( context, group );
+				groupData = boost::static_pointer_cast<const ObjectVector>( channelGroupPlug()->getValue() );
+			}
+			static_cast<FloatVectorDataPlug *>( output )->setValue(
+				boost::static_pointer_cast<const FloatVectorData>( groupData->members()[index] )
+			);
+			return;
+		}
 	}
+
+	// normal operation - just let the base class take care of it.
+	ImageNode::compute( output, context );
 }
@@ -457,6 +457,11 @@ void ImageReader::compute( ValuePlug *output, const Context *context ) const
 	}
 }
 
+bool ImageReader::mipLevelsSupported( const Gaffer::Context *context ) const
+{
+	return true;
+}
+
 void ImageReader::hashViewNames( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	FrameMaskScope scope( context, this, /* clampBlack = */ true );
@@ -68,6 +68,7 @@
 #include "boost/functional/hash.hpp"
 
 #include "tbb/spin_mutex.h"
+#include "tbb/task_scheduler_init.h"
 
 #include "fmt/format.h"
 
@@ -109,6 +110,64 @@ inline int divFloor( int a, int b )
 	return a / b - ( ( a % b ) < 0 );
 }
 
+// OpenEXR compresses the chunks passed to a single write call in parallel,
+// using its own thread pool. Chunks span a number of scanlines which depends
+// on the compression method, so we use this to decide how many scanlines we
+// should pass to each `write_scanlines()` call.
+int exrScanlinesPerChunk( const ImageSpec &spec )
+{
+	string compression = spec.get_string_attribute( "compression" );
+	compression = compression.substr( 0, compression.find( ':' ) );
+	if( compression == "zip" || compression == "pxr24" )
+	{
+		return 16;
+	}
+	else if( compression == "piz" || compression == "b44" || compression == "b44a" || compression == "dwaa" )
+	{
+		return 32;
+	}
+	else if( compression == "dwab" )
+	{
+		return 256;
+	}
+	// none, rle, zips
+	return 1;
+}
+
+// Returns the number of rows of Gaffer tiles that FlatScanlineWriter should
+// buffer before writing, so that each write contains enough chunks to occupy
+// every thread.
+int scanlineWriteTileRows( const ImageOutput *out, const ImageSpec &spec, size_t numChannels )
+{
+	if( strcmp( out->format_name(), "openexr" ) )
+	{
+		return 1;
+	}
+
+	const int numThreads = tbb::task_scheduler_init::default_num_threads();
+	const int targetScanlines = exrScanlinesPerChunk( spec ) * numThreads;
+	const int tileRows = ( targetScanlines + ImagePlug::tileSize() - 1 ) / ImagePlug::tileSize();
+
+	// Limit the memory used by the buffer. The limit scales with the number
+	// of threads, since we need a chunk per thread to keep them all busy. 64MB
+	// per thread is enough for a 32 scanline chunk of a 4K image with 128 channels.
+	const size_t maxBytes = (size_t)numThreads * 64 * 1024 * 1024;
+	const size_t tileRowBytes = (size_t)spec.width * ImagePlug::tileSize() * numChannels * sizeof( float );
+	const int maxTileRows = std::max<size_t>( 1, maxBytes / std::max<size_t>( tileRowBytes, 1 ) );
+
+	return std::max( 1, std::min( tileRows, maxTileRows ) );
+}
+
+// Returns the `maxTilesInFlight` value to use with `PipelinedGather`,
+// which limits the number of tiles queued for the writer thread. Each
+// tile holds all the channels being written, so we derive it from a
+// budget of single channel tiles.
+size_t maxTilesInFlight( size_t numChannels )
+{
+	const size_t maxChannelTiles = 16 * tbb::task_scheduler_init::default_num_threads();
+	return std::max<size_t>( 1, maxChannelTiles / std::max<size_t>( numChannels, 1 ) );
+}
+
 void copyBufferArea( const float *inData, const Imath::Box2i &inArea, float *outData, const Imath::Box2i &outArea, const size_t outOffset = 0, const size_t outInc = 1, const bool outYDown = false, Imath::Box2i copyArea = Imath::Box2i() )
 {
 	if( BufferAlgo::empty( copyArea ) )
@@ -282,6 +341,10 @@ class FlatTileWriter
 	// black, which is what we want. So iterate over the remaining tiles, and
 	// if memory has been allocated for that tile, write it to the file, and if
 	// nothing has been allocated, write a black tile.
+	//
+	// For OpenEXR files, consecutive tiles within a row are written with a
+	// single `write_tiles()` call, so that OpenEXR can compress them in
+	// parallel.
 	public:
 		FlatTileWriter(
 				ImageOutputPtr out,
@@ -300,7 +363,8 @@ class FlatTileWriter
 				m_outputDataWindow( m_format.fromEXRSpace( Imath::Box2i( Imath::V2i( m_spec.x, m_spec.y ), Imath::V2i( m_spec.x + m_spec.width - 1, m_spec.y + m_spec.height - 1 ) ) ) ),
 				m_numTiles( Imath::V2i( (int)ceil( float( m_spec.width ) / m_spec.tile_width ), (int)ceil( float( m_spec.height ) / m_spec.tile_height ) ) ),
 				m_nextTileIndex( 0 ),
-				m_blackTile( nullptr )
+				m_blackTile( nullptr ),
+				m_batchTiles( !strcmp( m_out->format_name(), "openexr" ) )
 		{
 			m_tilesData.resize( m_numTiles.x * m_numTiles.y );
 			m_tilesFilled.resize( m_numTiles.x * m_numTiles.y, false );
@@ -436,27 +500,78 @@ class FlatTileWriter
 
 		void writeFilledTiles()
 		{
-			size_t tileIndex;
-			for( tileIndex = m_nextTileIndex; tileIndex < m_tilesData.size(); ++tileIndex )
+			size_t endIndex;
+			for( endIndex = m_nextTileIndex; endIndex < m_tilesData.size(); ++endIndex )
 			{
-				Imath::V2i tileOrigin = outTileOrigin( tileIndex );
-
-				if( m_tilesFilled[tileIndex] )
+				if( !m_tilesFilled[endIndex] && BufferAlgo::intersects( m_inputTilesBounds, outTileBounds( endIndex ) ) )
 				{
-					writeTile( tileOrigin, m_tilesData[tileIndex] );
-					m_tilesData[tileIndex].reset();
+					break;
 				}
-				else if( !BufferAlgo::intersects( m_inputTilesBounds, outTileBounds( tileIndex ) ) )
+			}
+
+			size_t rowBeginIndex = m_nextTileIndex;
+			while( rowBeginIndex < endIndex )
+			{
+				const size_t rowEndIndex = std::min( endIndex, ( rowBeginIndex / m_numTiles.x + 1 ) * m_numTiles.x );
+				if( m_batchTiles && rowEndIndex - rowBeginIndex > 1 )
 				{
-					writeTile( tileOrigin, blackTile() );
+					writeTiles( rowBeginIndex, rowEndIndex );
 				}
 				else
 				{
-					break;
+					for( size_t tileIndex = rowBeginIndex; tileIndex < rowEndIndex; ++tileIndex )
+					{
+						writeTile( outTileOrigin( tileIndex ), filledTileData( tileIndex ) );
+					}
+				}
+
+				for( size_t tileIndex = rowBeginIndex; tileIndex < rowEndIndex; ++tileIndex )
+				{
+					m_tilesData[tileIndex].reset();
 				}
+				rowBeginIndex = rowEndIndex;
 			}
 
-			m_nextTileIndex = tileIndex;
+			m_nextTileIndex = endIndex;
+		}
+
+		inline ConstFloatVectorDataPtr filledTileData( size_t tileIndex )
+		{
+			return m_tilesFilled[tileIndex] ? m_tilesData[tileIndex] : blackTile();
+		}
+
+		// Writes a run of tiles from a single row with one call, copying them
+		// into a contiguous buffer first.
+		void writeTiles( size_t beginIndex, size_t endIndex )
+		{
+			const Imath::V2i exrBegin = m_format.toEXRSpace( outTileOrigin( beginIndex ) + Imath::V2i( 0, m_spec.tile_height - 1 ) );
+			const Imath::V2i exrEnd(
+				std::min<int>( exrBegin.x + ( endIndex - beginIndex ) * m_spec.tile_width, m_spec.x + m_spec.width ),
+				std::min<int>( exrBegin.y + m_spec.tile_height, m_spec.y + m_spec.height )
+			);
+
+			const size_t numChannels = m_channels.size();
+			const int width = exrEnd.x - exrBegin.x;
+			const int height = exrEnd.y - exrBegin.y;
+			m_tilesRowData.resize( (size_t)width * height * numChannels );
+
+			for( size_t tileIndex = beginIndex; tileIndex < endIndex; ++tileIndex )
+			{
+				ConstFloatVectorDataPtr tileData = filledTileData( tileIndex );
+				const float *source = tileData->readable().data();
+				const int x = ( tileIndex - beginIndex ) * m_spec.tile_width;
+				const size_t copySize = std::min( m_spec.tile_width, width - x ) * numChannels;
+				for( int y = 0; y < height; ++y )
+				{
+					const float *sourceRow = source + (size_t)y * m_spec.tile_width * numChannels;
+					std::copy( sourceRow, sourceRow + copySize, m_tilesRowData.data() + ( (size_t)y * width + x ) * numChannels );
+				}
+			}
+
+			if( !m_out->write_tiles( exrBegin.x, exrEnd.x, exrBegin.y, exrEnd.y, 0, 1, TypeDesc::FLOAT, m_tilesRowData.data() ) )
+			{
+				throw IECore::Exception( fmt::format( "Could not write tiles to \"{}\", error = {}", m_fileName, m_out->geterror() ) );
+			}
 		}
 
 
@@ -483,6 +598,8 @@ class FlatTileWriter
 		std::vector<FloatVectorDataPtr> m_tilesData;
 		std::vector<bool> m_tilesFilled;
 		ConstFloatVectorDataPtr m_blackTile;
+		const bool m_batchTiles;
+		std::vector<float> m_tilesRowData;
 };
 
 class FlatScanlineWriter
@@ -494,11 +611,13 @@ class FlatScanlineWriter
 	// scanlines that fall between the start of the image and the start of the
 	// data that it is going to be given.
 	//
-	// It stores a vector of floats big enough to hold ImagePlug::tileSize()
-	// scanlines. As it receives each tile, it copies the data into the
-	// appropriate location in the buffer. When it's copied the last channel
-	// of the last tile of each row, it writes all of the data from the buffer
-	// into the ImageOutput object.
+	// It stores a vector of floats big enough to hold one or more rows of
+	// tiles, each ImagePlug::tileSize() scanlines high. As it receives each
+	// tile, it copies the data into the appropriate location in the buffer.
+	// When it's copied the last channel of the last tile of the last row in
+	// the buffer, it writes all of the data from the buffer into the
+	// ImageOutput object. Buffering several rows allows OpenEXR to compress
+	// more chunks in parallel.
 	public:
 		FlatScanlineWriter(
 				ImageOutputPtr out,
@@ -513,9 +632,12 @@ class FlatScanlineWriter
 				m_channels( channels ),
 				m_spec( m_out->spec() ),
 				m_processWindow( processWindow ),
-				m_tilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) )
+				m_tilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) ),
+				m_bufferTileRows( scanlineWriteTileRows( m_out.get(), m_spec, m_channels.size() ) ),
+				m_bufferedTileRows( 0 ),
+				m_bufferExrBegin( 0 )
 		{
-			m_scanlinesData.resize( m_spec.width * ImagePlug::tileSize() * m_channels.size(), 0.0 );
+			m_scanlinesData.resize( (size_t)m_spec.width * ImagePlug::tileSize() * m_bufferTileRows * m_channels.size(), 0.0 );
 
 			writeInitialBlankScanlines();
 		}
@@ -545,22 +667,29 @@ class FlatScanlineWriter
 			const Imath::Box2i exrScanlinesBounds( Imath::V2i( m_spec.x, exrInTileBounds.min.y ), Imath::V2i( m_spec.x + m_spec.width - 1, exrInTileBounds.max.y ) );
 			const Imath::Box2i scanlinesBounds( m_format.fromEXRSpace( exrScanlinesBounds ) );
 
-			if( firstTileOfRow( channelIndex, tileOrigin ) )
+			if( firstTileOfRow( channelIndex, tileOrigin ) && !m_bufferedTileRows )
 			{
 				std::fill( m_scanlinesData.begin(), m_scanlinesData.end(), 0.0 );
+				m_bufferExrBegin = exrInTileBounds.min.y;
 			}
 
 			Imath::Box2i copyArea( BufferAlgo::intersection( m_processWindow, BufferAlgo::intersection( inTileBounds, scanlinesBounds ) ) );
 
-			copyBufferArea( &data->readable()[0], inTileBounds, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_channels.size(), true, copyArea );
+			float *rowData = &m_scanlinesData[0] + (size_t)( exrInTileBounds.min.y - m_bufferExrBegin ) * m_spec.width * m_channels.size();
+			copyBufferArea( &data->readable()[0], inTileBounds, rowData, scanlinesBounds, channelIndex, m_channels.size(), true, copyArea );
 
 			if( lastTileOfRow( channelIndex, tileOrigin ) )
 			{
-				writeScanlines(
-					std::max( exrInTileBounds.min.y, m_spec.y ),
-					std::min( exrInTileBounds.max.y + 1, m_spec.y + m_spec.height ),
-					std::max( m_spec.y - exrInTileBounds.min.y, 0 )
-				);
+				m_bufferedTileRows++;
+				if( m_bufferedTileRows == m_bufferTileRows || tileOrigin.y == m_tilesBounds.min.y )
+				{
+					writeScanlines(
+						std::max( m_bufferExrBegin, m_spec.y ),
+						std::min( exrInTileBounds.max.y + 1, m_spec.y + m_spec.height ),
+						std::max( m_spec.y - m_bufferExrBegin, 0 )
+					);
+					m_bufferedTileRows = 0;
+				}
 			}
 		}
 
@@ -586,11 +715,12 @@ class FlatScanlineWriter
 
 		void writeBlankScanlines( int yBegin, int yEnd )
 		{
+			const int bufferScanlines = ImagePlug::tileSize() * m_bufferTileRows;
 			float *scanlines = &m_scanlinesData[0];
-			memset( scanlines, 0, sizeof(float) * m_spec.width * std::min( ImagePlug::tileSize(), yEnd - yBegin ) * m_channels.size() );
+			memset( scanlines, 0, sizeof(float) * m_spec.width * std::min( bufferScanlines, yEnd - yBegin ) * m_channels.size() );
 			while( yBegin < yEnd )
 			{
-				const int numLines = std::min( yEnd - yBegin, ImagePlug::tileSize() );
+				const int numLines = std::min( yEnd - yBegin, bufferScanlines );
 				writeScanlines( yBegin, yBegin + numLines );
 				yBegin += numLines;
 			}
@@ -620,6 +750,9 @@ class FlatScanlineWriter
 		const ImageSpec m_spec;
 		const Imath::Box2i &m_processWindow;
 		const Imath::Box2i m_tilesBounds;
+		const int m_bufferTileRows;
+		int m_bufferedTileRows;
+		int m_bufferExrBegin;
 		vector<float> m_scanlinesData;
 };
 
@@ -2139,13 +2272,13 @@ void ImageWriter::execute() const
 			if ( part.spec.tile_width == 0 )
 			{
 				FlatScanlineWriter flatScanlineWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom, ImageAlgo::PipelinedGather, maxTilesInFlight( part.channels.size() ) );
 				flatScanlineWriter.finish();
 			}
 			else
 			{
 				FlatTileWriter flatTileWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatTileWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatTileWriter, part.processDataWindow, ImageAlgo::TopToBottom, ImageAlgo::PipelinedGather, maxTilesInFlight( part.channels.size() ) );
 				flatTileWriter.finish();
 			}
 
@@ -2165,12 +2298,12 @@ void ImageWriter::execute() const
 			if( part.spec.tile_width == 0 )
 			{
 				DeepScanlineWriter deepScanlineWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels, sampleOffsetsAccumulator.m_sampleOffsets );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom, ImageAlgo::PipelinedGather, maxTilesInFlight( part.channels.size() ) );
 			}
 			else
 			{
 				DeepTileWriter deepTileWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels, sampleOffsetsAccumulator.m_sampleOffsets );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepTileWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepTileWriter, part.processDataWindow, ImageAlgo::TopToBottom, ImageAlgo::PipelinedGather, maxTilesInFlight( part.channels.size() ) );
 			}
 		}
 	}
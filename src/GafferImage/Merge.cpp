@@ -42,8 +42,15 @@
 #include "Gaffer/Context.h"
 
 #include "IECore/BoxOps.h"
+#include "IECore/ObjectVector.h"
+#include "IECore/VectorTypedData.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 
 #include "fmt/format.h"
+
+#include <algorithm>
 #include <limits>
 
 using namespace std;
@@ -205,73 +212,6 @@ typename Functor::ReturnType dispatchOperation( Merge::Operation op, Functor &&f
 	}
 }
 
-// This somewhat complex function is used only within the implementation of the tileRegion function
-// The interface is a bit weird because performance is potentially critical and it's tied directly
-// to tileRegion.
-// It computes whether a position is inside a given bounding box, and where the next pixel index is
-// where this would switch from inside to outside.
-// The input position is supplied as both an unwrapped pixel index "i", and also the same position
-// is supplied in "coord" as an x/y coordinate relative to the tile origin.
-// The bound "b" is a bounding box relative to the tile origin
-// The parameter "in" is set based on whether the current index is inside "b", and the return
-// value is the next pixel index where the value of "in" would change ( or tilePixels() if we can
-// process all the way to the end of the tile without "in" changing )
-inline int nextBoxBoundaryIndex( int i, const V2i &coord, const Box2i &b, bool &in )
-{
-	if( BufferAlgo::contains( b, coord ) )
-	{
-		in = true;
-
-		if( b.min.x == 0 && b.max.x == ImagePlug::tileSize() )
-		{
-			// Data fills full width, we will stay in this region until we reach the bottom
-			return b.max.y * ImagePlug::tileSize();
-		}
-		else
-		{
-			// We will exit this region when we reach the end of it on this scanline
-			return coord.y * ImagePlug::tileSize() + b.max.x;
-		}
-	}
-	else
-	{
-		in = false;
-
-		if( BufferAlgo::empty( b ) )
-		{
-			// We never enter this box
-			return ImagePlug::tilePixels();
-		}
-
-		int first = ImagePlug::pixelIndex( b.min, V2i( 0 ) );
-		if( i < first )
-		{
-			// We're before the box, so we'll eventually enter the first pixel of it
-			return first;
-		}
-		else if( i >= ImagePlug::pixelIndex( b.max - V2i( 1 ), V2i( 0 ) ) )
-		{
-			// We're after the box, we'll never enter
-			return ImagePlug::tilePixels();
-		}
-		else
-		{
-			// We're within the index region covered by the box, which must mean we're
-			// in between scanlines covered by the box
-			if( coord.x < b.min.x )
-			{
-				// We're before the scanline for coord.y
-				return coord.y * ImagePlug::tileSize() + b.min.x;
-			}
-			else
-			{
-				// We're after the current scanline, return the beginning of the next scanline
-				return ( coord.y + 1 ) * ImagePlug::tileSize() + b.min.x;
-			}
-		}
-	}
-}
-
 enum MergeRegion
 {
 	// Values chosen to work as bitmask
@@ -281,241 +221,6 @@ enum MergeRegion
 	InsideBoth = 3
 };
 
-// We divide the tile up into regions of continuous pixels that fit into one of the categories in the MergeRegion
-// struct.  This function returns which of the 4 kinds of regions we are in, and the length of the current region.
-// This tells us how many pixel values we can process before we need to re-evaluate what region we are in.
-// The index i and length are unwrapped pixel indices, which means that if the tile is entirely inside or outside
-// both bounds are either completely full or completely empty, length will be set to ImagePlug::tilePixels(), and
-// the entire tile can be processed in one go.
-// The inputs boundA and boundB are local bounding boxes relative to the origin of the current tile
-inline MergeRegion tileRegion( int i, const Box2i &boundA, const Box2i &boundB, int &length )
-{
-	bool inA = false;
-	bool inB = false;
-
-	V2i coord = ImagePlug::indexPixel( i, V2i( 0 ) );
-	int next = std::min(
-		nextBoxBoundaryIndex( i, coord, boundA, inA ),
-		nextBoxBoundaryIndex( i, coord, boundB, inB )
-	);
-
-	length = next - i;
-	return (MergeRegion)(( InsideA * inA ) | ( InsideB * inB ));
-}
-
-struct MergeFunctor
-{
-	using ReturnType = void;
-
-	// Merge channelData based on the current Op
-	// Based on our convention for merges we output to channelDataB and alphaDataB - we accumulate to the
-	// first input
-	// The result may just be repointing these pointers to do a whole tile passthrough.
-	// If both bounds are non-zero however, it will require allocating the merge buffers,
-	// and actually performing per-pixel operations into them
-	// boundB and boundA are local tile bounds, relative to the tile origin
-	template< class Op >
-	ReturnType operator()(
-		const Box2i &boundB,
-		ConstFloatVectorDataPtr &channelDataB,
-		ConstFloatVectorDataPtr &alphaDataB,
-		const Box2i &boundA,
-		const ConstFloatVectorDataPtr &channelDataA,
-		const ConstFloatVectorDataPtr &alphaDataA,
-		FloatVectorDataPtr &mergeChannelBuffer,
-		FloatVectorDataPtr &mergeAlphaBuffer,
-		bool partialBound
-	)
-	{
-		if( !channelDataB )
-		{
-			// If we have no prior input, just initialize
-			channelDataB = channelDataA;
-			alphaDataB = alphaDataA;
-
-			/// \todo If we have no connection
-			/// to in[0] then should that not be treated as being a black image, so
-			/// we should unconditionally initaliase with in[0] and then always use
-			/// the operation for in[1:], even if in[0] is disconnected. In other
-			/// words, shouldn't multiplying a white constant over an unconnected
-			/// in[0] produce black?
-			/// Note:  More recently John and I have discussed this, and I think
-			/// we're happy with the status quo.  There isn't an obviously clear
-			/// answer to what should happen with unconnected inputs.  The
-			/// current behaviour isn't confusing, and it's pretty reasonable to
-			/// connect a black input if you actually want to multiply to black
-
-			return;
-		}
-
-		bool emptyA = BufferAlgo::empty( boundA ) ||
-			( channelDataA == ImagePlug::blackTile() && alphaDataA == ImagePlug::blackTile() );
-		bool emptyB = BufferAlgo::empty( boundB ) ||
-			( channelDataB == ImagePlug::blackTile() && alphaDataB == ImagePlug::blackTile() );
-
-		// If both inputs are blackTile, or the operator is black when one input is black,
-		// we may be able to just pass through blackTile for the whole tile
-		if(
-			( emptyA && emptyB ) ||
-			( !partialBound && emptyA && Op::onlyB == SingleInputMode::Black ) ||
-			( !partialBound && emptyB && Op::onlyA == SingleInputMode::Black )
-		)
-		{
-			channelDataB = ImagePlug::blackTile();
-			alphaDataB = ImagePlug::blackTile();
-			return;
-		}
-		else if( !partialBound && emptyA && Op::onlyB == SingleInputMode::Copy )
-		{
-			// We're outside the data window of this layer, and this op
-			// does nothing outside the data window
-			return;
-		}
-		else if( !partialBound && emptyB && Op::onlyA == SingleInputMode::Copy )
-		{
-			// We're only within the data window of the new layer, and
-			// this op just copies in the new layer, so we can just point
-			// to the whole new tile
-			channelDataB = channelDataA;
-			alphaDataB = alphaDataA;
-			return;
-		}
-
-		// The base layer (B) with the current result
-		const float *B = &channelDataB->readable().front();
-		const float *b = &alphaDataB->readable().front();
-
-		// A higher layer (A) which must be composited over the result
-		const float *A = &channelDataA->readable().front();
-		const float *a = &alphaDataA->readable().front();
-
-		if( !mergeChannelBuffer )
-		{
-			// None of the passthrough conditions have triggered, and we're actually performing
-			// an operation, time to allocate the merge buffers
-			mergeChannelBuffer = new FloatVectorData();
-			mergeAlphaBuffer = new FloatVectorData();
-			mergeChannelBuffer->writable().resize( ImagePlug::tilePixels() );
-			mergeAlphaBuffer->writable().resize( ImagePlug::tilePixels() );
-		}
-		float *R = &mergeChannelBuffer->writable().front();
-		float *r = &mergeAlphaBuffer->writable().front();
-
-
-		// Iterate through all the pixels in the tile, using the wrapped
-		// pixelIndex which corresponds directly to the index in the
-		// channelData vector
-		int i = 0;
-		int length;
-		MergeRegion region;
-
-		while( i < ImagePlug::tilePixels() )
-		{
-			// Compute the MergeRegion which tells us which bounding boxes
-			// we are in, and also how many pixel indices we can process
-			// in a row with the same MergeRegion
-			region = tileRegion( i, boundA, boundB, length );
-
-			if(
-				( region == OutsideBoth ) ||
-				( region == InsideB && Op::onlyB == Black ) ||
-				( region == InsideA && Op::onlyA == Black )
-			)
-			{
-				// If we are outside both inputs, or the Op is black when one input is
-				// black, then everything is this region is black
-				memset( R, 0, length * sizeof( float ) );
-				memset( r, 0, length * sizeof( float ) );
-				A += length; a += length;
-				B += length; b += length;
-				R += length; r += length;
-			}
-			else if( region == InsideB )
-			{
-				if( Op::onlyB == SingleInputMode::Copy )
-				{
-					if( R == B )
-					{
-						// We're already working in the merge buffers, so we don't need to do anything
-						// if input B is left untouched
-					}
-					else
-					{
-						// In a region with one input where we know the operator just passes through
-						// an input, we can just copy it over.
-						// Note: that this does not actually currently improve performance measurably,
-						// the compiler probably does quite a good job of inlining Op::operate,
-						// noticing that it is a passthrough, and translating it into something memcpy'ish
-						// This structure still feels worthwhile since it's a bit more explicit about what
-						// is happening, and this structure could be useful if we pursue a bit of
-						// vectorization
-						memcpy( R, B, length * sizeof( float ) );
-						memcpy( r, b, length * sizeof( float ) );
-					}
-					A += length; a += length;
-					B += length; b += length;
-					R += length; r += length;
-				}
-				else
-				{
-					// Outside A dataWindow, so call operator with 0 substituted for A and a
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( 0.0f, *B, 0.0f, *b );
-						*r = Op::operate( 0.0f, *b, 0.0f, *b );
-						++B; ++b;
-						++R; ++r;
-					}
-					A += length; a += length;
-				}
-			}
-			else if( region == InsideA )
-			{
-				if( Op::onlyA == SingleInputMode::Copy )
-				{
-					// In a region with one input where we know the operator just passes through
-					// an input, we can just copy it over.
-					memcpy( R, A, length * sizeof( float ) );
-					memcpy( r, a, length * sizeof( float ) );
-					A += length; a += length;
-					B += length; b += length;
-					R += length; r += length;
-				}
-				else
-				{
-					// Outside B dataWindow, so call operator with 0 substituted for B and b
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( *A, 0.0f, *a, 0.0f );
-						*r = Op::operate( *a, 0.0f, *a, 0.0f );
-						++A; ++a;
-						++R; ++r;
-					}
-					B += length; b += length;
-				}
-			}
-			else
-			{
-				// Within both data windows, this is when we actually need to run the full operate()
-				for( int j = 0; j < length; j++ )
-				{
-					*R = Op::operate( *A, *B, *a, *b );
-					*r = Op::operate( *a, *b, *a, *b );
-					++A; ++a;
-					++B; ++b;
-					++R; ++r;
-				}
-			}
-			i += length;
-		}
-
-		// Now that we've written to the merge buffers, they are now the valid output
-		channelDataB = mergeChannelBuffer;
-		alphaDataB = mergeAlphaBuffer;
-	}
-
-};
-
 struct PassthroughHashFunctor
 {
 	using ReturnType = void;
@@ -639,6 +344,259 @@ struct MergeDataWindowFunctor
 
 };
 
+// The data from a single input, as fetched for the tile being merged.
+struct MergeLayer
+{
+	// Bound of the valid data, relative to the tile origin.
+	Box2i bound;
+	ConstFloatVectorDataPtr channelData;
+	ConstFloatVectorDataPtr alphaData;
+	// True if this layer, or any layer before it, covers only part of
+	// the output data window within the tile.
+	bool partialBound;
+};
+
+// A tile to be fetched from an input, and where to store it.
+struct TileRequest
+{
+	const ImagePlug *image;
+	const std::string *channelName;
+	ConstFloatVectorDataPtr *result;
+};
+
+const std::string g_alphaChannelName( "A" );
+
+// Returns the span [x0, x1) of scanline y that lies within the local bound b.
+inline void scanlineSpan( const Box2i &b, int y, int &x0, int &x1 )
+{
+	if( y >= b.min.y && y < b.max.y && b.min.x < b.max.x )
+	{
+		x0 = b.min.x;
+		x1 = b.max.x;
+	}
+	else
+	{
+		x0 = x1 = 0;
+	}
+}
+
+// Merges `length` pixels of a layer A onto the running result R, r,
+// which is updated in place. The region tells us which of the two
+// data windows the pixels lie within. Updating the alpha of the result
+// is optional, because it isn't needed after the last layer.
+template< class Op, bool mergeAlpha >
+inline void mergeSpan( MergeRegion region, const float *__restrict A, const float *__restrict a, float *__restrict R, float *__restrict r, int length )
+{
+	if(
+		( region == OutsideBoth ) ||
+		( region == InsideB && Op::onlyB == Black ) ||
+		( region == InsideA && Op::onlyA == Black )
+	)
+	{
+		memset( R, 0, length * sizeof( float ) );
+		if( mergeAlpha )
+		{
+			memset( r, 0, length * sizeof( float ) );
+		}
+	}
+	else if( region == InsideB )
+	{
+		if( Op::onlyB == SingleInputMode::Copy )
+		{
+			// The result is left untouched
+			return;
+		}
+
+		// Outside A dataWindow, so call operator with 0 substituted for A and a
+		for( int j = 0; j < length; j++ )
+		{
+			const float b = r[j];
+			R[j] = Op::operate( 0.0f, R[j], 0.0f, b );
+			if( mergeAlpha )
+			{
+				r[j] = Op::operate( 0.0f, b, 0.0f, b );
+			}
+		}
+	}
+	else if( region == InsideA )
+	{
+		if( Op::onlyA == SingleInputMode::Copy )
+		{
+			memcpy( R, A, length * sizeof( float ) );
+			if( mergeAlpha )
+			{
+				memcpy( r, a, length * sizeof( float ) );
+			}
+			return;
+		}
+
+		// Outside B dataWindow, so call operator with 0 substituted for B and b
+		for( int j = 0; j < length; j++ )
+		{
+			R[j] = Op::operate( A[j], 0.0f, a[j], 0.0f );
+			if( mergeAlpha )
+			{
+				r[j] = Op::operate( a[j], 0.0f, a[j], 0.0f );
+			}
+		}
+	}
+	else
+	{
+		// Within both data windows, this is when we actually need to run the full operate()
+		for( int j = 0; j < length; j++ )
+		{
+			const float b = r[j];
+			R[j] = Op::operate( A[j], R[j], a[j], b );
+			if( mergeAlpha )
+			{
+				r[j] = Op::operate( a[j], b, a[j], b );
+			}
+		}
+	}
+}
+
+// Merges a layer onto the result, updating it in place. Each scanline is split
+// at the edges of both bounds, and the resulting spans merged according to their
+// MergeRegion.
+template< class Op, bool mergeAlpha >
+void mergeLayer( const MergeLayer &layer, const Box2i &boundB, float *R, float *r )
+{
+	const int tileSize = ImagePlug::tileSize();
+	const float *A = &layer.channelData->readable().front();
+	const float *a = &layer.alphaData->readable().front();
+
+	for( int y = 0; y < tileSize; ++y )
+	{
+		int ax0, ax1, bx0, bx1;
+		scanlineSpan( layer.bound, y, ax0, ax1 );
+		scanlineSpan( boundB, y, bx0, bx1 );
+		int edges[6] = { 0, ax0, ax1, bx0, bx1, tileSize };
+		std::sort( edges, edges + 6 );
+
+		for( int e = 0; e < 5; ++e )
+		{
+			const int x0 = edges[e];
+			const int x1 = edges[e+1];
+			if( x0 == x1 )
+			{
+				continue;
+			}
+			const MergeRegion region = (MergeRegion)(
+				( InsideA * ( x0 >= ax0 && x0 < ax1 ) ) |
+				( InsideB * ( x0 >= bx0 && x0 < bx1 ) )
+			);
+			mergeSpan<Op, mergeAlpha>( region, A + x0, a + x0, R + x0, r + x0, x1 - x0 );
+		}
+
+		A += tileSize; a += tileSize;
+		R += tileSize; r += tileSize;
+	}
+}
+
+struct MergeFunctor
+{
+	using ReturnType = ConstFloatVectorDataPtr;
+
+	// Merges all the layers for a tile, in order, returning the resulting channel data.
+	// Based on our convention for merges, the result so far is "B", and each layer is
+	// an "A" composited onto it.
+	//
+	// We work in two stages. First we run through the layers considering only their bounds
+	// and whether or not they are black, which is enough to resolve many layers to whole tile
+	// passthroughs. This leaves a list of "pending" layers that must actually be operated on
+	// per-pixel, which we then merge in turn into a single result buffer, with no other
+	// intermediate buffers beyond a scratch alpha channel.
+	template< class Op >
+	ReturnType operator()( const std::vector<MergeLayer> &layers )
+	{
+		ConstFloatVectorDataPtr channelDataB = layers[0].channelData;
+		ConstFloatVectorDataPtr alphaDataB = layers[0].alphaData;
+		Box2i boundB = layers[0].bound;
+
+		// Layers to be merged per-pixel, and the bound of the result
+		// at the point each one is merged.
+		std::vector<size_t> pending;
+		std::vector<Box2i> pendingBoundsB;
+
+		for( size_t i = 1; i < layers.size(); ++i )
+		{
+			const MergeLayer &layer = layers[i];
+
+			const bool emptyA = BufferAlgo::empty( layer.bound ) ||
+				( layer.channelData == ImagePlug::blackTile() && layer.alphaData == ImagePlug::blackTile() );
+			// Once we have pending layers, B is no longer known to be black
+			const bool emptyB = BufferAlgo::empty( boundB ) ||
+				( pending.empty() && channelDataB == ImagePlug::blackTile() && alphaDataB == ImagePlug::blackTile() );
+
+			// If both inputs are blackTile, or the operator is black when one input is black,
+			// we may be able to just pass through blackTile for the whole tile
+			if(
+				( emptyA && emptyB ) ||
+				( !layer.partialBound && emptyA && Op::onlyB == SingleInputMode::Black ) ||
+				( !layer.partialBound && emptyB && Op::onlyA == SingleInputMode::Black )
+			)
+			{
+				channelDataB = ImagePlug::blackTile();
+				alphaDataB = ImagePlug::blackTile();
+				pending.clear();
+				pendingBoundsB.clear();
+			}
+			else if( !layer.partialBound && emptyA && Op::onlyB == SingleInputMode::Copy )
+			{
+				// We're outside the data window of this layer, and this op
+				// does nothing outside the data window
+			}
+			else if( !layer.partialBound && emptyB && Op::onlyA == SingleInputMode::Copy )
+			{
+				// We're only within the data window of the new layer, and
+				// this op just copies in the new layer, so we can just point
+				// to the whole new tile
+				channelDataB = layer.channelData;
+				alphaDataB = layer.alphaData;
+				pending.clear();
+				pendingBoundsB.clear();
+			}
+			else
+			{
+				pending.push_back( i );
+				pendingBoundsB.push_back( boundB );
+			}
+
+			MergeDataWindowFunctor().template operator()<Op>( boundB, layer.bound, false );
+		}
+
+		if( pending.empty() )
+		{
+			return channelDataB;
+		}
+
+		// Copy the starting point into our result, and merge all the
+		// pending layers onto it. The intermediate alpha is only needed
+		// in a scratch buffer, and not at all for the last layer.
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		resultData->writable() = channelDataB->readable();
+		std::vector<float> resultAlpha( alphaDataB->readable() );
+
+		float *R = &resultData->writable().front();
+		float *r = resultAlpha.data();
+		for( size_t p = 0; p < pending.size(); ++p )
+		{
+			if( p < pending.size() - 1 )
+			{
+				mergeLayer<Op, true>( layers[pending[p]], pendingBoundsB[p], R, r );
+			}
+			else
+			{
+				mergeLayer<Op, false>( layers[pending[p]], pendingBoundsB[p], R, r );
+			}
+		}
+
+		return resultData;
+	}
+
+};
+
 } // namespace
 
 GAFFER_NODE_DEFINE_TYPE( Merge );
@@ -658,6 +616,7 @@ Merge::Merge( const std::string &name )
 			Max          // the maximum value in the enum, which just happens to currently be named "Max"
 		)
 	);
+	addChild( new CompoundObjectPlug( "__inputInfo", Plug::Out, new CompoundObject() ) );
 
 	// We don't ever want to change these, so we make pass-through connections.
 	// Note that they are hard-coded to take the first input
@@ -680,6 +639,16 @@ const Gaffer::IntPlug *Merge::operationPlug() const
 	return getChild<IntPlug>( g_firstPlugIndex );
 }
 
+Gaffer::CompoundObjectPlug *Merge::inputInfoPlug()
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 1 );
+}
+
+const Gaffer::CompoundObjectPlug *Merge::inputInfoPlug() const
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 1 );
+}
+
 void Merge::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	FlatImageProcessor::affects( input, outputs );
@@ -689,27 +658,101 @@ void Merge::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs
 		outputs.push_back( outPlug()->channelDataPlug() );
 		outputs.push_back( outPlug()->dataWindowPlug() );
 	}
+	else if( input == inputInfoPlug() )
+	{
+		outputs.push_back( outPlug()->channelDataPlug() );
+	}
 	else if( const ImagePlug *inputImage = input->parent<ImagePlug>() )
 	{
 		if( inputImage->parent<ArrayPlug>() == inPlugs() )
 		{
 			outputs.push_back( outPlug()->getChild<ValuePlug>( input->getName() ) );
 
-			// The input data window and channelNames affects the output channel data
+			// The input data window and channelNames affects the output channel data,
+			// via the inputInfoPlug()
 			if( input == inputImage->dataWindowPlug() || input == inputImage->channelNamesPlug() )
 			{
-				outputs.push_back( outPlug()->channelDataPlug() );
+				outputs.push_back( inputInfoPlug() );
 			}
 
 			if( input == inputImage->viewNamesPlug() )
 			{
-				outputs.push_back( outPlug()->channelDataPlug() );
+				outputs.push_back( inputInfoPlug() );
 				outputs.push_back( outPlug()->dataWindowPlug() );
 			}
 		}
 	}
 }
 
+void Merge::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	FlatImageProcessor::hash( output, context, h );
+
+	if( output == inputInfoPlug() )
+	{
+		int i = 0;
+		for( ImagePlug::Iterator it( inPlugs() ); !it.done(); ++it, ++i )
+		{
+			if( (*it)->getInput<ValuePlug>() && ImageAlgo::viewIsValid( context, (*it)->viewNames()->readable() ) )
+			{
+				h.append( i );
+				(*it)->dataWindowPlug()->hash( h );
+				(*it)->channelNamesPlug()->hash( h );
+			}
+		}
+	}
+}
+
+void Merge::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	if( output == inputInfoPlug() )
+	{
+		// Gather the global data for each valid input, so that we don't need to
+		// fetch it from every input again for every tile.
+		IntVectorDataPtr indicesData = new IntVectorData;
+		Box2iVectorDataPtr dataWindowsData = new Box2iVectorData;
+		ObjectVectorPtr channelNamesData = new ObjectVector;
+
+		int i = 0;
+		for( ImagePlug::Iterator it( inPlugs() ); !it.done(); ++it, ++i )
+		{
+			if( (*it)->getInput<ValuePlug>() && ImageAlgo::viewIsValid( context, (*it)->viewNames()->readable() ) )
+			{
+				indicesData->writable().push_back( i );
+				dataWindowsData->writable().push_back( (*it)->dataWindowPlug()->getValue() );
+				// Cast is OK, because we never modify the channel names after storing them.
+				channelNamesData->members().push_back(
+					boost::const_pointer_cast<StringVectorData>( (*it)->channelNamesPlug()->getValue() )
+				);
+			}
+		}
+
+		CompoundObjectPtr result = new CompoundObject;
+		result->members()["indices"] = indicesData;
+		result->members()["dataWindows"] = dataWindowsData;
+		result->members()["channelNames"] = channelNamesData;
+		static_cast<CompoundObjectPlug *>( output )->setValue( result );
+		return;
+	}
+
+	FlatImageProcessor::compute( output, context );
+}
+
+Gaffer::ValuePlug::CachePolicy Merge::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() )
+	{
+		// We spawn TBB tasks to fetch the input tiles in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return FlatImageProcessor::computeCachePolicy( output );
+}
+
+bool Merge::mipLevelsSupported( const Gaffer::Context *context ) const
+{
+	return true;
+}
+
 void Merge::hashDataWindow( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	FlatImageProcessor::hashDataWindow( output, context, h );
@@ -791,9 +834,8 @@ void Merge::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer:
 {
 	FlatImageProcessor::hashChannelData( output, context, h );
 
-	const std::string channelName = context->get<std::string>( ImagePlug::channelNameContextName );
+	const std::string &channelName = context->get<std::string>( ImagePlug::channelNameContextName );
 	const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
-	const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 
 	bool passthroughValid = true;
 	MurmurHash passthroughHash;
@@ -802,30 +844,25 @@ void Merge::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer:
 	Operation op = (Operation)operationPlug()->getValue();
 	h.append( op );
 
+	ConstCompoundObjectPtr inputInfo;
 	Box2i finalTileDataWindowLocal;
 	{
 		ImagePlug::GlobalScope c( context );
+		inputInfo = inputInfoPlug()->getValue();
 		Box2i finalDataWindow = outPlug()->dataWindowPlug()->getValue();
 		const Box2i fullBound = Box2i( V2i( 0 ), V2i( ImagePlug::tileSize() ) );
 		Box2i finalDataWindowLocal( finalDataWindow.min - tileOrigin, finalDataWindow.max - tileOrigin );
 		finalTileDataWindowLocal = boxIntersection( fullBound, finalDataWindowLocal );
 	}
 
-	for( ImagePlug::Iterator it( inPlugs() ); !it.done(); ++it )
-	{
-		if( !(*it)->getInput<ValuePlug>() || !ImageAlgo::viewIsValid( context, (*it)->viewNames()->readable() ) )
-		{
-			continue;
-		}
+	const std::vector<int> &indices = inputInfo->member<IntVectorData>( "indices" )->readable();
+	const std::vector<Box2i> &dataWindows = inputInfo->member<Box2iVectorData>( "dataWindows" )->readable();
+	const ObjectVector::MemberContainer &channelNamesVector = inputInfo->member<ObjectVector>( "channelNames" )->members();
 
-		IECore::ConstStringVectorDataPtr channelNamesData;
-		Box2i dataWindow;
-
-		{
-			ImagePlug::GlobalScope c( context );
-			channelNamesData = (*it)->channelNamesPlug()->getValue();
-			dataWindow = (*it)->dataWindowPlug()->getValue();
-		}
+	for( size_t i = 0; i < indices.size(); ++i )
+	{
+		const ImagePlug *inputImage = inPlugs()->getChild<ImagePlug>( indices[i] );
+		const Box2i &dataWindow = dataWindows[i];
 
 		// The hash of the channel data we do below represents just the data in
 		// the tile itself, and takes no account of the possibility that parts of the
@@ -854,17 +891,17 @@ void Merge::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer:
 		bool partialBound = false;
 		if( !BufferAlgo::empty( validBound ) )
 		{
-			const std::vector<std::string> &channelNames = channelNamesData->readable();
+			const std::vector<std::string> &channelNames = static_cast<const StringVectorData *>( channelNamesVector[i].get() )->readable();
 
 			if( ImageAlgo::channelExists( channelNames, channelName ) )
 			{
-				channelHash = (*it)->channelDataPlug()->hash();
+				channelHash = inputImage->channelDataPlug()->hash();
 				h.append( channelHash );
 			}
 
 			if( ImageAlgo::channelExists( channelNames, "A" ) )
 			{
-				alphaHash =  (*it)->channelDataHash( "A", tileOrigin );
+				alphaHash = inputImage->channelDataHash( "A", tileOrigin );
 				h.append( alphaHash );
 
 				// Make sure we differentiate this hash from the hash above, so that an image with just RGB
@@ -895,94 +932,98 @@ IECore::ConstFloatVectorDataPtr Merge::computeChannelData( const std::string &ch
 {
 	Operation op = (Operation)operationPlug()->getValue();
 
-	// We start by tracking the result using a const pointer
-	ConstFloatVectorDataPtr resultChannelData = nullptr;
-	// We also need to track alpha of intermediate composited layers.
-	ConstFloatVectorDataPtr resultAlphaData = nullptr;
-
-	Box2i resultBound;
-
-	// Scratch buffers that may be needed by MergeFunctor if we actually need to compute an operation,
-	// rather than doing a passthrough
-	FloatVectorDataPtr mergeChannelBuffer = nullptr;
-	FloatVectorDataPtr mergeAlphaBuffer = nullptr;
-
+	ConstCompoundObjectPtr inputInfo;
 	Box2i finalTileDataWindowLocal;
 	{
 		ImagePlug::GlobalScope c( context );
+		inputInfo = inputInfoPlug()->getValue();
 		Box2i finalDataWindow = outPlug()->dataWindowPlug()->getValue();
 		const Box2i fullBound = Box2i( V2i( 0 ), V2i( ImagePlug::tileSize() ) );
 		Box2i finalDataWindowLocal( finalDataWindow.min - tileOrigin, finalDataWindow.max - tileOrigin );
 		finalTileDataWindowLocal = boxIntersection( fullBound, finalDataWindowLocal );
 	}
 
-	bool partialBound = false;
+	const std::vector<int> &indices = inputInfo->member<IntVectorData>( "indices" )->readable();
+	const std::vector<Box2i> &dataWindows = inputInfo->member<Box2iVectorData>( "dataWindows" )->readable();
+	const ObjectVector::MemberContainer &channelNamesVector = inputInfo->member<ObjectVector>( "channelNames" )->members();
 
-	for( ImagePlug::Iterator it( inPlugs() ); !it.done(); ++it )
+	if( indices.empty() )
 	{
-		if( !(*it)->getInput<ValuePlug>() || !ImageAlgo::viewIsValid( context, (*it)->viewNames()->readable() ) )
-		{
-			continue;
-		}
+		return ImagePlug::blackTile();
+	}
 
-		IECore::ConstStringVectorDataPtr channelNamesData;
-		Box2i dataWindow;
-		{
-			ImagePlug::GlobalScope c( Context::current() );
-			channelNamesData = (*it)->channelNamesPlug()->getValue();
-			dataWindow = (*it)->dataWindowPlug()->getValue();
-		}
-		Box2i dataWindowLocal( dataWindow.min - tileOrigin, dataWindow.max - tileOrigin );
+	// Figure out the valid bound of each layer, and which tiles we need
+	// to fetch. Missing channels and tiles outside the data window are
+	// treated as black.
+	//
+	// \todo : There is opportunity for optimizing using pass-throughs for missing channel cases.
+	// If both channel and alpha are missing, we could check for SingleInputMode::Copy.  If one or
+	// the other is missing, we would need extra information about the Op to know how to proceed.
+	// For the moment, I'm assuming that optimizing for merging channels that don't exist is not
+	// a performance priority.
 
-		const std::vector<std::string> &channelNames = channelNamesData->readable();
+	std::vector<MergeLayer> layers( indices.size() );
+	std::vector<TileRequest> requests;
+	requests.reserve( indices.size() * 2 );
 
-		ConstFloatVectorDataPtr channelData;
-		ConstFloatVectorDataPtr alphaData;
+	bool partialBound = false;
+	for( size_t i = 0; i < indices.size(); ++i )
+	{
+		const ImagePlug *inputImage = inPlugs()->getChild<ImagePlug>( indices[i] );
+		const Box2i dataWindowLocal( dataWindows[i].min - tileOrigin, dataWindows[i].max - tileOrigin );
 
-		const Box2i validBound = boxIntersection( finalTileDataWindowLocal, dataWindowLocal );
+		MergeLayer &layer = layers[i];
+		layer.bound = boxIntersection( finalTileDataWindowLocal, dataWindowLocal );
+		layer.channelData = ImagePlug::blackTile();
+		layer.alphaData = ImagePlug::blackTile();
 
-		// \todo : There is opportunity for optimizing using pass-throughs for missing channel cases.
-		// If both channel and alpha are missing, we could check for SingleInputMode::Copy.  If one or
-		// the other is missing, we would need extra information about the Op to know how to proceed.
-		// For the moment, I'm assuming that optimizing for merging channels that don't exist is not
-		// a performance priority.
-		if( ImageAlgo::channelExists( channelNames, channelName ) && !BufferAlgo::empty( validBound ) )
-		{
-			channelData = (*it)->channelDataPlug()->getValue();
-		}
-		else
-		{
-			channelData = ImagePlug::blackTile();
-		}
+		partialBound |= !BufferAlgo::empty( layer.bound ) && layer.bound != finalTileDataWindowLocal;
+		layer.partialBound = partialBound;
 
-		if( ImageAlgo::channelExists( channelNames, "A" ) && !BufferAlgo::empty( validBound ) )
-		{
-			alphaData = (*it)->channelData( "A", tileOrigin );
-		}
-		else
+		if( BufferAlgo::empty( layer.bound ) )
 		{
-			alphaData = ImagePlug::blackTile();
+			continue;
 		}
 
-		if( (int)alphaData->readable().size() != ImagePlug::tilePixels()  )
+		const std::vector<std::string> &channelNames = static_cast<const StringVectorData *>( channelNamesVector[i].get() )->readable();
+		if( ImageAlgo::channelExists( channelNames, channelName ) )
 		{
-			throw IECore::Exception( "Merge::computeChannelData : Cannot process deep data." );
+			requests.push_back( { inputImage, &channelName, &layer.channelData } );
 		}
-		if( (int)channelData->readable().size() != ImagePlug::tilePixels() )
+		if( ImageAlgo::channelExists( channelNames, g_alphaChannelName ) )
 		{
-			throw IECore::Exception( "Merge::computeChannelData : Cannot process deep data." );
+			requests.push_back( { inputImage, &g_alphaChannelName, &layer.alphaData } );
 		}
+	}
 
-		partialBound |= !BufferAlgo::empty( validBound ) && validBound != finalTileDataWindowLocal;
+	// Fetch all the tiles in parallel, rather than waiting on each
+	// input in turn.
 
-		// MergeFunctor contains all the complexity, we just pass in the bounds and channel data,
-		// and it will either point resultChannelData to something we can pass through, or allocate
-		// the merge buffers, operate in there, and then point resultChannelData to that
-		bool first = !resultChannelData;
-		dispatchOperation( op, MergeFunctor(), resultBound, resultChannelData, resultAlphaData, validBound, channelData, alphaData, mergeChannelBuffer, mergeAlphaBuffer, partialBound );
-		dispatchOperation( op, MergeDataWindowFunctor(), resultBound, validBound, first );
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, requests.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ImagePlug::ChannelDataScope channelDataScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				channelDataScope.setChannelName( requests[i].channelName );
+				*requests[i].result = requests[i].image->channelDataPlug()->getValue();
+			}
+		},
+		taskGroupContext
+	);
 
+	for( const auto &layer : layers )
+	{
+		if(
+			(int)layer.channelData->readable().size() != ImagePlug::tilePixels() ||
+			(int)layer.alphaData->readable().size() != ImagePlug::tilePixels()
+		)
+		{
+			throw IECore::Exception( "Merge::computeChannelData : Cannot process deep data." );
+		}
 	}
 
-	return resultChannelData;
+	return dispatchOperation( op, MergeFunctor(), layers );
 }
@@ -40,9 +40,14 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/Process.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "IECore/SimpleTypedData.h"
 
+#include <cmath>
+#include <limits>
+#include <random>
+
 using namespace std;
 using namespace IECore;
 using namespace Gaffer;
@@ -69,6 +74,290 @@ struct ProcessorProcess : public Process
 InternedString ProcessorProcess::processorProcessType( "openColorIOTransform:processor" );
 InternedString ProcessorProcess::processorHashProcessType( "openColorIOTransform:processorHash" );
 
+//////////////////////////////////////////////////////////////////////////
+// Baked LUTs
+//////////////////////////////////////////////////////////////////////////
+
+// Inputs are mapped through a logarithmic shaper before indexing the 3D LUT,
+// so that its resolution is spread evenly across the stops of scene-linear
+// values. Values outside the range of the shaper, including negative values,
+// are processed exactly.
+const int g_lutSize = 65;
+const float g_shaperMinStop = -12.0f;
+const float g_shaperMaxStop = 10.0f;
+const float g_shaperOffset = exp2f( g_shaperMinStop );
+const float g_shaperMaxValue = exp2f( g_shaperMaxStop ) - g_shaperOffset;
+const float g_shaperScale = ( g_lutSize - 1 ) / ( g_shaperMaxStop - g_shaperMinStop );
+
+// Maps `x` in the range `[ 0, g_shaperMaxValue ]` to a position
+// in the range `[ 0, g_lutSize - 1 ]`.
+inline float shaper( float x )
+{
+	return ( log2f( x + g_shaperOffset ) - g_shaperMinStop ) * g_shaperScale;
+}
+
+inline float inverseShaper( float s )
+{
+	return exp2f( s / g_shaperScale + g_shaperMinStop ) - g_shaperOffset;
+}
+
+inline bool inShaperRange( float x )
+{
+	// Written so that NaN is out of range.
+	return x >= 0.0f && x <= g_shaperMaxValue;
+}
+
+void applyExact( const OCIO_NAMESPACE::ConstCPUProcessorRcPtr &cpuProcessor, float *r, float *g, float *b, size_t size )
+{
+	OCIO_NAMESPACE::PlanarImageDesc image(
+		r, g, b,
+		nullptr, // alpha
+		size, // Treat all pixels as a single line, since geometry doesn't affect OCIO
+		1 // height
+	);
+	cpuProcessor->apply( image );
+}
+
+class BakedLUT
+{
+
+	public :
+
+		BakedLUT( const OCIO_NAMESPACE::ConstCPUProcessorRcPtr &cpuProcessor, const IECore::Canceller *canceller )
+			:	m_cpuProcessor( cpuProcessor ), m_maxError( 0.0f )
+		{
+			// Evaluate the processor at every point in the lattice.
+
+			const size_t numPoints = g_lutSize * g_lutSize * g_lutSize;
+			vector<float> r( numPoints ), g( numPoints ), b( numPoints );
+			size_t i = 0;
+			for( int bi = 0; bi < g_lutSize; ++bi )
+			{
+				for( int gi = 0; gi < g_lutSize; ++gi )
+				{
+					for( int ri = 0; ri < g_lutSize; ++ri, ++i )
+					{
+						r[i] = inverseShaper( ri );
+						g[i] = inverseShaper( gi );
+						b[i] = inverseShaper( bi );
+					}
+				}
+			}
+
+			Canceller::check( canceller );
+			applyExact( cpuProcessor, r.data(), g.data(), b.data(), numPoints );
+			Canceller::check( canceller );
+
+			m_lut.resize( numPoints * 3 );
+			for( i = 0; i < numPoints; ++i )
+			{
+				m_lut[i*3] = r[i];
+				m_lut[i*3+1] = g[i];
+				m_lut[i*3+2] = b[i];
+			}
+
+			// Measure the error at random points, comparing against the exact
+			// processor. We measure absolute error for values up to 1, and relative
+			// error above that, since scene-linear outputs may be arbitrarily large.
+
+			const size_t numSamples = 65536;
+			std::minstd_rand generator( 0 );
+			std::uniform_real_distribution<float> distribution( 0.0f, g_lutSize - 1 );
+			vector<float> exact[3], baked[3];
+			for( int c = 0; c < 3; ++c )
+			{
+				exact[c].resize( numSamples );
+				for( auto &v : exact[c] )
+				{
+					v = inverseShaper( distribution( generator ) );
+				}
+				baked[c] = exact[c];
+			}
+
+			applyExact( cpuProcessor, exact[0].data(), exact[1].data(), exact[2].data(), numSamples );
+			apply( baked[0].data(), baked[1].data(), baked[2].data(), numSamples );
+
+			for( int c = 0; c < 3; ++c )
+			{
+				for( size_t j = 0; j < numSamples; ++j )
+				{
+					const float error = fabs( baked[c][j] - exact[c][j] ) / std::max( 1.0f, fabs( exact[c][j] ) );
+					// Written so that NaN errors are treated as infinite.
+					if( !( error <= m_maxError ) )
+					{
+						m_maxError = std::isnan( error ) ? std::numeric_limits<float>::infinity() : error;
+					}
+				}
+			}
+		}
+
+		float maxError() const
+		{
+			return m_maxError;
+		}
+
+		size_t memoryUsage() const
+		{
+			return sizeof( *this ) + m_lut.size() * sizeof( float );
+		}
+
+		void apply( float *r, float *g, float *b, size_t size ) const
+		{
+			vector<size_t> exactIndices;
+			for( size_t i = 0; i < size; ++i )
+			{
+				if( !inShaperRange( r[i] ) || !inShaperRange( g[i] ) || !inShaperRange( b[i] ) )
+				{
+					exactIndices.push_back( i );
+					continue;
+				}
+				lookup( r[i], g[i], b[i] );
+			}
+
+			if( exactIndices.empty() )
+			{
+				return;
+			}
+
+			// Process out of range values exactly, gathering them so
+			// that we only need a single call to the processor.
+
+			const size_t numExact = exactIndices.size();
+			vector<float> exact( numExact * 3 );
+			for( size_t i = 0; i < numExact; ++i )
+			{
+				exact[i] = r[exactIndices[i]];
+				exact[i+numExact] = g[exactIndices[i]];
+				exact[i+numExact*2] = b[exactIndices[i]];
+			}
+
+			applyExact( m_cpuProcessor, exact.data(), exact.data() + numExact, exact.data() + numExact * 2, numExact );
+
+			for( size_t i = 0; i < numExact; ++i )
+			{
+				r[exactIndices[i]] = exact[i];
+				g[exactIndices[i]] = exact[i+numExact];
+				b[exactIndices[i]] = exact[i+numExact*2];
+			}
+		}
+
+	private :
+
+		// Tetrahedral interpolation of the lattice, which gives
+		// smoother results than trilinear interpolation, at lower cost.
+		inline void lookup( float &r, float &g, float &b ) const
+		{
+			const float sr = shaper( r );
+			const float sg = shaper( g );
+			const float sb = shaper( b );
+
+			const int ir = std::min( (int)sr, g_lutSize - 2 );
+			const int ig = std::min( (int)sg, g_lutSize - 2 );
+			const int ib = std::min( (int)sb, g_lutSize - 2 );
+
+			const float dr = sr - ir;
+			const float dg = sg - ig;
+			const float db = sb - ib;
+
+			const int strideR = 3;
+			const int strideG = 3 * g_lutSize;
+			const int strideB = 3 * g_lutSize * g_lutSize;
+
+			const float *c000 = m_lut.data() + ir * strideR + ig * strideG + ib * strideB;
+			const float *c111 = c000 + strideR + strideG + strideB;
+
+			// Each tetrahedron is a path from c000 to c111, stepping along
+			// the axes in order of decreasing fractional offset.
+			const float *c1;
+			const float *c2;
+			float w1, w2, w3;
+			if( dr > dg )
+			{
+				if( dg > db )
+				{
+					c1 = c000 + strideR; c2 = c1 + strideG; w1 = dr; w2 = dg; w3 = db;
+				}
+				else if( dr > db )
+				{
+					c1 = c000 + strideR; c2 = c1 + strideB; w1 = dr; w2 = db; w3 = dg;
+				}
+				else
+				{
+					c1 = c000 + strideB; c2 = c1 + strideR; w1 = db; w2 = dr; w3 = dg;
+				}
+			}
+			else
+			{
+				if( db > dg )
+				{
+					c1 = c000 + strideB; c2 = c1 + strideG; w1 = db; w2 = dg; w3 = dr;
+				}
+				else if( db > dr )
+				{
+					c1 = c000 + strideG; c2 = c1 + strideB; w1 = dg; w2 = db; w3 = dr;
+				}
+				else
+				{
+					c1 = c000 + strideG; c2 = c1 + strideR; w1 = dg; w2 = dr; w3 = db;
+				}
+			}
+
+			float result[3];
+			for( int c = 0; c < 3; ++c )
+			{
+				result[c] = c000[c] + w1 * ( c1[c] - c000[c] ) + w2 * ( c2[c] - c1[c] ) + w3 * ( c111[c] - c2[c] );
+			}
+
+			r = result[0];
+			g = result[1];
+			b = result[2];
+		}
+
+		OCIO_NAMESPACE::ConstCPUProcessorRcPtr m_cpuProcessor;
+		vector<float> m_lut;
+		float m_maxError;
+
+};
+
+using ConstBakedLUTPtr = std::shared_ptr<const BakedLUT>;
+
+struct BakedLUTCacheGetterKey
+{
+
+	BakedLUTCacheGetterKey( const IECore::MurmurHash &processorHash, const OCIO_NAMESPACE::ConstProcessorRcPtr &processor )
+		:	processorHash( processorHash ), processor( processor )
+	{
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return processorHash;
+	}
+
+	const IECore::MurmurHash processorHash;
+	const OCIO_NAMESPACE::ConstProcessorRcPtr processor;
+
+};
+
+// Baked LUTs are cached by processor hash, so that they are shared between
+// all nodes with the same processor, and so that they are not rebaked when
+// the tolerance changes.
+using BakedLUTCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstBakedLUTPtr, IECorePreview::LRUCachePolicy::Parallel, BakedLUTCacheGetterKey>;
+
+BakedLUTCache &bakedLUTCache()
+{
+	static BakedLUTCache g_cache(
+		[] ( const BakedLUTCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller ) {
+			ConstBakedLUTPtr result = std::make_shared<BakedLUT>( key.processor->getDefaultCPUProcessor(), canceller );
+			cost = result->memoryUsage();
+			return result;
+		},
+		// Enough for around 50 LUTs.
+		200 * 1024 * 1024
+	);
+	return g_cache;
+}
+
 } // namespace
 
 GAFFER_NODE_DEFINE_TYPE( OpenColorIOTransform );
@@ -79,6 +368,9 @@ OpenColorIOTransform::OpenColorIOTransform( const std::string &name , bool withC
 	:	ColorProcessor( name ), m_hasContextPlug( withContextPlug )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
+	addChild( new BoolPlug( "bake", Plug::In, false ) );
+	addChild( new FloatPlug( "bakeTolerance", Plug::In, 0.001f, 0.0f ) );
+	addChild( new FloatPlug( "bakeError", Plug::Out ) );
 	if( m_hasContextPlug )
 	{
 		addChild( new CompoundDataPlug( "context" ) );
@@ -95,7 +387,7 @@ Gaffer::CompoundDataPlug *OpenColorIOTransform::contextPlug()
 	{
 		return nullptr;
 	}
-	return getChild<CompoundDataPlug>( g_firstPlugIndex );
+	return getChild<CompoundDataPlug>( g_firstPlugIndex + 3 );
 }
 
 const Gaffer::CompoundDataPlug *OpenColorIOTransform::contextPlug() const
@@ -104,7 +396,84 @@ const Gaffer::CompoundDataPlug *OpenColorIOTransform::contextPlug() const
 	{
 		return nullptr;
 	}
-	return getChild<CompoundDataPlug>( g_firstPlugIndex );
+	return getChild<CompoundDataPlug>( g_firstPlugIndex + 3 );
+}
+
+Gaffer::BoolPlug *OpenColorIOTransform::bakePlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::BoolPlug *OpenColorIOTransform::bakePlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex );
+}
+
+Gaffer::FloatPlug *OpenColorIOTransform::bakeTolerancePlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 1 );
+}
+
+const Gaffer::FloatPlug *OpenColorIOTransform::bakeTolerancePlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 1 );
+}
+
+Gaffer::FloatPlug *OpenColorIOTransform::bakeErrorPlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 2 );
+}
+
+const Gaffer::FloatPlug *OpenColorIOTransform::bakeErrorPlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 2 );
+}
+
+void OpenColorIOTransform::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
+{
+	ColorProcessor::affects( input, outputs );
+
+	if(
+		input == bakePlug() ||
+		( contextPlug() && contextPlug()->isAncestorOf( input ) ) ||
+		affectsTransform( input )
+	)
+	{
+		outputs.push_back( bakeErrorPlug() );
+	}
+}
+
+void OpenColorIOTransform::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	ColorProcessor::hash( output, context, h );
+
+	if( output == bakeErrorPlug() )
+	{
+		if( bakePlug()->getValue() )
+		{
+			h.append( processorHash() );
+		}
+	}
+}
+
+void OpenColorIOTransform::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	if( output == bakeErrorPlug() )
+	{
+		float error = 0.0f;
+		if( bakePlug()->getValue() )
+		{
+			OCIO_NAMESPACE::ConstProcessorRcPtr processor = this->processor();
+			if( processor && !processor->isNoOp() )
+			{
+				error = bakedLUTCache().get( BakedLUTCacheGetterKey( processorHash(), processor ), context->canceller() )->maxError();
+			}
+		}
+		static_cast<FloatPlug *>( output )->setValue( error );
+		return;
+	}
+
+	ColorProcessor::compute( output, context );
 }
 
 OCIO_NAMESPACE::ConstProcessorRcPtr OpenColorIOTransform::processor() const
@@ -148,12 +517,20 @@ bool OpenColorIOTransform::affectsColorProcessor( const Gaffer::Plug *input ) co
 	{
 		return true;
 	}
+	if( input == bakePlug() || input == bakeTolerancePlug() )
+	{
+		return true;
+	}
 	return affectsTransform( input );
 }
 
 void OpenColorIOTransform::hashColorProcessor( const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	h.append( processorHash() );
+	if( bakePlug()->getValue() )
+	{
+		h.append( bakeTolerancePlug()->getValue() );
+	}
 }
 
 OCIO_NAMESPACE::ConstContextRcPtr OpenColorIOTransform::modifiedOCIOContext( OCIO_NAMESPACE::ConstContextRcPtr context ) const
@@ -207,6 +584,19 @@ ColorProcessor::ColorProcessorFunction OpenColorIOTransform::colorProcessor( con
 		return ColorProcessorFunction();
 	}
 
+	if( bakePlug()->getValue() )
+	{
+		ConstBakedLUTPtr bakedLUT = bakedLUTCache().get( BakedLUTCacheGetterKey( processorHash(), processor ), context->canceller() );
+		if( bakedLUT->maxError() <= bakeTolerancePlug()->getValue() )
+		{
+			return [bakedLUT] ( IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b ) {
+				bakedLUT->apply( r->baseWritable(), g->baseWritable(), b->baseWritable(), r->readable().size() );
+			};
+		}
+		// Otherwise the LUT isn't accurate enough, so we
+		// fall back to using the exact processor.
+	}
+
 	OCIO_NAMESPACE::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
 
 	return [cpuProcessor] ( IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b ) {
@@ -218,15 +608,6 @@ ColorProcessor::ColorProcessorFunction OpenColorIOTransform::colorProcessor( con
 			return;
 		}
 
-		OCIO_NAMESPACE::PlanarImageDesc image(
-			r->baseWritable(),
-			g->baseWritable(),
-			b->baseWritable(),
-			nullptr, // alpha
-			r->readable().size(), // Treat all pixels as a single line, since geometry doesn't affect OCIO
-			1 // height
-		);
-
-		cpuProcessor->apply( image );
+		applyExact( cpuProcessor, r->baseWritable(), g->baseWritable(), b->baseWritable(), r->readable().size() );
 	};
 }
@@ -45,6 +45,7 @@
 #include "GafferImage/ImageReader.h"
 
 #include "Gaffer/Context.h"
+#include "Gaffer/MemoryGovernor.h"
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreImage/OpenImageIOAlgo.h"
@@ -53,6 +54,8 @@
 #include "IECore/FileSequence.h"
 #include "IECore/FileSequenceFunctions.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/SimpleTypedData.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenImageIO/imagecache.h"
 #include "OpenImageIO/deepdata.h"
@@ -247,13 +250,19 @@ std::string channelNameFromEXR( std::string view, std::string part, std::string
 // on OpenImageIOReader::tileBatchPlug, and then OpenImageIOReader::computeChannelData just needs to select the
 // correct tile batch index, access tileBatchPlug, and then return the tile at the correct tileBatchSubIndex.
 //
+// For flat images, the tile batch stores the data exactly as it was read from the file : interleaved, and in
+// the file's native format if that is half, or float otherwise. OpenImageIOReader::computeChannelData then
+// extracts the requested channel directly into the output tile, converting it to float as it goes. Channels
+// which are never requested are never converted or copied.
+//
+// For deep images, the tile batch contains separate channelData tiles for each channel, along with an extra
+// channel worth of tiles at the end which store the sample offsets.
+//
 // For scanline images, a tile batch is one tile high, and the full width of the image.
 // For tiled images, a tile batch is a fairly large fixed size ( current 512 pixels, or the tile size of the
 // image, whichever is larger ).  This amortizes the waste from tiles which lie over the edge of a tile batch,
 // and need to be read multiple times.
 // Either way, a tile batch contains all channels stored in the subimage which contains the desired channel.
-// For deep images, the tile batch also contains an extra channel worth of tiles at the end which store the
-// samples offsets.
 //
 // Tile batches are selected using V3i "tileBatchIndex".  The Z component is the subimage to load channels from.
 // The X and Y component select a region of the image.
@@ -516,7 +525,7 @@ class File
 
 			// Convert target region to EXR space to pass to readRegion
 			Box2i exrTargetRegion = flopDisplayWindow( targetRegion, view.imageSpec.full_y, view.imageSpec.full_height );
-			std::vector<float> fileData;
+			DataPtr fileData;
 			DeepData fileDeepData;
 			Box2i exrDataRegion;
 
@@ -525,91 +534,95 @@ class File
 			// Convert the resulting region from readRegion back from EXR coordinates to Gaffer coordinates
 			Box2i fileDataRegion = flopDisplayWindow( exrDataRegion, view.imageSpec.full_y, view.imageSpec.full_height );
 
-			// Pull data apart into tiles ( separate for each channel instead of interleaved )
-			int tileBatchNumElements = nchannels * view.tileBatchSize.y * view.tileBatchSize.x;
-			ObjectVectorPtr result = new ObjectVector();
-			result->members().resize( tileBatchNumElements );
+			if( !view.imageSpec.deep )
+			{
+				// Store the data as is, for extraction by `channelTile()`.
+				ObjectVectorPtr result = new ObjectVector();
+				result->members().push_back( new Box2iData( fileDataRegion ) );
+				result->members().push_back( fileData );
+				return result;
+			}
 
-			ObjectVectorPtr resultChannels = result;
+			// Pull deep data apart into tiles ( separate for each channel instead of interleaved )
+			int tileBatchNumElements = nchannels * view.tileBatchSize.y * view.tileBatchSize.x;
+			ObjectVectorPtr resultChannels = new ObjectVector();
+			resultChannels->members().resize( tileBatchNumElements );
 
 			std::vector< int > deepTileSizes;
 
-			if( view.imageSpec.deep )
-			{
-				result = new ObjectVector();
-				result->members().resize( 2 );
-				result->members()[1] = resultChannels;
+			ObjectVectorPtr result = new ObjectVector();
+			result->members().resize( 2 );
+			result->members()[1] = resultChannels;
 
-				ObjectVectorPtr resultOffsets = new ObjectVector();
-				resultOffsets->members().resize( view.tileBatchSize.y * view.tileBatchSize.x );
-				result->members()[0] = resultOffsets;
+			ObjectVectorPtr resultOffsets = new ObjectVector();
+			resultOffsets->members().resize( view.tileBatchSize.y * view.tileBatchSize.x );
+			result->members()[0] = resultOffsets;
 
-				deepTileSizes.resize( view.tileBatchSize.y * view.tileBatchSize.x );
+			deepTileSizes.resize( view.tileBatchSize.y * view.tileBatchSize.x );
 
-				for( int ty = batchFirstTile.y; ty < batchFirstTile.y + view.tileBatchSize.y; ty++ )
+			for( int ty = batchFirstTile.y; ty < batchFirstTile.y + view.tileBatchSize.y; ty++ )
+			{
+				for( int tx = batchFirstTile.x; tx < batchFirstTile.x + view.tileBatchSize.x; tx++ )
 				{
-					for( int tx = batchFirstTile.x; tx < batchFirstTile.x + view.tileBatchSize.x; tx++ )
-					{
-						V2i tileOffset = ImagePlug::tileSize() * V2i( tx, ty );
-						int subIndex = tileBatchSubIndex( view, 0, tileOffset );
+					V2i tileOffset = ImagePlug::tileSize() * V2i( tx, ty );
+					int subIndex = tileBatchSubIndex( view, 0, tileOffset );
 
-						Box2i tileRelativeFileRegion( fileDataRegion.min - tileOffset, fileDataRegion.max - tileOffset );
-						Box2i tileRegion = BufferAlgo::intersection(
-							Box2i( V2i( 0 ), V2i( ImagePlug::tileSize() ) ), tileRelativeFileRegion
-						);
+					Box2i tileRelativeFileRegion( fileDataRegion.min - tileOffset, fileDataRegion.max - tileOffset );
+					Box2i tileRegion = BufferAlgo::intersection(
+						Box2i( V2i( 0 ), V2i( ImagePlug::tileSize() ) ), tileRelativeFileRegion
+					);
 
-						if( BufferAlgo::empty( tileRegion ) )
-						{
-							// Result will be treated as const as soon as we set it on the plug, and we're not
-							// going to modify any elements after setting them, so it's safe to store a const
-							// value in one of the elements
-							resultOffsets->members()[ subIndex ] = const_cast<IntVectorData*>( ImagePlug::emptyTileSampleOffsets() );
+					if( BufferAlgo::empty( tileRegion ) )
+					{
+						// Result will be treated as const as soon as we set it on the plug, and we're not
+						// going to modify any elements after setting them, so it's safe to store a const
+						// value in one of the elements
+						resultOffsets->members()[ subIndex ] = const_cast<IntVectorData*>( ImagePlug::emptyTileSampleOffsets() );
 
-							continue;
-						}
+						continue;
+					}
 
-						IntVectorDataPtr tileData = new IECore::IntVectorData(
-							std::vector<int>( ImagePlug::tilePixels(), 0 )
-						);
-						vector<int> &tile = tileData->writable();
-						int curOffset = 0;
+					IntVectorDataPtr tileData = new IECore::IntVectorData(
+						std::vector<int>( ImagePlug::tilePixels(), 0 )
+					);
+					vector<int> &tile = tileData->writable();
+					int curOffset = 0;
 
-						int *tileIndex = &tile[ tileRegion.min.y * ImagePlug::tileSize() + tileRegion.min.x];
-						for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
-						{
-							int *newTileIndex = &tile[ y * ImagePlug::tileSize() + tileRegion.min.x ];
+					int *tileIndex = &tile[ tileRegion.min.y * ImagePlug::tileSize() + tileRegion.min.x];
+					for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
+					{
+						int *newTileIndex = &tile[ y * ImagePlug::tileSize() + tileRegion.min.x ];
 
-							// Any empty pixels we're skipping should get filled with an offset that
-							// hasn't changed
-							while( tileIndex < newTileIndex )
-							{
-								*tileIndex = curOffset;
-								tileIndex++;
-							}
-							tileIndex = newTileIndex;
+						// Any empty pixels we're skipping should get filled with an offset that
+						// hasn't changed
+						while( tileIndex < newTileIndex )
+						{
+							*tileIndex = curOffset;
+							tileIndex++;
+						}
+						tileIndex = newTileIndex;
 
-							int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
-							int dataIndex = scanline * fileDataRegion.size().x +
-								tileRegion.min.x - tileRelativeFileRegion.min.x;
+						int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
+						int dataIndex = scanline * fileDataRegion.size().x +
+							tileRegion.min.x - tileRelativeFileRegion.min.x;
 
-							for( int x = tileRegion.min.x; x < tileRegion.max.x; x++ )
-							{
-								curOffset += fileDeepData.samples( dataIndex );
-								*tileIndex = curOffset;
-								tileIndex++;
-								dataIndex++;
-							}
-						}
-						// Any empty pixels at the end should get filled with an offset that hasn't changed
-						while( tileIndex <= &tile.back() )
+						for( int x = tileRegion.min.x; x < tileRegion.max.x; x++ )
 						{
+							curOffset += fileDeepData.samples( dataIndex );
 							*tileIndex = curOffset;
 							tileIndex++;
+							dataIndex++;
 						}
-						resultOffsets->members()[ subIndex ] = tileData;
-
-						deepTileSizes[ ( ty - batchFirstTile.y ) * view.tileBatchSize.x  + tx - batchFirstTile.x ] = curOffset;
 					}
+					// Any empty pixels at the end should get filled with an offset that hasn't changed
+					while( tileIndex <= &tile.back() )
+					{
+						*tileIndex = curOffset;
+						tileIndex++;
+					}
+					resultOffsets->members()[ subIndex ] = tileData;
+
+					deepTileSizes[ ( ty - batchFirstTile.y ) * view.tileBatchSize.x  + tx - batchFirstTile.x ] = curOffset;
 				}
 			}
 
@@ -629,79 +642,41 @@ class File
 
 						if( BufferAlgo::empty( tileRegion ) )
 						{
-							const FloatVectorData* emptyResult;
-							if( !view.imageSpec.deep )
-							{
-								emptyResult = ImagePlug::blackTile();
-							}
-							else
-							{
-								emptyResult = ImagePlug::emptyTile();
-							}
-
 							// Result will be treated as const as soon as we set it on the plug, and we're not
 							// going to modify any elements after setting them, so it's safe to store a const
 							// value in one of the elements
-							resultChannels->members()[ subIndex ] = const_cast<FloatVectorData*>( emptyResult );
+							resultChannels->members()[ subIndex ] = const_cast<FloatVectorData*>( ImagePlug::emptyTile() );
 
 							continue;
 						}
 
-						if( !view.imageSpec.deep )
-						{
-							FloatVectorDataPtr tileData = new IECore::FloatVectorData(
-								std::vector<float>( ImagePlug::tilePixels() )
-							);
-							vector<float> &tile = tileData->writable();
+						int curSize = deepTileSizes[ ( ty - batchFirstTile.y ) * view.tileBatchSize.x  + tx - batchFirstTile.x ];
+						FloatVectorDataPtr tileData = new IECore::FloatVectorData(
+							std::vector<float>( curSize )
+						);
+						vector<float> &tile = tileData->writable();
 
-							for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
-							{
+						float *tileIndex = &tile[0];
 
-								float *tileIndex = &tile[ y * ImagePlug::tileSize() + tileRegion.min.x ];
-								int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
-								float *dataIndex = &fileData[
-									( scanline * fileDataRegion.size().x + tileRegion.min.x - tileRelativeFileRegion.min.x
-									) * nchannels + channelIdx
-								];
-								for( int x = tileRegion.min.x; x < tileRegion.max.x; x++ )
-								{
-									*tileIndex = *dataIndex;
-									tileIndex++;
-									dataIndex += nchannels;
-								}
-							}
-							resultChannels->members()[ subIndex ] = tileData;
-						}
-						else
+						for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
 						{
-							int curSize = deepTileSizes[ ( ty - batchFirstTile.y ) * view.tileBatchSize.x  + tx - batchFirstTile.x ];
-							FloatVectorDataPtr tileData = new IECore::FloatVectorData(
-								std::vector<float>( curSize )
-							);
-							vector<float> &tile = tileData->writable();
-
-							float *tileIndex = &tile[0];
+							int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
+							int dataIndex = scanline * fileDataRegion.size().x +
+								tileRegion.min.x - tileRelativeFileRegion.min.x;
 
-							for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
+							for( int x = tileRegion.min.x; x < tileRegion.max.x; x++ )
 							{
-								int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
-								int dataIndex = scanline * fileDataRegion.size().x +
-									tileRegion.min.x - tileRelativeFileRegion.min.x;
-
-								for( int x = tileRegion.min.x; x < tileRegion.max.x; x++ )
+								int s = fileDeepData.samples( dataIndex );
+								for( int i = 0; i < s; i++ )
 								{
-									int s = fileDeepData.samples( dataIndex );
-									for( int i = 0; i < s; i++ )
-									{
-										*tileIndex = fileDeepData.deep_value( dataIndex, channelIdx, i );
-										tileIndex++;
-									}
-									dataIndex++;
+									*tileIndex = fileDeepData.deep_value( dataIndex, channelIdx, i );
+									tileIndex++;
 								}
+								dataIndex++;
 							}
-							assert( tileIndex - &tile[0] == curSize );
-							resultChannels->members()[ subIndex ] = tileData;
 						}
+						assert( tileIndex - &tile[0] == curSize );
+						resultChannels->members()[ subIndex ] = tileData;
 					}
 				}
 			}
@@ -735,6 +710,33 @@ class File
 			}
 		}
 
+		// Extracts the tile for a channel from a flat tile batch, converting to float.
+		ConstFloatVectorDataPtr channelTile( const Context *c, const ObjectVector *tileBatch, const std::string &channelName, const Imath::V2i &tileOrigin ) const
+		{
+			const View &view = lookupView( c );
+			const int channelIndex = view.channelMap.at( channelName ).channelIndex;
+
+			const Box2i &fileDataRegion = static_cast<const Box2iData *>( tileBatch->members()[0].get() )->readable();
+			const Box2i tileRegion = BufferAlgo::intersection(
+				Box2i( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) ), fileDataRegion
+			);
+
+			if( BufferAlgo::empty( tileRegion ) )
+			{
+				return ImagePlug::blackTile();
+			}
+
+			const Object *data = tileBatch->members()[1].get();
+			if( const auto *halfData = runTimeCast<const HalfVectorData>( data ) )
+			{
+				return channelTile( halfData->readable().data(), fileDataRegion, view.imageSpec.nchannels, channelIndex, tileOrigin, tileRegion );
+			}
+			else
+			{
+				return channelTile( static_cast<const FloatVectorData *>( data )->readable().data(), fileDataRegion, view.imageSpec.nchannels, channelIndex, tileOrigin, tileRegion );
+			}
+		}
+
 		const ImageSpec &imageSpec( const Context *c ) const
 		{
 			return lookupView( c ).imageSpec;
@@ -801,8 +803,9 @@ class File
 			}
 		};
 
-		// Fill the data vector ( for a flat image ) or the deepData object ( for a deep image )
-		// with all data for the specified subImage and target region,
+		// Fill the data ( for a flat image ) or the deepData object ( for a deep image )
+		// with all data for the specified subImage and target region. Flat data is interleaved,
+		// and is stored as HalfVectorData if all channels are half, or FloatVectorData otherwise,
 		// setting the dataRegion to represent the actual bounds of the data read ( which may have had to
 		// be enlarged to match tile boundaries ), and returning the number of channels read
 		//
@@ -810,10 +813,28 @@ class File
 		//
 		// This is currenly only used by readTileBatch below - we always cache to tile batches when reading
 		// channel data.
-		int readRegion( int subImage, const Box2i &targetRegion, std::vector<float> &data, DeepData &deepData, Box2i &exrDataRegion )
+		int readRegion( int subImage, const Box2i &targetRegion, DataPtr &data, DeepData &deepData, Box2i &exrDataRegion )
 		{
 			ImageSpec spec = m_imageInput->spec( subImage, 0 );
 
+			// Allocates `data` and returns the format and buffer to read into.
+			auto allocateData = [&spec, &data] ( const Box2i &region, TypeDesc &format ) -> void * {
+				const size_t size = (size_t)spec.nchannels * region.size().x * region.size().y;
+				if( spec.format == TypeDesc::HALF && spec.channelformats.empty() )
+				{
+					HalfVectorDataPtr halfData = new HalfVectorData;
+					halfData->writable().resize( size );
+					data = halfData;
+					format = TypeDesc::HALF;
+					return halfData->writable().data();
+				}
+				FloatVectorDataPtr floatData = new FloatVectorData;
+				floatData->writable().resize( size );
+				data = floatData;
+				format = TypeDesc::FLOAT;
+				return floatData->writable().data();
+			};
+
 			const V2i fileDataOrigin( spec.x, spec.y );
 			const Box2i fileDataWindow( fileDataOrigin, fileDataOrigin + V2i( spec.width, spec.height ) );
 
@@ -828,10 +849,11 @@ class File
 				bool success;
 				if( !spec.deep )
 				{
-					data.resize( spec.nchannels * exrDataRegion.size().x * exrDataRegion.size().y );
+					TypeDesc format;
+					void *buffer = allocateData( exrDataRegion, format );
 					success = m_imageInput->read_scanlines(
 						subImage, 0,
-						exrDataRegion.min.y, exrDataRegion.max.y, 0, 0, spec.nchannels, TypeDesc::FLOAT, &data[0]
+						exrDataRegion.min.y, exrDataRegion.max.y, 0, 0, spec.nchannels, format, buffer
 					);
 				}
 				else
@@ -873,11 +895,12 @@ class File
 				bool success;
 				if( !spec.deep )
 				{
-					data.resize( spec.nchannels * exrDataRegion.size().x * exrDataRegion.size().y );
+					TypeDesc format;
+					void *buffer = allocateData( exrDataRegion, format );
 					success = m_imageInput->read_tiles (
 						subImage, 0,
 						exrDataRegion.min.x, exrDataRegion.max.x,
-						exrDataRegion.min.y, exrDataRegion.max.y, 0, 1, 0, spec.nchannels, TypeDesc::FLOAT, &data[0]
+						exrDataRegion.min.y, exrDataRegion.max.y, 0, 1, 0, spec.nchannels, format, buffer
 					);
 				}
 				else
@@ -906,6 +929,28 @@ class File
 			return spec.nchannels;
 		}
 
+		template<typename T>
+		static ConstFloatVectorDataPtr channelTile( const T *fileData, const Box2i &fileDataRegion, int nchannels, int channelIndex, const V2i &tileOrigin, const Box2i &tileRegion )
+		{
+			FloatVectorDataPtr tileData = new FloatVectorData( std::vector<float>( ImagePlug::tilePixels() ) );
+			vector<float> &tile = tileData->writable();
+
+			for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
+			{
+				// File data is stored top down.
+				const int scanline = fileDataRegion.max.y - 1 - y;
+				const T *source = fileData + ( (size_t)scanline * fileDataRegion.size().x + tileRegion.min.x - fileDataRegion.min.x ) * nchannels + channelIndex;
+				float *destination = &tile[ ( y - tileOrigin.y ) * ImagePlug::tileSize() + tileRegion.min.x - tileOrigin.x ];
+				for( int x = tileRegion.min.x; x < tileRegion.max.x; ++x )
+				{
+					*destination++ = *source;
+					source += nchannels;
+				}
+			}
+
+			return tileData;
+		}
+
 		// Given a subImage index, and a tile origin, return an index to identify the tile batch which
 		// where this channel data will be found
 		V3i tileBatchIndex( const View &view, int subImage, V2i tileOrigin ) const
@@ -1007,6 +1052,13 @@ FileHandleCache *fileCache()
 	return c;
 }
 
+// Open files hold decompression buffers and metadata, so we allow
+// the MemoryGovernor to close some when memory is scarce.
+const bool g_memoryGovernorRegistration = (
+	MemoryGovernor::registerCache( "OpenImageIOReader:openFiles", &OpenImageIOReader::getOpenFilesLimit, &OpenImageIOReader::setOpenFilesLimit ),
+	true
+);
+
 boost::container::flat_set<ustring> g_metadataBlacklist = {
 	// These two attributes are used by OIIO/EXR to specify the names of
 	// subimages. We don't want to load them because :
@@ -1059,6 +1111,7 @@ OpenImageIOReader::OpenImageIOReader( const std::string &name )
 	addChild( new BoolPlug( "fileValid", Plug::Out ) );
 	addChild( new IntPlug( "channelInterpretation", Plug::In, (int)ImageReader::ChannelInterpretation::Default, /* min */ (int)ImageReader::ChannelInterpretation::Legacy, /* max */ (int)ImageReader::ChannelInterpretation::Specification ) );
 	addChild( new ObjectVectorPlug( "__tileBatch", Plug::Out, new ObjectVector ) );
+	addChild( new FloatVectorDataPlug( "__flatChannelData", Plug::Out, ImagePlug::blackTile() ) );
 
 	plugSetSignal().connect( boost::bind( &OpenImageIOReader::plugSet, this, ::_1 ) );
 }
@@ -1137,6 +1190,16 @@ const Gaffer::ObjectVectorPlug *OpenImageIOReader::tileBatchPlug() const
 	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 6 );
 }
 
+Gaffer::FloatVectorDataPlug *OpenImageIOReader::flatChannelDataPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
+}
+
+const Gaffer::FloatVectorDataPlug *OpenImageIOReader::flatChannelDataPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
+}
+
 void OpenImageIOReader::setOpenFilesLimit( size_t maxOpenFiles )
 {
 	fileCache()->setMaxCost( maxOpenFiles );
@@ -1188,6 +1251,7 @@ void OpenImageIOReader::affects( const Gaffer::Plug *input, AffectedPlugsContain
 	if( input == fileNamePlug() || input == refreshCountPlug() || input == missingFrameModePlug() || input == channelInterpretationPlug() )
 	{
 		outputs.push_back( tileBatchPlug() );
+		outputs.push_back( flatChannelDataPlug() );
 		for( ValuePlug::Iterator it( outPlug() ); !it.done(); ++it )
 		{
 			outputs.push_back( it->get() );
@@ -1223,6 +1287,18 @@ void OpenImageIOReader::hash( const ValuePlug *output, const Context *context, I
 		missingFrameModePlug()->hash( h );
 		channelInterpretationPlug()->hash( h );
 	}
+	else if( output == flatChannelDataPlug() )
+	{
+		h.append( context->get<V2i>( ImagePlug::tileOriginContextName ) );
+		h.append( context->get<std::string>( ImagePlug::channelNameContextName ) );
+		h.append( context->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName ) );
+
+		ImagePlug::GlobalScope c( context );
+		hashFileName( c.context(), h );
+		refreshCountPlug()->hash( h );
+		missingFrameModePlug()->hash( h );
+		channelInterpretationPlug()->hash( h );
+	}
 }
 
 void OpenImageIOReader::compute( ValuePlug *output, const Context *context ) const
@@ -1293,6 +1369,29 @@ void OpenImageIOReader::compute( ValuePlug *output, const Context *context ) con
 			file->readTileBatch( context, tileBatchIndex )
 		);
 	}
+	else if( output == flatChannelDataPlug() )
+	{
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const std::string channelName = context->get<std::string>( ImagePlug::channelNameContextName );
+
+		ImagePlug::GlobalScope c( context );
+		FilePtr file = std::static_pointer_cast<File>( retrieveFile( c.context() ) );
+		if( !file )
+		{
+			throw IECore::Exception( "OpenImageIOReader - trying to evaluate flatChannelDataPlug() with invalid file, this should never happen." );
+		}
+
+		V3i tileBatchIndex;
+		int subIndex;
+		file->findTile( c.context(), channelName, tileOrigin, tileBatchIndex, subIndex );
+
+		c.set( g_tileBatchIndexContextName, &tileBatchIndex );
+		ConstObjectVectorPtr tileBatch = tileBatchPlug()->getValue();
+
+		static_cast<FloatVectorDataPlug *>( output )->setValue(
+			file->channelTile( c.context(), tileBatch.get(), channelName, tileOrigin )
+		);
+	}
 	else
 	{
 		ImageNode::compute( output, context );
@@ -1309,8 +1408,9 @@ Gaffer::ValuePlug::CachePolicy OpenImageIOReader::computeCachePolicy( const Gaff
 	}
 	else if( output == outPlug()->channelDataPlug() )
 	{
-		// Disable caching on channelDataPlug, since it is just a redirect to the correct tile of
-		// the private tileBatchPlug, which is already being cached.
+		// Disable caching on channelDataPlug, since it is just a redirect, either to the
+		// correct tile of the private tileBatchPlug for deep images, or to the private
+		// flatChannelDataPlug for flat images. Both of those are cached.
 		return ValuePlug::CachePolicy::Uncached;
 	}
 	return ImageNode::computeCachePolicy( output );
@@ -1597,6 +1697,16 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 		);
 	}
 
+	if( !file->imageSpec( context ).deep )
+	{
+		// Flat tiles are converted from the interleaved data in the tile batch,
+		// so we cache them on an internal plug rather than repeating the conversion
+		// for every request.
+		c.set( ImagePlug::tileOriginContextName, &tileOrigin );
+		c.set( ImagePlug::channelNameContextName, &channelName );
+		return flatChannelDataPlug()->getValue();
+	}
+
 	V3i tileBatchIndex;
 	int subIndex;
 	file->findTile( context, channelName, tileOrigin, tileBatchIndex, subIndex );
@@ -1604,15 +1714,7 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 	c.set( g_tileBatchIndexContextName, &tileBatchIndex );
 
 	ConstObjectVectorPtr tileBatch = tileBatchPlug()->getValue();
-	ConstObjectPtr curTileChannel;
-	if( !file->imageSpec( context ).deep )
-	{
-		curTileChannel = tileBatch->members()[ subIndex ];
-	}
-	else
-	{
-		curTileChannel = IECore::runTimeCast< const ObjectVector >( tileBatch->members()[1] )->members()[ subIndex ];
-	}
+	ConstObjectPtr curTileChannel = IECore::runTimeCast< const ObjectVector >( tileBatch->members()[1] )->members()[ subIndex ];
 	return IECore::runTimeCast< const FloatVectorData >( curTileChannel );
 }
 
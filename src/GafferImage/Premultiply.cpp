@@ -37,14 +37,49 @@
 
 #include "GafferImage/Premultiply.h"
 
+#include "GafferImage/ImageAlgo.h"
+
 #include "Gaffer/Context.h"
 
+#include "IECore/StringAlgo.h"
+
 using namespace IECore;
 using namespace Gaffer;
 
 namespace GafferImage
 {
 
+namespace
+{
+
+void checkAlphaChannel( const ImagePlug *image, const std::string &alphaChannel, const Context *context )
+{
+	ConstStringVectorDataPtr inChannelNamesPtr;
+	{
+		ImagePlug::GlobalScope c( context );
+		inChannelNamesPtr = image->channelNamesPlug()->getValue();
+	}
+
+	const std::vector<std::string> &inChannelNames = inChannelNamesPtr->readable();
+	if ( std::find( inChannelNames.begin(), inChannelNames.end(), alphaChannel ) == inChannelNames.end() )
+	{
+		std::ostringstream channelError;
+		channelError << "Channel '" << alphaChannel << "' does not exist";
+		throw( IECore::Exception( channelError.str() ) );
+	}
+}
+
+void premultiply( std::vector<float> &out, const std::vector<float> &a )
+{
+	std::vector<float>::const_iterator aIt = a.begin();
+	for ( std::vector<float>::iterator outIt = out.begin(), outItEnd = out.end(); outIt != outItEnd; ++outIt, ++aIt )
+	{
+		*outIt *= *aIt;
+	}
+}
+
+} // namespace
+
 GAFFER_NODE_DEFINE_TYPE( Premultiply );
 
 size_t Premultiply::g_firstPlugIndex = 0;
@@ -54,6 +89,7 @@ Premultiply::Premultiply( const std::string &name )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 	addChild( new StringPlug( "alphaChannel", Gaffer::Plug::In, "A" ) );
+	addChild( new ObjectPlug( "__channelGroup", Gaffer::Plug::Out, new ObjectVector ) );
 }
 
 Premultiply::~Premultiply()
@@ -70,6 +106,11 @@ const Gaffer::StringPlug *Premultiply::alphaChannelPlug() const
 	return getChild<StringPlug>( g_firstPlugIndex );
 }
 
+const Gaffer::ObjectPlug *Premultiply::channelGroupPlug() const
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 1 );
+}
+
 void Premultiply::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ChannelDataProcessor::affects( input, outputs );
@@ -80,6 +121,31 @@ void Premultiply::affects( const Gaffer::Plug *input, AffectedPlugsContainer &ou
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
 	}
+
+	if(
+		input == inPlug()->channelDataPlug() ||
+		input == inPlug()->channelNamesPlug() ||
+		input == alphaChannelPlug()
+	)
+	{
+		outputs.push_back( channelGroupPlug() );
+	}
+
+	if( input == inPlug()->channelNamesPlug() )
+	{
+		// Affects the channel groups.
+		outputs.push_back( outPlug()->channelDataPlug() );
+	}
+}
+
+bool Premultiply::channelEnabled( const std::string &channel ) const
+{
+	if( !ChannelDataProcessor::channelEnabled( channel ) )
+	{
+		return false;
+	}
+
+	return channel != alphaChannelPlug()->getValue();
 }
 
 void Premultiply::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
@@ -98,39 +164,106 @@ void Premultiply::hashChannelData( const GafferImage::ImagePlug *output, const G
 
 void Premultiply::processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channel, FloatVectorDataPtr outData ) const
 {
+	// Only called for channels not returned by `channelGroup()`.
 	std::string alphaChannel = alphaChannelPlug()->getValue();
+	checkAlphaChannel( inPlug(), alphaChannel, context );
+
+	ImagePlug::ChannelDataScope channelDataScope( context );
+	channelDataScope.setChannelName( &alphaChannel );
 
-	if ( channel == alphaChannel )
+	ConstFloatVectorDataPtr aData = inPlug()->channelDataPlug()->getValue();
+	premultiply( outData->writable(), aData->readable() );
+}
+
+std::vector<std::string> Premultiply::channelGroup( const std::string &channel, const Gaffer::Context *context ) const
+{
+	const std::string &baseName = ImageAlgo::baseName( channel );
+	if( baseName != "R" && baseName != "G" && baseName != "B" )
 	{
-		return;
+		return {};
 	}
 
-	ConstStringVectorDataPtr inChannelNamesPtr;
+	ConstStringVectorDataPtr channelNamesData;
+	std::string channels;
+	std::string alphaChannel;
 	{
-		ImagePlug::GlobalScope c( context );
-		inChannelNamesPtr = inPlug()->channelNamesPlug()->getValue();
+		ImagePlug::GlobalScope globalScope( context );
+		channelNamesData = inPlug()->channelNamesPlug()->getValue();
+		channels = channelsPlug()->getValue();
+		alphaChannel = alphaChannelPlug()->getValue();
 	}
 
-	const std::vector<std::string> &inChannelNames = inChannelNamesPtr->readable();
-	if ( std::find( inChannelNames.begin(), inChannelNames.end(), alphaChannel ) == inChannelNames.end() )
+	// Group the R, G and B channels of the layer that we actually
+	// premultiply. Channels that don't exist, are masked out, or are
+	// the alpha channel itself are all passed through.
+	const std::string layerName = ImageAlgo::layerName( channel );
+	std::vector<std::string> result;
+	for( const auto &b : { "R", "G", "B" } )
 	{
-		std::ostringstream channelError;
-		channelError << "Channel '" << alphaChannel << "' does not exist";
-		throw( IECore::Exception( channelError.str() ) );
+		std::string c = ImageAlgo::channelName( layerName, b );
+		if(
+			c != alphaChannel &&
+			ImageAlgo::channelExists( channelNamesData->readable(), c ) &&
+			StringAlgo::matchMultiple( c, channels )
+		)
+		{
+			result.push_back( c );
+		}
+	}
+
+	if( result.size() < 2 || std::find( result.begin(), result.end(), channel ) == result.end() )
+	{
+		// Nothing to share.
+		return {};
+	}
+
+	return result;
+}
+
+void Premultiply::hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	ChannelDataProcessor::hashChannelGroup( channels, tileOrigin, context, h );
+
+	std::string alphaChannel;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		alphaChannel = alphaChannelPlug()->getValue();
 	}
 
 	ImagePlug::ChannelDataScope channelDataScope( context );
+	for( const auto &channelName : channels )
+	{
+		channelDataScope.setChannelName( &channelName );
+		inPlug()->channelDataPlug()->hash( h );
+	}
+
 	channelDataScope.setChannelName( &alphaChannel );
+	inPlug()->channelDataPlug()->hash( h );
+}
 
+IECore::ConstObjectVectorPtr Premultiply::computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const
+{
+	std::string alphaChannel;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		alphaChannel = alphaChannelPlug()->getValue();
+	}
+	checkAlphaChannel( inPlug(), alphaChannel, context );
+
+	ImagePlug::ChannelDataScope channelDataScope( context );
+	channelDataScope.setChannelName( &alphaChannel );
 	ConstFloatVectorDataPtr aData = inPlug()->channelDataPlug()->getValue();
-	const std::vector<float> &a = aData->readable();
-	std::vector<float> &out = outData->writable();
 
-	std::vector<float>::const_iterator aIt = a.begin();
-	for ( std::vector<float>::iterator outIt = out.begin(), outItEnd = out.end(); outIt != outItEnd; ++outIt, ++aIt )
+	ObjectVectorPtr result = new ObjectVector();
+	for( const auto &channelName : channels )
 	{
-		*outIt *= *aIt;
+		channelDataScope.setChannelName( &channelName );
+		FloatVectorDataPtr outData = inPlug()->channelDataPlug()->getValue()->copy();
+		premultiply( outData->writable(), aData->readable() );
+		result->members().push_back( outData );
 	}
+
+	return result;
 }
 
 } // namespace GafferImage
@@ -41,7 +41,9 @@
 #include "Gaffer/Context.h"
 
 #include <algorithm>
+#include <bitset>
 #include <climits>
+#include <numeric>
 #include <boost/heap/d_ary_heap.hpp>
 
 using namespace std;
@@ -284,6 +286,45 @@ private:
 	std::vector<float> m_values;
 };
 
+// Sorting networks for the row sizes produced by small radii. These sort using a fixed sequence
+// of branchless compare-exchange operations, which is considerably faster than std::sort for
+// tiny arrays because there are no unpredictable branches.
+
+inline void compareExchange( float *v, int a, int b )
+{
+	const float lo = std::min( v[a], v[b] );
+	const float hi = std::max( v[a], v[b] );
+	v[a] = lo;
+	v[b] = hi;
+}
+
+inline void sortRow( float *row, int size )
+{
+	switch( size )
+	{
+		case 1 :
+			break;
+		case 3 :
+			compareExchange( row, 0, 2 ); compareExchange( row, 0, 1 ); compareExchange( row, 1, 2 );
+			break;
+		case 5 :
+			compareExchange( row, 0, 3 ); compareExchange( row, 1, 4 ); compareExchange( row, 0, 2 );
+			compareExchange( row, 1, 3 ); compareExchange( row, 0, 1 ); compareExchange( row, 2, 4 );
+			compareExchange( row, 1, 2 ); compareExchange( row, 3, 4 ); compareExchange( row, 2, 3 );
+			break;
+		case 7 :
+			compareExchange( row, 0, 6 ); compareExchange( row, 2, 3 ); compareExchange( row, 4, 5 );
+			compareExchange( row, 0, 2 ); compareExchange( row, 1, 4 ); compareExchange( row, 3, 6 );
+			compareExchange( row, 0, 1 ); compareExchange( row, 2, 5 ); compareExchange( row, 3, 4 );
+			compareExchange( row, 1, 2 ); compareExchange( row, 4, 6 ); compareExchange( row, 2, 3 );
+			compareExchange( row, 4, 5 ); compareExchange( row, 1, 2 ); compareExchange( row, 3, 4 );
+			compareExchange( row, 5, 6 );
+			break;
+		default :
+			std::sort( row, row + size );
+	}
+}
+
 // Min and max were easy, but here's where things get interesting.
 //
 // We can compute the median for the region by storing the pixels for each row, sorted within the row,
@@ -339,7 +380,8 @@ private:
 // sorting each row. It seems very likely that this approach is competitive with the best of median sorts
 // in the literature - I should probably document it a bit more cleanly and publish that somewhere. If we
 // really wanted to compete with bleeding edge, the next step would probably be to switch the sort of
-// individual rows from std::sort to a bleeding edge sorting algorithm ( like sorting networks for small sizes ).
+// individual rows from std::sort to a bleeding edge sorting algorithm. We now use sorting networks for
+// small sizes, and for large sizes `processTileHistogramMedian()` avoids sorting rows altogether.
 
 class RankMedianBuffer
 {
@@ -381,12 +423,9 @@ public:
 			}
 		);
 
-		// Sort the new row
-		//
-		// If we wanted to make this competitive with bleeding edge median filters, we would probably
-		// need a faster sort here. Sorting networks could work for small sizes ... I'm also curious how
-		// djbsort would perform.
-		std::sort( currentRow, currentRow + m_size.x );
+		// Sort the new row. NaNs have been replaced above, so the branchless
+		// networks used for small rows give the same result as std::sort.
+		sortRow( currentRow, m_size.x );
 
 		// Update m_splits for this row to preserve the invariant - it needs to be set so that
 		// currentRow[i] < m_splitValue if and only if i < m_splits[i]
@@ -716,6 +755,282 @@ void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileB
 	}
 }
 
+// Computes the minimum or maximum ( according to `op` ) over a sliding window of `windowSize`
+// samples, using the algorithm of van Herk and Gil-Werman. This takes 3 operations per sample
+// regardless of the window size. The input consists of `size` samples for each of `width`
+// interleaved signals, and the output receives `size - windowSize + 1` samples for each signal,
+// with sample `i` covering input samples `[ i, i + windowSize )`. The interleaving allows the
+// inner loops to process many signals in lockstep.
+template<typename Op>
+void slidingWindow( const float *in, int size, int width, int windowSize, float *out, vector<float> &prefix, vector<float> &suffix, Op op )
+{
+	// Divide the input into blocks of `windowSize`, and compute a running
+	// result forwards and backwards within each block. Any window then spans
+	// at most two blocks, so its result can be found with a single operation.
+	prefix.resize( size * width );
+	suffix.resize( size * width );
+
+	for( int i = 0; i < size; ++i )
+	{
+		const float *f = in + i * width;
+		float *g = prefix.data() + i * width;
+		if( i % windowSize == 0 )
+		{
+			std::copy( f, f + width, g );
+		}
+		else
+		{
+			const float *gPrev = g - width;
+			for( int k = 0; k < width; ++k )
+			{
+				g[k] = op( gPrev[k], f[k] );
+			}
+		}
+	}
+
+	for( int i = size - 1; i >= 0; --i )
+	{
+		const float *f = in + i * width;
+		float *h = suffix.data() + i * width;
+		if( i == size - 1 || ( i + 1 ) % windowSize == 0 )
+		{
+			std::copy( f, f + width, h );
+		}
+		else
+		{
+			const float *hNext = h + width;
+			for( int k = 0; k < width; ++k )
+			{
+				h[k] = op( hNext[k], f[k] );
+			}
+		}
+	}
+
+	for( int i = 0; i + windowSize <= size; ++i )
+	{
+		const float *h = suffix.data() + i * width;
+		const float *g = prefix.data() + ( i + windowSize - 1 ) * width;
+		float *o = out + i * width;
+		for( int k = 0; k < width; ++k )
+		{
+			o[k] = op( h[k], g[k] );
+		}
+	}
+}
+
+// Computes an Erode or Dilate for a whole tile as two separable passes of `slidingWindow()`. NaNs are
+// replaced with `identity`, so that they are ignored in the same way as in RankMinBuffer and RankMaxBuffer.
+template<typename Op>
+void processTileMinMax( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, float identity, Op op, const Canceller *canceller )
+{
+	const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
+	const V2i inputSize = inputBound.size();
+	const V2i tileSize = tileBound.size();
+
+	vector<float> input( inputSize.x * inputSize.y );
+	sampler.visitPixels( inputBound,
+		[&input, &inputBound, &inputSize, identity] ( float v, int x, int y )
+		{
+			input[ ( y - inputBound.min.y ) * inputSize.x + x - inputBound.min.x ] = std::isnan( v ) ? identity : v;
+		}
+	);
+
+	IECore::Canceller::check( canceller );
+
+	// Vertical pass. Our rows are already laid out as interleaved columns,
+	// so we can process all columns at once.
+	vector<float> columns( tileSize.y * inputSize.x );
+	vector<float> prefix;
+	vector<float> suffix;
+	slidingWindow( input.data(), inputSize.y, inputSize.x, 2 * radius.y + 1, columns.data(), prefix, suffix, op );
+
+	// Horizontal pass, one row at a time.
+	for( int y = 0; y < tileSize.y; ++y )
+	{
+		IECore::Canceller::check( canceller );
+		slidingWindow( columns.data() + y * inputSize.x, inputSize.x, 1, 2 * radius.x + 1, result.data() + y * tileSize.x, prefix, suffix, op );
+	}
+}
+
+// Tracks the median of a set of distinct integer ranks, using one bit per rank. Each
+// 64 bit word doubles as a coarse histogram bin, with the count given by a popcount.
+// The median is found by walking the coarse bins from the position of the previous
+// median, and then selecting the appropriate bit within the final word. Because the
+// window changes only slightly from one pixel to the next, the walk is usually short.
+class RankHistogram
+{
+
+	public :
+
+		RankHistogram( int numRanks, int medianIndex )
+			:	m_bits( ( numRanks + 63 ) / 64, 0 ), m_medianIndex( medianIndex ), m_word( 0 ), m_countBelow( 0 )
+		{
+		}
+
+		inline void insert( uint32_t rank )
+		{
+			m_bits[rank >> 6] |= uint64_t( 1 ) << ( rank & 63 );
+			if( (int)( rank >> 6 ) < m_word )
+			{
+				m_countBelow++;
+			}
+		}
+
+		inline void erase( uint32_t rank )
+		{
+			m_bits[rank >> 6] &= ~( uint64_t( 1 ) << ( rank & 63 ) );
+			if( (int)( rank >> 6 ) < m_word )
+			{
+				m_countBelow--;
+			}
+		}
+
+		inline uint32_t median()
+		{
+			// Find the word containing the median, maintaining `m_countBelow`
+			// as the number of ranks in all preceding words.
+			while( m_countBelow > m_medianIndex )
+			{
+				m_word--;
+				m_countBelow -= popcount( m_bits[m_word] );
+			}
+
+			while( true )
+			{
+				const int count = popcount( m_bits[m_word] );
+				if( m_countBelow + count > m_medianIndex )
+				{
+					break;
+				}
+				m_countBelow += count;
+				m_word++;
+			}
+
+			// Select the appropriate bit within the word, by clearing
+			// the lower bits and then counting the trailing zeroes.
+			uint64_t bits = m_bits[m_word];
+			for( int i = m_countBelow; i < m_medianIndex; ++i )
+			{
+				bits &= bits - 1;
+			}
+
+			return m_word * 64 + popcount( ( bits & ( ~bits + 1 ) ) - 1 );
+		}
+
+	private :
+
+		static inline int popcount( uint64_t bits )
+		{
+			return std::bitset<64>( bits ).count();
+		}
+
+		std::vector<uint64_t> m_bits;
+		int m_medianIndex;
+		int m_word;
+		int m_countBelow;
+
+};
+
+// Computes a median filter for a whole tile, with a cost per pixel that is linear in the
+// filter radius, rather than the `O( N log N )` of sorting rows in RankMedianBuffer. We first
+// quantise the input by replacing every value with its rank within the input region. This is
+// exact - we just map the median rank back to the corresponding value. We then slide a histogram
+// of ranks over the tile in a serpentine order, so that each step only updates a single row or
+// column of the window.
+void processTileHistogramMedian( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
+	const V2i inputSize = inputBound.size();
+	const int numInputs = inputSize.x * inputSize.y;
+
+	// Quantise input values by rank. Sorting once per tile is much cheaper than
+	// sorting a row per pixel. NaNs are replaced with `-infinity`, as in RankMedianBuffer.
+
+	vector<std::pair<float, uint32_t>> sortedInputs( numInputs );
+	sampler.visitPixels( inputBound,
+		[&sortedInputs, &inputBound, &inputSize] ( float v, int x, int y )
+		{
+			const uint32_t index = ( y - inputBound.min.y ) * inputSize.x + x - inputBound.min.x;
+			sortedInputs[index] = { std::isnan( v ) ? -infinity : v, index };
+		}
+	);
+
+	IECore::Canceller::check( canceller );
+	std::sort( sortedInputs.begin(), sortedInputs.end() );
+	IECore::Canceller::check( canceller );
+
+	vector<uint32_t> ranks( numInputs );
+	for( int i = 0; i < numInputs; ++i )
+	{
+		ranks[sortedInputs[i].second] = i;
+	}
+
+	auto rank = [&ranks, &inputBound, &inputSize] ( int x, int y ) {
+		return ranks[ ( y - inputBound.min.y ) * inputSize.x + x - inputBound.min.x ];
+	};
+
+	// Initialise the histogram for the first pixel.
+
+	const V2i size = 2 * radius + V2i( 1 );
+	RankHistogram histogram( numInputs, ( size.x * size.y ) / 2 );
+
+	V2i p = tileBound.min;
+	for( int y = p.y - radius.y; y <= p.y + radius.y; ++y )
+	{
+		for( int x = p.x - radius.x; x <= p.x + radius.x; ++x )
+		{
+			histogram.insert( rank( x, y ) );
+		}
+	}
+
+	// Slide across the tile, alternating direction on each row.
+
+	int direction = 1;
+	while( true )
+	{
+		IECore::Canceller::check( canceller );
+
+		while( true )
+		{
+			result[ ImagePlug::pixelIndex( p, tileBound.min ) ] = sortedInputs[histogram.median()].first;
+
+			const int nextX = p.x + direction;
+			if( nextX < tileBound.min.x || nextX >= tileBound.max.x )
+			{
+				break;
+			}
+
+			const int removeX = direction > 0 ? p.x - radius.x : p.x + radius.x;
+			const int addX = direction > 0 ? nextX + radius.x : nextX - radius.x;
+			for( int y = p.y - radius.y; y <= p.y + radius.y; ++y )
+			{
+				histogram.erase( rank( removeX, y ) );
+				histogram.insert( rank( addX, y ) );
+			}
+			p.x = nextX;
+		}
+
+		if( p.y + 1 >= tileBound.max.y )
+		{
+			break;
+		}
+
+		for( int x = p.x - radius.x; x <= p.x + radius.x; ++x )
+		{
+			histogram.erase( rank( x, p.y - radius.y ) );
+			histogram.insert( rank( x, p.y + radius.y + 1 ) );
+		}
+		p.y++;
+		direction = -direction;
+	}
+}
+
+// Up to this radius, sorting rows with sorting networks is faster than
+// `processTileHistogramMedian()`, which has a higher fixed cost per tile.
+// The larger networks are still used when computing pixel offsets for a
+// driver channel, which requires RankMedianBuffer.
+const int g_maxSortingNetworkRadius = 1;
+
 } // namespace
 
 void RankFilter::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
@@ -880,13 +1195,28 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 	switch( m_mode )
 	{
 		case MedianRank:
-			processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( std::max( radius.x, radius.y ) <= g_maxSortingNetworkRadius )
+			{
+				processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTileHistogramMedian( sampler, radius, tileBound, result, context->canceller() );
+			}
 			break;
 		case ErodeRank:
-			processTile<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			processTileMinMax(
+				sampler, radius, tileBound, result, infinity,
+				[] ( float a, float b ) { return std::min( a, b ); },
+				context->canceller()
+			);
 			break;
 		case DilateRank:
-			processTile<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			processTileMinMax(
+				sampler, radius, tileBound, result, -infinity,
+				[] ( float a, float b ) { return std::max( a, b ); },
+				context->canceller()
+			);
 			break;
 	}
 
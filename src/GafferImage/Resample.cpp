@@ -37,6 +37,7 @@
 #include "GafferImage/Resample.h"
 
 #include "GafferImage/FilterAlgo.h"
+#include "GafferImage/ImageAlgo.h"
 #include "GafferImage/Sampler.h"
 
 #include "Gaffer/Context.h"
@@ -45,7 +46,9 @@
 #include "OpenImageIO/filter.h"
 #include "OpenImageIO/fmath.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 using namespace Imath;
 using namespace IECore;
@@ -237,6 +240,53 @@ void filterWeights1D( const OIIO::Filter2D *filter, const float inputFilterScale
 	}
 }
 
+// Returns the bounding box of the input pixels referenced by the supports
+// computed by `filterWeights1D()`, and the total of the filter weights for
+// each output row or column.
+Box2i inputSupport( const std::vector<int> &supportRanges, const std::vector<float> &weights, Passes pass, const Box2i &tileBound, std::vector<float> &totalWeights )
+{
+	int minSupport = std::numeric_limits<int>::max();
+	int maxSupport = std::numeric_limits<int>::min();
+	totalWeights.reserve( ImagePlug::tileSize() );
+
+	std::vector<float>::const_iterator wIt = weights.begin();
+	for( auto it = supportRanges.begin(); it != supportRanges.end(); it += 2 )
+	{
+		minSupport = std::min( minSupport, *it );
+		maxSupport = std::max( maxSupport, *( it + 1 ) );
+		float totalW = 0.0f;
+		for( int i = *it; i < *( it + 1 ); ++i )
+		{
+			totalW += *wIt++;
+		}
+		totalWeights.push_back( totalW );
+	}
+
+	maxSupport = std::max( minSupport, maxSupport );
+	if( pass == Horizontal )
+	{
+		return Box2i( V2i( minSupport, tileBound.min.y ), V2i( maxSupport, tileBound.max.y ) );
+	}
+	else
+	{
+		return Box2i( V2i( tileBound.min.x, minSupport ), V2i( tileBound.max.x, maxSupport ) );
+	}
+}
+
+// Accumulates a weighted row of input into `result`. This is the inner
+// loop of the separable passes, so it is kept free of branches and
+// aliasing to allow the compiler to vectorise it. Note that we don't
+// reorder the summation, so results are identical to accumulating
+// one pixel at a time.
+inline void accumulate( float *__restrict result, const float *__restrict input, const float weight )
+{
+	const int n = ImagePlug::tileSize();
+	for( int i = 0; i < n; ++i )
+	{
+		result[i] += weight * input[i];
+	}
+}
+
 // For the inseparable case, we can't always reuse the weights for an adjacent row or column.
 // There are a lot of possible scaling factors where the ratio can be represented as a fraction,
 // and the weights needed would repeat after a certain number of pixels, and we could compute weights
@@ -309,6 +359,7 @@ Resample::Resample( const std::string &name )
 	addChild( new BoolPlug( "expandDataWindow" ) );
 	addChild( new IntPlug( "debug", Plug::In, Off, Off, SinglePass ) );
 	addChild( new ImagePlug( "__horizontalPass", Plug::Out ) );
+	addChild( new ObjectPlug( "__channelGroup", Plug::Out, new ObjectVector ) );
 
 	// We don't ever want to change these, so we make pass-through connections.
 
@@ -402,6 +453,11 @@ const ImagePlug *Resample::horizontalPassPlug() const
 	return getChild<ImagePlug>( g_firstPlugIndex + 6 );
 }
 
+const Gaffer::ObjectPlug *Resample::channelGroupPlug() const
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 7 );
+}
+
 void Resample::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	FlatImageProcessor::affects( input, outputs );
@@ -431,6 +487,13 @@ void Resample::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outpu
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
 		outputs.push_back( horizontalPassPlug()->channelDataPlug() );
+		outputs.push_back( channelGroupPlug() );
+	}
+
+	if( input == inPlug()->channelNamesPlug() )
+	{
+		// Affects the channel groups.
+		outputs.push_back( outPlug()->channelDataPlug() );
 	}
 }
 
@@ -516,7 +579,65 @@ Imath::Box2i Resample::computeDataWindow( const Gaffer::Context *context, const
 void Resample::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	FlatImageProcessor::hashChannelData( parent, context, h );
+	hashResampledChannels(
+		{ context->get<std::string>( ImagePlug::channelNameContextName ) },
+		context->get<V2i>( ImagePlug::tileOriginContextName ), context, parent, h
+	);
+}
+
+std::vector<std::string> Resample::channelGroup( const std::string &channel, const Gaffer::Context *context ) const
+{
+	const std::string &baseName = ImageAlgo::baseName( channel );
+	if( baseName != "R" && baseName != "G" && baseName != "B" )
+	{
+		return {};
+	}
+
+	ConstStringVectorDataPtr channelNamesData;
+	{
+		ImagePlug::GlobalScope globalScope( context );
+		channelNamesData = inPlug()->channelNamesPlug()->getValue();
+	}
+
+	// Resample the R, G and B channels of the layer together, so
+	// that they share the same filter weights.
+	const std::string layerName = ImageAlgo::layerName( channel );
+	std::vector<std::string> result;
+	for( const auto &b : { "R", "G", "B" } )
+	{
+		std::string c = ImageAlgo::channelName( layerName, b );
+		if( ImageAlgo::channelExists( channelNamesData->readable(), c ) )
+		{
+			result.push_back( c );
+		}
+	}
 
+	if( result.size() < 2 || std::find( result.begin(), result.end(), channel ) == result.end() )
+	{
+		return {};
+	}
+
+	return result;
+}
+
+void Resample::hashChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	FlatImageProcessor::hashChannelGroup( channels, tileOrigin, context, h );
+	hashResampledChannels( channels, tileOrigin, context, outPlug(), h );
+}
+
+IECore::ConstObjectVectorPtr Resample::computeChannelGroup( const std::vector<std::string> &channels, const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const
+{
+	ObjectVectorPtr result = new ObjectVector;
+	for( const auto &d : resampleChannels( channels, tileOrigin, context, outPlug() ) )
+	{
+		result->members().push_back( d );
+	}
+	return result;
+}
+
+void Resample::hashResampledChannels( const std::vector<std::string> &channelNames, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent, IECore::MurmurHash &h ) const
+{
 	V2f ratio, offset;
 	{
 		ImagePlug::GlobalScope c( context );
@@ -549,14 +670,14 @@ void Resample::hashChannelData( const GafferImage::ImagePlug *parent, const Gaff
 		h.append( true );
 	}
 
-	const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
-	Sampler sampler(
-		passes == Vertical ? horizontalPassPlug() : inPlug(),
-		context->get<std::string>( ImagePlug::channelNameContextName ),
-		inputRegion( tileOrigin, passes, ratio, offset, filter, inputFilterScale ),
-		(Sampler::BoundingMode)boundingModePlug()->getValue()
-	);
-	sampler.hash( h );
+	const ImagePlug *samplerPlug = passes == Vertical ? horizontalPassPlug() : inPlug();
+	const Box2i samplerRegion = inputRegion( tileOrigin, passes, ratio, offset, filter, inputFilterScale );
+	const Sampler::BoundingMode boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+	for( const auto &channelName : channelNames )
+	{
+		Sampler sampler( samplerPlug, channelName, samplerRegion, boundingMode );
+		sampler.hash( h );
+	}
 
 	// Another tile might happen to need to filter over the same input
 	// tiles as this one, so we must include the tile origin to make sure
@@ -565,6 +686,11 @@ void Resample::hashChannelData( const GafferImage::ImagePlug *parent, const Gaff
 }
 
 IECore::ConstFloatVectorDataPtr Resample::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
+{
+	return resampleChannels( { channelName }, tileOrigin, context, parent )[0];
+}
+
+std::vector<IECore::FloatVectorDataPtr> Resample::resampleChannels( const std::vector<std::string> &channelNames, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
 	V2f ratio, offset;
 	{
@@ -578,214 +704,242 @@ IECore::ConstFloatVectorDataPtr Resample::computeChannelData( const std::string
 
 	const unsigned passes = requiredPasses( this, parent, filter, ratio );
 
-	Sampler sampler(
-		passes == Vertical ? horizontalPassPlug() : inPlug(),
-		channelName,
-		inputRegion( tileOrigin, passes, ratio, offset, filter, inputFilterScale ),
-		(Sampler::BoundingMode)boundingModePlug()->getValue()
-	);
+	const ImagePlug *samplerPlug = passes == Vertical ? horizontalPassPlug() : inPlug();
+	const Box2i samplerRegion = inputRegion( tileOrigin, passes, ratio, offset, filter, inputFilterScale );
+	const Sampler::BoundingMode boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
 
 	const V2f filterRadius = inputFilterRadius( filter, inputFilterScale );
 	const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 
-	FloatVectorDataPtr resultData = new FloatVectorData;
-	std::vector<float> &result = resultData->writable();
-	result.resize( ImagePlug::tileSize() * ImagePlug::tileSize() );
-	std::vector<float>::iterator pIt = result.begin();
+	// Precompute the filter weights, which are shared by all channels.
 
-	if( passes == Both )
+	Box2i support;
+	std::vector<int> supportRanges;
+	std::vector<float> weights;
+	std::vector<float> totalWeights;
+	Box2i inputBound;
+	if( passes == BothOptimized )
+	{
+		filterWeights2D( filter, inputFilterScale, filterRadius, tileBound.min, offset, support, weights );
+	}
+	else if( passes == Horizontal )
+	{
+		// Pixels in the same column share the same support ranges and filter weights, so
+		// we precompute the weights now to avoid repeating work later.
+		filterWeights1D( filter, inputFilterScale.x, filterRadius.x, tileBound.min.x, ratio.x, offset.x, Horizontal, supportRanges, weights );
+		inputBound = inputSupport( supportRanges, weights, Horizontal, tileBound, totalWeights );
+	}
+	else if( passes == Vertical )
 	{
-		// When the filter isn't separable we must perform all the
-		// filtering in a single pass. This version also provides
-		// a reference implementation against which the two-pass
-		// version can be validated - use the SinglePass debug mode
-		// to force the use of this code path.
+		// Pixels in the same row share the same support ranges and filter weights, so
+		// we precompute the weights now to avoid repeating work later.
+		filterWeights1D( filter, inputFilterScale.y, filterRadius.y, tileBound.min.y, ratio.y, offset.y, Vertical, supportRanges, weights );
+		inputBound = inputSupport( supportRanges, weights, Vertical, tileBound, totalWeights );
+	}
 
-		V2i oP; // output pixel position
-		V2f iP; // input pixel position (floating point)
+	std::vector<FloatVectorDataPtr> results;
+	results.reserve( channelNames.size() );
+	for( const auto &channelName : channelNames )
+	{
+		Sampler sampler( samplerPlug, channelName, samplerRegion, boundingMode );
 
-		V2f	filterCoordinateMult = V2f(1.0f) / inputFilterScale;
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		std::vector<float> &result = resultData->writable();
+		result.resize( ImagePlug::tileSize() * ImagePlug::tileSize() );
+		std::vector<float>::iterator pIt = result.begin();
 
-		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+		if( passes == Both )
 		{
-			iP.y = ( oP.y + 0.5 ) / ratio.y + offset.y;
-			int minY = ceilf( iP.y - 0.5f - filterRadius.y );
-			int maxY = floorf( iP.y + 0.5f + filterRadius.y );
+			// When the filter isn't separable we must perform all the
+			// filtering in a single pass. This version also provides
+			// a reference implementation against which the two-pass
+			// version can be validated - use the SinglePass debug mode
+			// to force the use of this code path.
 
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
-			{
-				Canceller::check( context->canceller() );
+			V2i oP; // output pixel position
+			V2f iP; // input pixel position (floating point)
 
-				iP.x = ( oP.x + 0.5 ) / ratio.x + offset.x;
+			V2f	filterCoordinateMult = V2f(1.0f) / inputFilterScale;
 
-				int minX = ceilf( iP.x - 0.5f - filterRadius.x );
-				int maxX = floorf( iP.x + 0.5f + filterRadius.x );
+			for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+			{
+				iP.y = ( oP.y + 0.5 ) / ratio.y + offset.y;
+				int minY = ceilf( iP.y - 0.5f - filterRadius.y );
+				int maxY = floorf( iP.y + 0.5f + filterRadius.y );
 
-				float v = 0.0f;
-				float totalW = 0.0f;
-				sampler.visitPixels(
-					Imath::Box2i( Imath::V2i( minX, minY ), Imath::V2i( maxX, maxY ) ),
-					[&filter, &filterCoordinateMult, &iP, &v, &totalW]( float cur, int x, int y )
+				for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+				{
+					Canceller::check( context->canceller() );
+
+					iP.x = ( oP.x + 0.5 ) / ratio.x + offset.x;
+
+					int minX = ceilf( iP.x - 0.5f - filterRadius.x );
+					int maxX = floorf( iP.x + 0.5f + filterRadius.x );
+
+					float v = 0.0f;
+					float totalW = 0.0f;
+					sampler.visitPixels(
+						Imath::Box2i( Imath::V2i( minX, minY ), Imath::V2i( maxX, maxY ) ),
+						[&filter, &filterCoordinateMult, &iP, &v, &totalW]( float cur, int x, int y )
+						{
+							const float w = (*filter)(
+								filterCoordinateMult.x * ( float(x) + 0.5f - iP.x ),
+								filterCoordinateMult.y * ( float(y) + 0.5f - iP.y )
+							);
+
+							v += w * cur;
+							totalW += w;
+						}
+					);
+
+					if( totalW != 0.0f )
 					{
-						const float w = (*filter)(
-							filterCoordinateMult.x * ( float(x) + 0.5f - iP.x ),
-							filterCoordinateMult.y * ( float(y) + 0.5f - iP.y )
-						);
-
-						v += w * cur;
-						totalW += w;
+						*pIt = v / totalW;
 					}
-				);
 
-				if( totalW != 0.0f )
-				{
-					*pIt = v / totalW;
+					++pIt;
 				}
-
-				++pIt;
 			}
 		}
-	}
-	else if( passes == BothOptimized )
-	{
-		Box2i support;
-		std::vector<float> weights;
-		filterWeights2D( filter, inputFilterScale, filterRadius, tileBound.min, offset, support, weights );
-
-		V2i oP; // output pixel position
-		V2i supportOffset;
-		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+		else if( passes == BothOptimized )
 		{
-			supportOffset.y = oP.y - tileBound.min.y;
-
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+			V2i oP; // output pixel position
+			V2i supportOffset;
+			for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
 			{
-				Canceller::check( context->canceller() );
+				supportOffset.y = oP.y - tileBound.min.y;
 
-				supportOffset.x = oP.x - tileBound.min.x;
-				std::vector<float>::const_iterator wIt = weights.begin();
-
-				float v = 0.0f;
-				float totalW = 0.0f;
-				sampler.visitPixels(
-					Imath::Box2i( support.min + supportOffset, support.max + supportOffset ),
-					[&wIt, &v, &totalW]( float cur, int x, int y )
+				for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+				{
+					Canceller::check( context->canceller() );
+
+					supportOffset.x = oP.x - tileBound.min.x;
+					std::vector<float>::const_iterator wIt = weights.begin();
+
+					float v = 0.0f;
+					float totalW = 0.0f;
+					sampler.visitPixels(
+						Imath::Box2i( support.min + supportOffset, support.max + supportOffset ),
+						[&wIt, &v, &totalW]( float cur, int x, int y )
+						{
+							const float w = *wIt++;
+							v += w * cur;
+							totalW += w;
+						}
+					);
+
+					if( totalW != 0.0f )
 					{
-						const float w = *wIt++;
-						v += w * cur;
-						totalW += w;
+						*pIt = v / totalW;
 					}
-				);
 
-				if( totalW != 0.0f )
-				{
-					*pIt = v / totalW;
+					++pIt;
 				}
-
-				++pIt;
 			}
-		}
-
-	}
-	else if( passes == Horizontal )
-	{
-		// When the filter is separable we can perform filtering in two
-		// passes, one for the horizontal and one for the vertical. We
-		// output the horizontal pass on the horizontalPassPlug() so that
-		// it is cached for use in the vertical pass. The HorizontalPass
-		// debug mode causes this pass to be output directly for inspection.
-
-		// Pixels in the same column share the same support ranges and filter weights, so
-		// we precompute the weights now to avoid repeating work later.
-		std::vector<int> supportRanges;
-		std::vector<float> weights;
-		filterWeights1D( filter, inputFilterScale.x, filterRadius.x, tileBound.min.x, ratio.x, offset.x, Horizontal, supportRanges, weights );
-
-		V2i oP; // output pixel position
 
-		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+		}
+		else if( passes == Horizontal )
 		{
-			Canceller::check( context->canceller() );
-
-			std::vector<int>::const_iterator supportIt = supportRanges.begin();
-			std::vector<float>::const_iterator wIt = weights.begin();
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+			// When the filter is separable we can perform filtering in two
+			// passes, one for the horizontal and one for the vertical. We
+			// output the horizontal pass on the horizontalPassPlug() so that
+			// it is cached for use in the vertical pass. The HorizontalPass
+			// debug mode causes this pass to be output directly for inspection.
+
+			// Gather the input into a buffer with one contiguous run of
+			// pixels per input column. This lets us accumulate a whole output
+			// column at a time, with the inner loop running over contiguous
+			// memory so that the compiler can vectorise it.
+			std::vector<float> input( inputBound.size().x * ImagePlug::tileSize() );
+			for( int y = tileBound.min.y; y < tileBound.max.y; ++y )
 			{
-				float v = 0.0f;
-				float totalW = 0.0f;
-
-				sampler.visitPixels( Imath::Box2i(
-						Imath::V2i( *supportIt, oP.y ),
-						Imath::V2i( *( supportIt + 1 ), oP.y + 1 )
-					),
-					[&wIt, &v, &totalW]( float cur, int x, int y )
+				Canceller::check( context->canceller() );
+				float *column = input.data() + ( y - tileBound.min.y );
+				const int minX = inputBound.min.x;
+				sampler.visitPixels(
+					Imath::Box2i( Imath::V2i( inputBound.min.x, y ), Imath::V2i( inputBound.max.x, y + 1 ) ),
+					[column, minX]( float cur, int x, int )
 					{
-						const float w = *wIt++;
-						v += w * cur;
-						totalW += w;
+						column[( x - minX ) * ImagePlug::tileSize()] = cur;
 					}
 				);
+			}
 
+			std::vector<float> column( ImagePlug::tileSize() );
+			std::vector<int>::const_iterator supportIt = supportRanges.begin();
+			std::vector<float>::const_iterator wIt = weights.begin();
+			for( int x = 0; x < ImagePlug::tileSize(); ++x )
+			{
+				Canceller::check( context->canceller() );
+
+				std::fill( column.begin(), column.end(), 0.0f );
+				for( int iX = *supportIt; iX < *( supportIt + 1 ); ++iX )
+				{
+					accumulate( column.data(), input.data() + ( iX - inputBound.min.x ) * ImagePlug::tileSize(), *wIt++ );
+				}
 				supportIt += 2;
 
+				const float totalW = totalWeights[x];
 				if( totalW != 0.0f )
 				{
-					*pIt = v / totalW;
+					for( int y = 0; y < ImagePlug::tileSize(); ++y )
+					{
+						result[y * ImagePlug::tileSize() + x] = column[y] / totalW;
+					}
 				}
-
-				++pIt;
 			}
 		}
-	}
-	else if( passes == Vertical )
-	{
-		V2i oP; // output pixel position
-
-		// Pixels in the same row share the same support ranges and filter weights, so
-		// we precompute the weights now to avoid repeating work later.
-		std::vector<int> supportRanges;
-		std::vector<float> weights;
-		filterWeights1D( filter, inputFilterScale.y, filterRadius.y, tileBound.min.y, ratio.y, offset.y, Vertical, supportRanges, weights );
-
-		std::vector<int>::const_iterator supportIt = supportRanges.begin();
-		std::vector<float>::const_iterator rowWeightsIt = weights.begin();
-
-		for( oP.y = tileBound.min.y; oP.y < tileBound.max.y; ++oP.y )
+		else if( passes == Vertical )
 		{
-			Canceller::check( context->canceller() );
-
-			for( oP.x = tileBound.min.x; oP.x < tileBound.max.x; ++oP.x )
+			// Gather the input rows into a contiguous buffer, so that
+			// each output row can be accumulated using tight loops over
+			// contiguous memory.
+			std::vector<float> input( inputBound.size().y * ImagePlug::tileSize() );
+			for( int y = inputBound.min.y; y < inputBound.max.y; ++y )
 			{
-				float v = 0.0f;
-				float totalW = 0.0f;
-
-				std::vector<float>::const_iterator wIt = rowWeightsIt;
-
-				sampler.visitPixels( Imath::Box2i(
-						Imath::V2i( oP.x, *supportIt ),
-						Imath::V2i( oP.x + 1, *(supportIt + 1) )
-					),
-					[&wIt, &v, &totalW]( float cur, int x, int y )
+				Canceller::check( context->canceller() );
+				float *row = input.data() + ( y - inputBound.min.y ) * ImagePlug::tileSize();
+				const int minX = tileBound.min.x;
+				sampler.visitPixels(
+					Imath::Box2i( Imath::V2i( tileBound.min.x, y ), Imath::V2i( tileBound.max.x, y + 1 ) ),
+					[row, minX]( float cur, int x, int )
 					{
-						const float w = *wIt++;
-						v += w * cur;
-						totalW += w;
+						row[x - minX] = cur;
 					}
 				);
+			}
 
+			std::vector<int>::const_iterator supportIt = supportRanges.begin();
+			std::vector<float>::const_iterator wIt = weights.begin();
+			for( int y = 0; y < ImagePlug::tileSize(); ++y )
+			{
+				Canceller::check( context->canceller() );
 
-				if( totalW != 0.0f )
+				float *row = result.data() + y * ImagePlug::tileSize();
+				for( int iY = *supportIt; iY < *( supportIt + 1 ); ++iY )
 				{
-					*pIt = v / totalW;
+					accumulate( row, input.data() + ( iY - inputBound.min.y ) * ImagePlug::tileSize(), *wIt++ );
 				}
+				supportIt += 2;
 
-				++pIt;
+				const float totalW = totalWeights[y];
+				if( totalW != 0.0f )
+				{
+					const float *e = row + ImagePlug::tileSize();
+					for( float *p = row; p != e; ++p )
+					{
+						*p /= totalW;
+					}
+				}
+				else
+				{
+					std::fill( row, row + ImagePlug::tileSize(), 0.0f );
+				}
 			}
-
-			rowWeightsIt += (*(supportIt + 1)) - (*supportIt);
-			supportIt += 2;
 		}
+
+		results.push_back( resultData );
 	}
 
-	return resultData;
+	return results;
 }
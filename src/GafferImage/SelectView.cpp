@@ -102,6 +102,11 @@ void SelectView::affects( const Gaffer::Plug *input, AffectedPlugsContainer &out
 	}
 }
 
+bool SelectView::mipLevelsSupported( const Gaffer::Context *context ) const
+{
+	return true;
+}
+
 std::string SelectView::selectViewName( const Gaffer::Context *context ) const
 {
 	ImagePlug::GlobalScope g( context  );
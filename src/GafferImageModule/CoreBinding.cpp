@@ -335,6 +335,8 @@ void GafferImageModule::bindCore()
 		.def( "sampleOffsetsHash", &sampleOffsetsHash, ( arg( "viewName" ) = object() ) )
 		.def( "tileSize", &ImagePlug::tileSize ).staticmethod( "tileSize" )
 		.def( "tilePixels", &ImagePlug::tilePixels ).staticmethod( "tilePixels" )
+		.def( "tileSizeLog2", &ImagePlug::tileSizeLog2 ).staticmethod( "tileSizeLog2" )
+		.def( "tileSizeIsConfigurable", &ImagePlug::tileSizeIsConfigurable ).staticmethod( "tileSizeIsConfigurable" )
 		.def( "tileIndex", &ImagePlug::tileIndex ).staticmethod( "tileIndex" )
 		.def( "tileOrigin", &ImagePlug::tileOrigin ).staticmethod( "tileOrigin" )
 		.def( "pixelIndex", &ImagePlug::pixelIndex ).staticmethod( "pixelIndex" )
@@ -50,7 +50,13 @@ using namespace GafferImage;
 
 void GafferImageModule::bindFilters()
 {
-	DependencyNodeClass<Blur>();
+	{
+		scope s = DependencyNodeClass<Blur>();
+		enum_<Blur::Method>( "Method" )
+			.value( "Filter", Blur::Filter )
+			.value( "Recursive", Blur::Recursive )
+		;
+	}
 	DependencyNodeClass<RankFilter>( nullptr, no_init );
 	DependencyNodeClass<Median>();
 	DependencyNodeClass<Dilate>();
@@ -38,6 +38,7 @@
 
 #include "GafferImage/ImageAlgo.h"
 
+#include "IECorePython/ExceptionAlgo.h"
 #include "IECorePython/ScopedGILLock.h"
 #include "IECorePython/ScopedGILRelease.h"
 
@@ -119,33 +120,50 @@ void deleteWithGIL( object *o )
 	delete o;
 }
 
-void parallelGatherTiles1( const GafferImage::ImagePlug &image, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder )
+void parallelGatherTiles1( const GafferImage::ImagePlug &image, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder, ImageAlgo::GatherMode gatherMode, size_t maxTilesInFlight )
 {
 	IECorePython::ScopedGILRelease gilRelease;
 	ImageAlgo::parallelGatherTiles(
 
 		&image,
 
-		[ &pythonTileFunctor ] ( const ImagePlug *image, const Imath::V2i &tileOrigin )
+		[ &pythonTileFunctor ] ( const ImagePlug *image, const Imath::V2i &tileOrigin ) -> std::shared_ptr<object>
 		{
 			IECorePython::ScopedGILLock gilLock;
-			object tile = pythonTileFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), tileOrigin );
-			return std::shared_ptr<object>( new object( tile ), deleteWithGIL );
+			try
+			{
+				object tile = pythonTileFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), tileOrigin );
+				return std::shared_ptr<object>( new object( tile ), deleteWithGIL );
+			}
+			catch( const error_already_set & )
+			{
+				IECorePython::ExceptionAlgo::translatePythonException();
+			}
+			return nullptr;
 		},
 
 		[ &pythonGatherFunctor ] ( const ImagePlug *image, const Imath::V2i &tileOrigin, std::shared_ptr<object> tile )
 		{
 			IECorePython::ScopedGILLock gilLock;
-			pythonGatherFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), tileOrigin, *tile );
+			try
+			{
+				pythonGatherFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), tileOrigin, *tile );
+			}
+			catch( const error_already_set & )
+			{
+				IECorePython::ExceptionAlgo::translatePythonException();
+			}
 		},
 
 		window,
-		tileOrder
+		tileOrder,
+		gatherMode,
+		maxTilesInFlight
 
 	);
 }
 
-void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonChannelNames, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder )
+void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonChannelNames, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder, ImageAlgo::GatherMode gatherMode, size_t maxTilesInFlight )
 {
 	vector<string> channelNames;
 	boost::python::container_utils::extend_container( channelNames, pythonChannelNames );
@@ -155,21 +173,38 @@ void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonCha
 
 		&image, channelNames,
 
-		[ &pythonTileFunctor ] ( const ImagePlug *image, const std::string &channelName, const Imath::V2i &tileOrigin )
+		[ &pythonTileFunctor ] ( const ImagePlug *image, const std::string &channelName, const Imath::V2i &tileOrigin ) -> std::shared_ptr<object>
 		{
 			IECorePython::ScopedGILLock gilLock;
-			object tile = pythonTileFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), channelName, tileOrigin );
-			return std::shared_ptr<object>( new object( tile ), deleteWithGIL );
+			try
+			{
+				object tile = pythonTileFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), channelName, tileOrigin );
+				return std::shared_ptr<object>( new object( tile ), deleteWithGIL );
+			}
+			catch( const error_already_set & )
+			{
+				IECorePython::ExceptionAlgo::translatePythonException();
+			}
+			return nullptr;
 		},
 
 		[ &pythonGatherFunctor ] ( const ImagePlug *image, const std::string &channelName, const Imath::V2i &tileOrigin, std::shared_ptr<object> tile )
 		{
 			IECorePython::ScopedGILLock gilLock;
-			pythonGatherFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), channelName, tileOrigin, *tile );
+			try
+			{
+				pythonGatherFunctor( ImagePlugPtr( const_cast<ImagePlug *>( image ) ), channelName, tileOrigin, *tile );
+			}
+			catch( const error_already_set & )
+			{
+				IECorePython::ExceptionAlgo::translatePythonException();
+			}
 		},
 
 		window,
-		tileOrder
+		tileOrder,
+		gatherMode,
+		maxTilesInFlight
 
 	);
 }
@@ -220,6 +255,11 @@ void GafferImageModule::bindImageAlgo()
 		.value( "BottomToTop", ImageAlgo::BottomToTop )
 	;
 
+	enum_<ImageAlgo::GatherMode>( "GatherMode" )
+		.value( "InlineGather", ImageAlgo::InlineGather )
+		.value( "PipelinedGather", ImageAlgo::PipelinedGather )
+	;
+
 	def(
 		"parallelGatherTiles", &parallelGatherTiles1,
 		(
@@ -227,7 +267,9 @@ void GafferImageModule::bindImageAlgo()
 			boost::python::arg( "tileFunctor" ),
 			boost::python::arg( "gatherFunctor" ),
 			boost::python::arg( "window" ) = Imath::Box2i(),
-			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered
+			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered,
+			boost::python::arg( "gatherMode" ) = ImageAlgo::InlineGather,
+			boost::python::arg( "maxTilesInFlight" ) = 0
 		)
 	);
 
@@ -239,13 +281,16 @@ void GafferImageModule::bindImageAlgo()
 			boost::python::arg( "tileFunctor" ),
 			boost::python::arg( "gatherFunctor" ),
 			boost::python::arg( "window" ) = Imath::Box2i(),
-			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered
+			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered,
+			boost::python::arg( "gatherMode" ) = ImageAlgo::InlineGather,
+			boost::python::arg( "maxTilesInFlight" ) = 0
 		)
 	);
 
 	def( "image", &imageWrapper, ( boost::python::arg( "viewName" ) = object() ) );
 	def( "imageHash", &imageHashWrapper, ( boost::python::arg( "viewName" ) = object() ) );
 	def( "tiles", &tilesWrapper, ( boost::python::arg( "_copy" ) = true, boost::python::arg( "viewName" ) = object() ) );
+	def( "mipLevelWindow", &GafferImage::ImageAlgo::mipLevelWindow );
 
 	StringVectorFromStringVectorData();
 
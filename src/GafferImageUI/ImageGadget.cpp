@@ -70,6 +70,8 @@
 #include "boost/bind/bind.hpp"
 #include "boost/lexical_cast.hpp"
 
+#include <algorithm>
+
 using namespace std;
 using namespace boost::placeholders;
 using namespace boost;
@@ -315,8 +317,11 @@ ImageGadget::ImageGadget()
 		m_soloChannel( -1 ),
 		m_labelsVisible( true ),
 		m_paused( false ),
+		m_mipMapping( false ),
 		m_wipeEnabled( false ),
 		m_dirtyFlags( AllDirty ),
+		m_deep( false ),
+		m_mipLevel( 0 ),
 		m_renderRequestPending( false ),
 		m_blendMode( BlendMode::Over )
 {
@@ -476,6 +481,21 @@ bool ImageGadget::getPaused() const
 	return m_paused;
 }
 
+void ImageGadget::setMipMapping( bool mipMapping )
+{
+	if( mipMapping == m_mipMapping )
+	{
+		return;
+	}
+	m_mipMapping = mipMapping;
+	Gadget::dirty( DirtyType::Render );
+}
+
+bool ImageGadget::getMipMapping() const
+{
+	return m_mipMapping;
+}
+
 uint64_t ImageGadget::tileUpdateCount()
 {
 	return g_tileUpdateCount;
@@ -594,6 +614,10 @@ void ImageGadget::plugDirtied( const Gaffer::Plug *plug )
 	{
 		dirty( TilesDirty );
 	}
+	else if( plug == m_image->deepPlug() )
+	{
+		dirty( DeepDirty );
+	}
 }
 
 void ImageGadget::contextChanged( const IECore::InternedString &name )
@@ -677,6 +701,24 @@ const std::vector<std::string> &ImageGadget::channelNames() const
 	return m_channelNames;
 }
 
+bool ImageGadget::deep() const
+{
+	if( m_dirtyFlags & DeepDirty )
+	{
+		if( !m_image )
+		{
+			m_deep = false;
+		}
+		else
+		{
+			Context::Scope scopedContext( m_context.get() );
+			m_deep = m_image->deepPlug()->getValue();
+		}
+		m_dirtyFlags &= ~DeepDirty;
+	}
+	return m_deep;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Tile storage
 //////////////////////////////////////////////////////////////////////////
@@ -684,6 +726,10 @@ const std::vector<std::string> &ImageGadget::channelNames() const
 namespace
 {
 
+// Beyond this, tiles are so small on screen that coarser levels would
+// save little work.
+const int g_maxMipLevel = 8;
+
 IECoreGL::Texture *blackTexture()
 {
 	static IECoreGL::TexturePtr g_texture;
@@ -811,6 +857,12 @@ const IECoreGL::Texture *ImageGadget::Tile::texture( bool &active )
 	return m_texture ? m_texture.get() : blackTexture();
 }
 
+bool ImageGadget::Tile::hasData()
+{
+	Mutex::scoped_lock lock( m_mutex );
+	return m_texture || m_channelDataToConvert;
+}
+
 void ImageGadget::updateTiles()
 {
 	if( !(m_dirtyFlags & TilesDirty) )
@@ -860,10 +912,11 @@ void ImageGadget::updateTiles()
 
 		vector<Tile::Update> updates;
 		ImagePlug::ChannelDataScope channelScope( Context::current() );
+		const int mipLevel = Context::current()->get<int>( ImagePlug::mipLevelContextName, 0 );
 		for( auto &channelName : channelsToCompute )
 		{
 			channelScope.setChannelName( &channelName );
-			Tile &tile = m_tiles[TileIndex(tileOrigin, channelName)];
+			Tile &tile = m_tiles[TileIndex(tileOrigin, channelName, mipLevel)];
 			updates.push_back( tile.computeUpdate( image ) );
 		}
 
@@ -890,14 +943,37 @@ void ImageGadget::updateTiles()
 	// This means that any internal nodes of ImageGadget are not part of the automatic
 	// task cancellation and we must ensure that we never modify internal nodes while
 	// the background task is running ( this is easier now that there are no internal nodes ).
+
+	// When mip mapping, we first compute a coarser level that is quick to
+	// generate, so that renderTiles() has something to display while the
+	// tiles at the final level are computed.
+	vector<int> mipLevels;
+	if( m_mipMapping && !deep() && m_mipLevel + 2 <= g_maxMipLevel )
+	{
+		mipLevels.push_back( m_mipLevel + 2 );
+	}
+	mipLevels.push_back( m_mipLevel );
+
 	Context::Scope scopedContext( m_context.get() );
 	m_tilesTask = ParallelAlgo::callOnBackgroundThread(
 		// Subject
 		m_image.get(),
 		// OK to capture `this` via raw pointer, because ~ImageGadget waits for
 		// the background process to complete.
-		[ this, channelsToCompute, dataWindow, tileFunctor ] {
-			ImageAlgo::parallelProcessTiles( m_image.get(), tileFunctor, dataWindow );
+		[ this, channelsToCompute, dataWindow, mipLevels, tileFunctor ] {
+			Context::EditableScope mipLevelScope( Context::current() );
+			for( const int &mipLevel : mipLevels )
+			{
+				if( mipLevel )
+				{
+					mipLevelScope.set( ImagePlug::mipLevelContextName, &mipLevel );
+				}
+				else
+				{
+					mipLevelScope.remove( ImagePlug::mipLevelContextName );
+				}
+				ImageAlgo::parallelProcessTiles( m_image.get(), tileFunctor, ImageAlgo::mipLevelWindow( dataWindow, mipLevel ) );
+			}
 			m_dirtyFlags &= ~TilesDirty;
 			if( refCount() )
 			{
@@ -922,12 +998,19 @@ void ImageGadget::removeOutOfBoundsTiles() const
 	// so here we prune out any tiles that we know can't be useful for
 	// the current image, because they either have an invalid channel
 	// name or are outside the data window.
+	// We also prune tiles from mip levels finer than the one we're
+	// displaying, but keep coarser ones to use as placeholders.
 	const Box2i &dw = dataWindow();
 	const vector<string> &ch = channelNames();
 	for( Tiles::iterator it = m_tiles.begin(); it != m_tiles.end(); )
 	{
-		const Box2i tileBound( it->first.tileOrigin, it->first.tileOrigin + V2i( ImagePlug::tileSize() ) );
-		if( !BufferAlgo::intersects( dw, tileBound ) || find( ch.begin(), ch.end(), it->first.channelName.string() ) == ch.end() )
+		const TileIndex &index = it->first;
+		const Box2i tileBound( index.tileOrigin, index.tileOrigin + V2i( ImagePlug::tileSize() ) );
+		if(
+			index.mipLevel < m_mipLevel ||
+			!BufferAlgo::intersects( ImageAlgo::mipLevelWindow( dw, index.mipLevel ), tileBound ) ||
+			find( ch.begin(), ch.end(), index.channelName.string() ) == ch.end()
+		)
 		{
 			it = m_tiles.unsafe_erase( it );
 		}
@@ -938,6 +1021,31 @@ void ImageGadget::removeOutOfBoundsTiles() const
 	}
 }
 
+void ImageGadget::updateMipLevel()
+{
+	int mipLevel = 0;
+	const ViewportGadget *viewport = ancestor<ViewportGadget>();
+	if( m_mipMapping && viewport && !deep() )
+	{
+		// Choose the coarsest level where each pixel still covers
+		// no more than one pixel on screen.
+		const V2f p0 = viewport->gadgetToRasterSpace( V3f( 0 ), this );
+		const V2f p1 = viewport->gadgetToRasterSpace( V3f( 0, 1, 0 ), this );
+		const float rasterPixelsPerPixel = fabs( p1.y - p0.y );
+		if( rasterPixelsPerPixel > 0 )
+		{
+			mipLevel = std::clamp( (int)floorf( log2f( 1.0f / rasterPixelsPerPixel ) ), 0, g_maxMipLevel );
+		}
+	}
+
+	if( mipLevel != m_mipLevel )
+	{
+		m_tilesTask.reset();
+		m_mipLevel = mipLevel;
+		m_dirtyFlags |= TilesDirty;
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Rendering
 //////////////////////////////////////////////////////////////////////////
@@ -950,7 +1058,7 @@ void ImageGadget::visibilityChanged()
 	}
 }
 
-void ImageGadget::renderTiles() const
+void ImageGadget::renderTiles( const std::vector<std::string> &channelNames ) const
 {
 	float radians = m_wipeAngle * M_PI / 180.0f;
 	const Box2i dataWindow = this->dataWindow();
@@ -963,18 +1071,61 @@ void ImageGadget::renderTiles() const
 	);
 
 	const float pixelAspect = this->format().getPixelAspect();
+	const int tileSize = ImagePlug::tileSize();
 
-	V2i tileOrigin = ImagePlug::tileOrigin( dataWindow.min );
-	for( ; tileOrigin.y < dataWindow.max.y; tileOrigin.y += ImagePlug::tileSize() )
+	InternedString tileChannels[4];
+	for( int i = 0; i < 4; ++i )
 	{
-		for( tileOrigin.x = ImagePlug::tileOrigin( dataWindow.min ).x; tileOrigin.x < dataWindow.max.x; tileOrigin.x += ImagePlug::tileSize() )
+		tileChannels[i] = ( m_soloChannel < 0 || i == 3 ) ? m_rgbaChannels[i] : m_rgbaChannels[m_soloChannel];
+	}
+
+	// Returns true if all the channels we need for a tile have been computed.
+	// Channels which don't exist in the image are never computed, and will be
+	// drawn black regardless.
+	auto tileHasData = [&] ( const V2i &tileOrigin, int mipLevel ) {
+		for( const auto &channelName : tileChannels )
 		{
+			if( find( channelNames.begin(), channelNames.end(), channelName.string() ) == channelNames.end() )
+			{
+				continue;
+			}
+			Tiles::iterator it = m_tiles.find( TileIndex( tileOrigin, channelName, mipLevel ) );
+			if( it == m_tiles.end() || !it->second.hasData() )
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// We iterate over the tiles at the mip level we want to display, but
+	// if a tile hasn't been computed yet we draw the region it covers using
+	// a coarser level instead, if one is available.
+	const Box2i mipLevelDataWindow = ImageAlgo::mipLevelWindow( dataWindow, m_mipLevel );
+	V2i tileOrigin = ImagePlug::tileOrigin( mipLevelDataWindow.min );
+	for( ; tileOrigin.y < mipLevelDataWindow.max.y; tileOrigin.y += tileSize )
+	{
+		for( tileOrigin.x = ImagePlug::tileOrigin( mipLevelDataWindow.min ).x; tileOrigin.x < mipLevelDataWindow.max.x; tileOrigin.x += tileSize )
+		{
+			int drawLevel = m_mipLevel;
+			V2i drawTileOrigin = tileOrigin;
+			for( int level = m_mipLevel; level <= g_maxMipLevel; ++level )
+			{
+				const int shift = level - m_mipLevel;
+				const V2i levelTileOrigin = ImagePlug::tileOrigin( V2i( tileOrigin.x >> shift, tileOrigin.y >> shift ) );
+				if( tileHasData( levelTileOrigin, level ) )
+				{
+					drawLevel = level;
+					drawTileOrigin = levelTileOrigin;
+					break;
+				}
+			}
+
 			bool active = false;
 			IECoreGL::ConstTexturePtr channelTextures[4];
 			for( int i = 0; i < 4; ++i )
 			{
-				const InternedString channelName = ( m_soloChannel < 0 || i == 3 ) ? m_rgbaChannels[i] : m_rgbaChannels[m_soloChannel];
-				Tiles::const_iterator it = m_tiles.find( TileIndex( tileOrigin, channelName ) );
+				Tiles::iterator it = m_tiles.find( TileIndex( drawTileOrigin, tileChannels[i], drawLevel ) );
 				if( it != m_tiles.end() )
 				{
 					channelTextures[i] = it->second.texture( active );
@@ -983,20 +1134,33 @@ void ImageGadget::renderTiles() const
 				{
 					channelTextures[i] = blackTexture();
 				}
+
+				if( drawLevel != m_mipLevel )
+				{
+					// Drawing a placeholder, but we still want to show if the
+					// tile we actually want is being computed.
+					it = m_tiles.find( TileIndex( tileOrigin, tileChannels[i], m_mipLevel ) );
+					if( it != m_tiles.end() )
+					{
+						it->second.texture( active );
+					}
+				}
 			}
 			shaderBinding.loadTile( channelTextures, active );
 
-			const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
-			const Box2i validBound = BufferAlgo::intersection( tileBound, dataWindow );
+			// The region covered by the tile, in full resolution pixel space.
+			const int scale = 1 << m_mipLevel;
+			const Box2i validBound = BufferAlgo::intersection(
+				Box2i( tileOrigin * scale, ( tileOrigin + V2i( tileSize ) ) * scale ),
+				dataWindow
+			);
+
+			// And the texture coordinates for that region in the tile we're drawing.
+			const float drawScale = 1 << drawLevel;
+			const V2f drawTileOriginF( drawTileOrigin );
 			const Box2f uvBound(
-				V2f(
-					lerpfactor<float>( validBound.min.x, tileBound.min.x, tileBound.max.x ),
-					lerpfactor<float>( validBound.min.y, tileBound.min.y, tileBound.max.y )
-				),
-				V2f(
-					lerpfactor<float>( validBound.max.x, tileBound.min.x, tileBound.max.x ),
-					lerpfactor<float>( validBound.max.y, tileBound.min.y, tileBound.max.y )
-				)
+				( V2f( validBound.min ) / drawScale - drawTileOriginF ) / tileSize,
+				( V2f( validBound.max ) / drawScale - drawTileOriginF ) / tileSize
 			);
 
 			glBegin( GL_QUADS );
@@ -1052,10 +1216,13 @@ void ImageGadget::renderLayer( Layer layer, const GafferUI::Style *style, Render
 
 	Format format;
 	Box2i dataWindow;
+	vector<string> channelNames;
 	try
 	{
 		format = this->format();
 		dataWindow = this->dataWindow();
+		channelNames = this->channelNames();
+		const_cast<ImageGadget *>( this )->updateMipLevel();
 		const_cast<ImageGadget *>( this )->updateTiles();
 	}
 	catch( ... )
@@ -1108,7 +1275,7 @@ void ImageGadget::renderLayer( Layer layer, const GafferUI::Style *style, Render
 
 	if( layer == Layer::Main )
 	{
-		renderTiles();
+		renderTiles( channelNames );
 		return;
 	}
 
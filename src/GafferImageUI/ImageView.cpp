@@ -1472,6 +1472,8 @@ ImageView::ImageView( const std::string &name )
 	channelsDefaultData->writable() = { "R", "G", "B", "A" };
 	addChild( new StringVectorDataPlug( "channels", Plug::In, channelsDefaultData ) );
 
+	addChild( new BoolPlug( "mipMapping", Plug::In, false, Plug::Default & ~Plug::AcceptsInputs ) );
+
 	[[maybe_unused]] auto displayTransform = new DisplayTransform( this );
 	assert( displayTransform->parent() == this );
 
@@ -1649,6 +1651,16 @@ const Gaffer::BoolPlug *ImageView::compareMatchDisplayWindowsPlug() const
 	return getChild<Plug>( "compare" )->getChild<BoolPlug>( "matchDisplayWindows" );
 }
 
+Gaffer::BoolPlug *ImageView::mipMappingPlug()
+{
+	return getChild<BoolPlug>( "mipMapping" );
+}
+
+const Gaffer::BoolPlug *ImageView::mipMappingPlug() const
+{
+	return getChild<BoolPlug>( "mipMapping" );
+}
+
 Gaffer::BoolPlug *ImageView::compareWipePlug()
 {
 	return getChild<Plug>( "compare" )->getChild<BoolPlug>( "wipe" );
@@ -1768,6 +1780,12 @@ void ImageView::plugSet( Gaffer::Plug *plug )
 		m_imageGadgets[0]->setSoloChannel( soloChannel );
 		m_imageGadgets[1]->setSoloChannel( soloChannel );
 	}
+	else if( plug == mipMappingPlug() )
+	{
+		const bool mipMapping = mipMappingPlug()->getValue();
+		m_imageGadgets[0]->setMipMapping( mipMapping );
+		m_imageGadgets[1]->setMipMapping( mipMapping );
+	}
 }
 
 void ImageView::setWipeActive( bool active )
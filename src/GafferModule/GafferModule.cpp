@@ -50,6 +50,7 @@
 #include "ExpressionBinding.h"
 #include "GraphComponentBinding.h"
 #include "ProcessMessageHandlerBinding.h"
+#include "MemoryGovernorBinding.h"
 #include "MetadataAlgoBinding.h"
 #include "MetadataBinding.h"
 #include "MonitorBinding.h"
@@ -249,6 +250,7 @@ BOOST_PYTHON_MODULE( _Gaffer )
 	bindTweakPlugs();
 	bindOptionalValuePlug();
 	bindCollect();
+	bindMemoryGovernor();
 
 	NodeClass<Backdrop>();
 
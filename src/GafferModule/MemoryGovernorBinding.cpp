@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2023, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "boost/python.hpp"
+
+#include "MemoryGovernorBinding.h"
+
+#include "Gaffer/MemoryGovernor.h"
+
+#include "IECorePython/ScopedGILRelease.h"
+
+using namespace boost::python;
+using namespace Gaffer;
+using namespace Gaffer::MemoryGovernor;
+
+namespace
+{
+
+std::string memoryStatisticsRepr( const MemoryStatistics &s )
+{
+	return "Gaffer.MemoryGovernor.MemoryStatistics( used = " + std::to_string( s.used ) + ", limit = " + std::to_string( s.limit ) + " )";
+}
+
+MemoryStatistics *memoryStatisticsConstructor( size_t used, size_t limit )
+{
+	MemoryStatistics *result = new MemoryStatistics;
+	result->used = used;
+	result->limit = limit;
+	return result;
+}
+
+boost::python::list registeredCachesWrapper()
+{
+	boost::python::list result;
+	for( const auto &name : registeredCaches() )
+	{
+		result.append( name );
+	}
+	return result;
+}
+
+tuple getPressureThresholdsWrapper()
+{
+	float low, high;
+	getPressureThresholds( low, high );
+	return boost::python::make_tuple( low, high );
+}
+
+void deregisterCacheWrapper( const std::string &name )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	deregisterCache( name );
+}
+
+void setEnabledWrapper( bool enabled )
+{
+	// Releasing the GIL is essential, as we may need to wait
+	// for the background thread to finish.
+	IECorePython::ScopedGILRelease gilRelease;
+	setEnabled( enabled );
+}
+
+void setUpdateIntervalWrapper( float seconds )
+{
+	setUpdateInterval( std::chrono::milliseconds( (long)( seconds * 1000.0f ) ) );
+}
+
+float getUpdateIntervalWrapper()
+{
+	return (float)getUpdateInterval().count() / 1000.0f;
+}
+
+float updateWrapper1()
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return update();
+}
+
+float updateWrapper2( const MemoryStatistics &statistics )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return update( statistics );
+}
+
+} // namespace
+
+void GafferModule::bindMemoryGovernor()
+{
+	object module( borrowed( PyImport_AddModule( "Gaffer.MemoryGovernor" ) ) );
+	scope().attr( "MemoryGovernor" ) = module;
+	scope moduleScope( module );
+
+	class_<MemoryStatistics>( "MemoryStatistics" )
+		.def( "__init__", make_constructor( &memoryStatisticsConstructor, default_call_policies(), ( arg( "used" ) = 0, arg( "limit" ) = 0 ) ) )
+		.def_readwrite( "used", &MemoryStatistics::used )
+		.def_readwrite( "limit", &MemoryStatistics::limit )
+		.def( "__repr__", &memoryStatisticsRepr )
+	;
+
+	def( "memoryStatistics", &memoryStatistics );
+
+	def( "deregisterCache", &deregisterCacheWrapper );
+	def( "registeredCaches", &registeredCachesWrapper );
+
+	def( "setMaximumLimit", &setMaximumLimit );
+	def( "setMaximumLimitFraction", &setMaximumLimitFraction );
+	def( "getMaximumLimit", &getMaximumLimit );
+
+	def( "setPressureThresholds", &setPressureThresholds, ( arg( "low" ), arg( "high" ) ) );
+	def( "getPressureThresholds", &getPressureThresholdsWrapper );
+	def( "setMinimumScale", &setMinimumScale );
+	def( "getMinimumScale", &getMinimumScale );
+	def( "setGrowthRate", &setGrowthRate );
+	def( "getGrowthRate", &getGrowthRate );
+
+	def( "setEnabled", &setEnabledWrapper );
+	def( "getEnabled", &getEnabled );
+	def( "setUpdateInterval", &setUpdateIntervalWrapper );
+	def( "getUpdateInterval", &getUpdateIntervalWrapper );
+
+	def( "update", &updateWrapper1 );
+	def( "update", &updateWrapper2 );
+	def( "getScale", &getScale );
+}
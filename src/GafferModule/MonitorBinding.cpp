@@ -45,6 +45,7 @@
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadMonitor.h"
+#include "Gaffer/TraceMonitor.h"
 #include "Gaffer/VTuneMonitor.h"
 
 #include "IECorePython/RefCountedBinding.h"
@@ -64,8 +65,10 @@ namespace
 std::string repr( PerformanceMonitor::Statistics &s )
 {
 	return fmt::format(
-		"Gaffer.PerformanceMonitor.Statistics( hashCount = {}, computeCount = {}, hashDuration = {}, computeDuration = {} )",
-			s.hashCount, s.computeCount, s.hashDuration.count(), s.computeDuration.count()
+		"Gaffer.PerformanceMonitor.Statistics( hashCount = {}, computeCount = {}, hashDuration = {}, computeDuration = {}, "
+		"collaborationCount = {}, cycleFallbackCount = {}, waitCount = {}, waitDuration = {}, stolenCount = {} )",
+			s.hashCount, s.computeCount, s.hashDuration.count(), s.computeDuration.count(),
+			s.collaborationCount, s.cycleFallbackCount, s.waitCount, s.waitDuration.count(), s.stolenCount
 	);
 }
 
@@ -73,10 +76,18 @@ PerformanceMonitor::Statistics *statisticsConstructor(
 	size_t hashCount,
 	size_t computeCount,
 	boost::chrono::nanoseconds::rep hashDuration,
-	boost::chrono::nanoseconds::rep computeDuration
+	boost::chrono::nanoseconds::rep computeDuration,
+	size_t collaborationCount,
+	size_t cycleFallbackCount,
+	size_t waitCount,
+	boost::chrono::nanoseconds::rep waitDuration,
+	size_t stolenCount
 )
 {
-	return new PerformanceMonitor::Statistics( hashCount, computeCount, boost::chrono::nanoseconds( hashDuration ), boost::chrono::nanoseconds( computeDuration ) );
+	return new PerformanceMonitor::Statistics(
+		hashCount, computeCount, boost::chrono::nanoseconds( hashDuration ), boost::chrono::nanoseconds( computeDuration ),
+		collaborationCount, cycleFallbackCount, waitCount, boost::chrono::nanoseconds( waitDuration ), stolenCount
+	);
 }
 
 boost::chrono::nanoseconds::rep getHashDuration( PerformanceMonitor::Statistics &s )
@@ -99,6 +110,16 @@ void setComputeDuration( PerformanceMonitor::Statistics &s, boost::chrono::nanos
 	s.computeDuration = boost::chrono::nanoseconds( v );
 }
 
+boost::chrono::nanoseconds::rep getWaitDuration( PerformanceMonitor::Statistics &s )
+{
+	return s.waitDuration.count();
+}
+
+void setWaitDuration( PerformanceMonitor::Statistics &s, boost::chrono::nanoseconds::rep v )
+{
+	s.waitDuration = boost::chrono::nanoseconds( v );
+}
+
 template<typename T>
 dict allStatistics( T &m )
 {
@@ -199,6 +220,19 @@ dict threadMonitorCombinedStatisticsWrapper( const ThreadMonitor &monitor )
 	return processesPerThreadToPython( monitor.combinedStatistics() );
 }
 
+TraceMonitor::Ptr traceMonitorConstructor( boost::python::object pythonProcessMask, size_t eventsPerThread )
+{
+	std::vector<IECore::InternedString> processMask;
+	container_utils::extend_container( processMask, pythonProcessMask );
+	return new TraceMonitor( processMask, eventsPerThread );
+}
+
+void traceMonitorWriteChromeTrace( const TraceMonitor &monitor, const std::string &fileName )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	monitor.writeChromeTrace( fileName );
+}
+
 } // namespace
 
 void GafferModule::bindMonitor()
@@ -219,6 +253,12 @@ void GafferModule::bindMonitor()
 			.value( "HashCount", HashCount )
 			.value( "ComputeCount", ComputeCount )
 			.value( "HashesPerCompute", HashesPerCompute )
+			.value( "CollaborationCount", CollaborationCount )
+			.value( "CycleFallbackCount", CycleFallbackCount )
+			.value( "WaitCount", WaitCount )
+			.value( "WaitDuration", WaitDuration )
+			.value( "WaitsPerCollaboration", WaitsPerCollaboration )
+			.value( "StolenCount", StolenCount )
 		;
 
 		def(
@@ -283,7 +323,12 @@ void GafferModule::bindMonitor()
 						arg( "hashCount" ) = 0,
 						arg( "computeCount" ) = 0,
 						arg( "hashDuration" ) = 0,
-						arg( "computeDuration" ) = 0
+						arg( "computeDuration" ) = 0,
+						arg( "collaborationCount" ) = 0,
+						arg( "cycleFallbackCount" ) = 0,
+						arg( "waitCount" ) = 0,
+						arg( "waitDuration" ) = 0,
+						arg( "stolenCount" ) = 0
 					)
 				)
 			)
@@ -291,6 +336,11 @@ void GafferModule::bindMonitor()
 			.def_readwrite( "computeCount", &PerformanceMonitor::Statistics::computeCount )
 			.add_property( "hashDuration", &getHashDuration, &setHashDuration )
 			.add_property( "computeDuration", &getComputeDuration, &setComputeDuration )
+			.def_readwrite( "collaborationCount", &PerformanceMonitor::Statistics::collaborationCount )
+			.def_readwrite( "cycleFallbackCount", &PerformanceMonitor::Statistics::cycleFallbackCount )
+			.def_readwrite( "waitCount", &PerformanceMonitor::Statistics::waitCount )
+			.add_property( "waitDuration", &getWaitDuration, &setWaitDuration )
+			.def_readwrite( "stolenCount", &PerformanceMonitor::Statistics::stolenCount )
 			.def( self == self )
 			.def( self != self )
 			.def( "__repr__", &repr )
@@ -332,6 +382,24 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<TraceMonitor, Monitor>( "TraceMonitor" )
+			.def(
+				"__init__",
+				make_constructor(
+					traceMonitorConstructor, default_call_policies(),
+					(
+						arg( "processMask" ) = boost::python::tuple(),
+						arg( "eventsPerThread" ) = 100000
+					)
+				)
+			)
+			.def( "numEvents", &TraceMonitor::numEvents )
+			.def( "writeChromeTrace", &traceMonitorWriteChromeTrace )
+			.def( "clear", &TraceMonitor::clear )
+		;
+	}
+
 #ifdef GAFFER_VTUNE
 	{
 		scope s = IECorePython::RefCountedClass<VTuneMonitor, Monitor>( "VTuneMonitor" )
@@ -49,6 +49,8 @@
 #include "Gaffer/Reference.h"
 #include "Gaffer/Metadata.h"
 
+#include "fmt/format.h"
+
 using namespace boost::python;
 using namespace GafferBindings;
 using namespace Gaffer;
@@ -103,6 +105,32 @@ void hash2( ValuePlug *plug, IECore::MurmurHash &h )
 	plug->hash( h);
 }
 
+dict cacheStatistics()
+{
+	dict result;
+	for( const auto &[nodeName, statistics] : ValuePlug::cacheStatistics() )
+	{
+		result[nodeName] = statistics;
+	}
+	return result;
+}
+
+std::string cacheStatisticsRepr( const ValuePlug::CacheStatistics &s )
+{
+	return fmt::format(
+		"Gaffer.ValuePlug.CacheStatistics( entries = {}, memoryUsage = {}, hits = {}, misses = {}, evictions = {} )",
+		s.entries, s.memoryUsage, s.hits, s.misses, s.evictions
+	);
+}
+
+std::string compressedCacheStatisticsRepr( const ValuePlug::CompressedCacheStatistics &s )
+{
+	return fmt::format(
+		"Gaffer.ValuePlug.CompressedCacheStatistics( entries = {}, memoryUsage = {}, uncompressedMemoryUsage = {}, hits = {}, misses = {} )",
+		s.entries, s.memoryUsage, s.uncompressedMemoryUsage, s.hits, s.misses
+	);
+}
+
 
 } // namespace
 
@@ -133,12 +161,50 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "cacheMemoryUsage" )
 		.def( "clearCache", &ValuePlug::clearCache )
 		.staticmethod( "clearCache" )
+		.def( "setCompressedCacheMemoryLimit", &ValuePlug::setCompressedCacheMemoryLimit )
+		.staticmethod( "setCompressedCacheMemoryLimit" )
+		.def( "getCompressedCacheMemoryLimit", &ValuePlug::getCompressedCacheMemoryLimit )
+		.staticmethod( "getCompressedCacheMemoryLimit" )
+		.def( "compressedCacheMemoryUsage", &ValuePlug::compressedCacheMemoryUsage )
+		.staticmethod( "compressedCacheMemoryUsage" )
+		.def( "compressedCacheStatistics", &ValuePlug::compressedCacheStatistics )
+		.staticmethod( "compressedCacheStatistics" )
+		.def( "clearCompressedCacheStatistics", &ValuePlug::clearCompressedCacheStatistics )
+		.staticmethod( "clearCompressedCacheStatistics" )
+		.def( "setPersistentCacheDirectory", &ValuePlug::setPersistentCacheDirectory )
+		.staticmethod( "setPersistentCacheDirectory" )
+		.def( "getPersistentCacheDirectory", &ValuePlug::getPersistentCacheDirectory )
+		.staticmethod( "getPersistentCacheDirectory" )
+		.def( "setPersistentCacheSizeLimit", &ValuePlug::setPersistentCacheSizeLimit )
+		.staticmethod( "setPersistentCacheSizeLimit" )
+		.def( "getPersistentCacheSizeLimit", &ValuePlug::getPersistentCacheSizeLimit )
+		.staticmethod( "getPersistentCacheSizeLimit" )
+		.def( "setPersistentCacheCostThreshold", &ValuePlug::setPersistentCacheCostThreshold )
+		.staticmethod( "setPersistentCacheCostThreshold" )
+		.def( "getPersistentCacheCostThreshold", &ValuePlug::getPersistentCacheCostThreshold )
+		.staticmethod( "getPersistentCacheCostThreshold" )
+		.def( "persistentCacheUsage", &ValuePlug::persistentCacheUsage )
+		.staticmethod( "persistentCacheUsage" )
+		.def( "clearPersistentCache", &ValuePlug::clearPersistentCache )
+		.staticmethod( "clearPersistentCache" )
+		.def( "addPersistentCacheKeyComponent", &ValuePlug::addPersistentCacheKeyComponent )
+		.staticmethod( "addPersistentCacheKeyComponent" )
+		.def( "setCacheStatisticsEnabled", &ValuePlug::setCacheStatisticsEnabled )
+		.staticmethod( "setCacheStatisticsEnabled" )
+		.def( "getCacheStatisticsEnabled", &ValuePlug::getCacheStatisticsEnabled )
+		.staticmethod( "getCacheStatisticsEnabled" )
+		.def( "cacheStatistics", &cacheStatistics )
+		.staticmethod( "cacheStatistics" )
+		.def( "clearCacheStatistics", &ValuePlug::clearCacheStatistics )
+		.staticmethod( "clearCacheStatistics" )
 		.def( "getHashCacheSizeLimit", &ValuePlug::getHashCacheSizeLimit )
 		.staticmethod( "getHashCacheSizeLimit" )
 		.def( "setHashCacheSizeLimit", &ValuePlug::setHashCacheSizeLimit )
 		.staticmethod( "setHashCacheSizeLimit" )
 		.def( "hashCacheTotalUsage", &ValuePlug::hashCacheTotalUsage )
 		.staticmethod( "hashCacheTotalUsage" )
+		.def( "hashCacheMemoryUsage", &ValuePlug::hashCacheMemoryUsage )
+		.staticmethod( "hashCacheMemoryUsage" )
 		.def( "clearHashCache", &ValuePlug::clearHashCache, arg( "now" ) = false )
 		.staticmethod( "clearHashCache" )
 		.def( "getHashCacheMode", &ValuePlug::getHashCacheMode )
@@ -149,10 +215,30 @@ void GafferModule::bindValuePlug()
 		.def( "__repr__", &repr )
 	;
 
+	class_<ValuePlug::CacheStatistics>( "CacheStatistics" )
+		.def_readonly( "nodeType", &ValuePlug::CacheStatistics::nodeType )
+		.def_readonly( "entries", &ValuePlug::CacheStatistics::entries )
+		.def_readonly( "memoryUsage", &ValuePlug::CacheStatistics::memoryUsage )
+		.def_readonly( "hits", &ValuePlug::CacheStatistics::hits )
+		.def_readonly( "misses", &ValuePlug::CacheStatistics::misses )
+		.def_readonly( "evictions", &ValuePlug::CacheStatistics::evictions )
+		.def( "__repr__", &cacheStatisticsRepr )
+	;
+
+	class_<ValuePlug::CompressedCacheStatistics>( "CompressedCacheStatistics" )
+		.def_readonly( "entries", &ValuePlug::CompressedCacheStatistics::entries )
+		.def_readonly( "memoryUsage", &ValuePlug::CompressedCacheStatistics::memoryUsage )
+		.def_readonly( "uncompressedMemoryUsage", &ValuePlug::CompressedCacheStatistics::uncompressedMemoryUsage )
+		.def_readonly( "hits", &ValuePlug::CompressedCacheStatistics::hits )
+		.def_readonly( "misses", &ValuePlug::CompressedCacheStatistics::misses )
+		.def( "__repr__", &compressedCacheStatisticsRepr )
+	;
+
 	enum_<ValuePlug::HashCacheMode>( "HashCacheMode" )
 		.value( "Standard", ValuePlug::HashCacheMode::Standard )
 		.value( "Checked", ValuePlug::HashCacheMode::Checked )
 		.value( "Legacy", ValuePlug::HashCacheMode::Legacy )
+		.value( "Global", ValuePlug::HashCacheMode::Global )
 	;
 
 	enum_<ValuePlug::CachePolicy>( "CachePolicy" )
@@ -162,6 +248,7 @@ void GafferModule::bindValuePlug()
 		.value( "TaskIsolation", ValuePlug::CachePolicy::TaskIsolation )
 		.value( "Default", ValuePlug::CachePolicy::Default )
 		.value( "Legacy", ValuePlug::CachePolicy::Legacy )
+		.value( "Persistent", ValuePlug::CachePolicy::Persistent )
 	;
 
 	Serialisation::registerSerialiser( Gaffer::ValuePlug::staticTypeId(), new ValuePlugSerialiser );
@@ -324,6 +324,41 @@ void GafferTest::testContextCopyPerformance( int numEntries, int entrySize )
 
 }
 
+void GafferTest::testContextLookupPerformance( int numEntries, const std::string &variableName )
+{
+	// Emulates the typical access pattern within a compute, where a variable
+	// such as `image:tileOrigin` is set in an EditableScope, and then
+	// retrieved and hashed upstream. Comparing a variable with a dedicated
+	// slot against one without shows the benefit of the slots.
+	ContextPtr baseContext = new Context();
+	for( int i = 0; i < numEntries; i++ )
+	{
+		baseContext->set( InternedString( i ), std::string( 10, 'x') );
+	}
+
+	const InternedString name = variableName;
+	baseContext->set( name, -1 );
+	const MurmurHash baseHash = baseContext->hash();
+
+	Context::Scope baseScope( baseContext.get() );
+	const ThreadState &threadState = ThreadState::current();
+
+	tbb::parallel_for( tbb::blocked_range<int>( 0, 10000000 ), [&threadState, &name, &baseHash]( const tbb::blocked_range<int> &r )
+		{
+			for( int i = r.begin(); i != r.end(); ++i )
+			{
+				Context::EditableScope scope( threadState );
+				scope.set( name, &i );
+				for( int j = 0; j < 10; ++j )
+				{
+					GAFFERTEST_ASSERT( scope.context()->get<int>( name ) == i );
+				}
+				GAFFERTEST_ASSERT( scope.context()->hash() != baseHash );
+			}
+		}
+	);
+}
+
 void GafferTest::testCopyEditableScope()
 {
 	ContextPtr copy;
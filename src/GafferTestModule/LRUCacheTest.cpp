@@ -772,7 +772,7 @@ struct TestLRUCacheSetIfUncached
 		size_t numCostFunctionCalls = 0;
 		auto costFunction = [&] ( int value ) {
 			++numCostFunctionCalls;
-			return 1;
+			return 3;
 		};
 
 		// Value already cached, set should be skipped and
@@ -791,6 +791,12 @@ struct TestLRUCacheSetIfUncached
 		GAFFERTEST_ASSERTEQUAL( *cache.getIfCached( 2 ), 2 );
 		GAFFERTEST_ASSERTEQUAL( numCostFunctionCalls, 1 );
 
+		// Costs are available for cached items only.
+
+		GAFFERTEST_ASSERTEQUAL( *cache.cost( 1 ), 1 );
+		GAFFERTEST_ASSERTEQUAL( *cache.cost( 2 ), 3 );
+		GAFFERTEST_ASSERT( !cache.cost( 3 ) );
+
 	}
 
 };
@@ -800,6 +806,73 @@ void testLRUCacheSetIfUncached( const std::string &policy )
 	DispatchTest<TestLRUCacheSetIfUncached>()( policy );
 }
 
+template<template<typename> class Policy>
+struct TestLRUCacheCostAwareEviction
+{
+
+	void operator()()
+	{
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+
+		const size_t meshCost = 200 * 1024 * 1024;
+		const typename Cache::Duration meshDuration = std::chrono::seconds( 40 );
+		const size_t tileCost = 4 * 1024;
+		const typename Cache::Duration tileDuration = std::chrono::microseconds( 50 );
+
+		for( auto evictionPolicy : { Cache::EvictionPolicy::LRU, Cache::EvictionPolicy::CostAware } )
+		{
+			Cache cache(
+				[]( int key, size_t &cost, const IECore::Canceller *canceller ) {
+					cost = tileCost;
+					return key;
+				},
+				meshCost + 100 * tileCost, typename Cache::RemovalCallback(), /* cacheErrors = */ true, evictionPolicy
+			);
+
+			GAFFERTEST_ASSERT( cache.getEvictionPolicy() == evictionPolicy );
+
+			// A mesh which took a long time to compute relative to its
+			// size, followed by a stream of image tiles which were cheap
+			// to compute, filling the remaining space ten times over.
+			// Recomputing the mesh would cost as much as 800,000 tiles.
+			// One tile is accessed repeatedly throughout.
+
+			cache.set( 0, 0, meshCost, meshDuration );
+			for( int i = 1; i <= 1000; ++i )
+			{
+				cache.set( i, i, tileCost, tileDuration );
+				cache.get( 1 );
+			}
+
+			// The mesh should only have survived if eviction
+			// takes compute time into account. The frequently
+			// used tile should always have survived.
+
+			GAFFERTEST_ASSERTEQUAL( cache.cached( 0 ), evictionPolicy == Cache::EvictionPolicy::CostAware );
+			GAFFERTEST_ASSERT( cache.currentCost() <= cache.getMaxCost() );
+			GAFFERTEST_ASSERTEQUAL( cache.cached( 1 ), true );
+			GAFFERTEST_ASSERTEQUAL( cache.cached( 1000 ), true );
+
+			// But the tiles inflate the priority of everything inserted
+			// after them, so the mesh must still be evicted eventually,
+			// rather than clogging the cache once it is no longer used.
+
+			for( int i = 1001; i <= 10000; ++i )
+			{
+				cache.set( i, i, tileCost, tileDuration );
+			}
+			GAFFERTEST_ASSERTEQUAL( cache.cached( 0 ), false );
+			GAFFERTEST_ASSERTEQUAL( cache.cached( 10000 ), true );
+		}
+	}
+
+};
+
+void testLRUCacheCostAwareEviction( const std::string &policy )
+{
+	DispatchTest<TestLRUCacheCostAwareEviction>()( policy );
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -815,4 +888,5 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
 	def( "testLRUCacheSetIfUncached", &testLRUCacheSetIfUncached );
+	def( "testLRUCacheCostAwareEviction", &testLRUCacheCostAwareEviction );
 }
@@ -44,7 +44,9 @@
 #include "Gaffer/TypedObjectPlug.h"
 #include "Gaffer/ValuePlug.h"
 
+#include "tbb/global_control.h"
 #include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
 
 #include "IECorePython/ScopedGILRelease.h"
 
@@ -120,6 +122,36 @@ void parallelGetValueWithVar( const T *plug, int iterations, const IECore::Inter
 	);
 }
 
+// Calls `hash()` on the given plug many times in parallel, using a specific
+// number of threads and cycling through `numValues` distinct values for
+// `iterationVar`. Once warmed up, almost every call is a hit in the hash cache,
+// so this provides a microbenchmark for the cache lookup itself, and how it
+// scales with the number of threads.
+void parallelHash( const ValuePlug *plug, int iterations, const IECore::InternedString iterationVar, int numValues, int numThreads )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	const ThreadState &threadState = ThreadState::current();
+
+	tbb::global_control control( tbb::global_control::max_allowed_parallelism, numThreads );
+	tbb::task_arena arena( numThreads );
+	arena.execute(
+		[&] {
+			tbb::parallel_for(
+				tbb::blocked_range<int>( 0, iterations ),
+				[&plug, &iterationVar, &threadState, numValues]( const tbb::blocked_range<int> &r ) {
+					Context::EditableScope scope( threadState );
+					for( int i = r.begin(); i < r.end(); ++i )
+					{
+						const int value = i % numValues;
+						scope.set( iterationVar, &value );
+						plug->hash();
+					}
+				}
+			);
+		}
+	);
+}
+
 } // namespace
 
 void GafferTestModule::bindValuePlugTest()
@@ -144,4 +176,5 @@ void GafferTestModule::bindValuePlugTest()
 	def( "parallelGetValue", &parallelGetValueWithVar<StringPlug> );
 	def( "parallelGetValue", &parallelGetValueWithVar<ObjectPlug> );
 	def( "parallelGetValue", &parallelGetValueWithVar<PathMatcherDataPlug> );
+	def( "parallelHash", &parallelHash );
 }
@@ -34,6 +34,9 @@
 #
 ##########################################################################
 
+import atexit
+import os
+
 import psutil
 
 import Gaffer
@@ -44,3 +47,30 @@ import Gaffer
 Gaffer.ValuePlug.setCacheMemoryLimit(
 	min( 1024**3 * 8, psutil.virtual_memory().total * 3 // 4 )
 )
+
+# Set compressed cache memory limit to 1 gig, capped at 1/8 of the
+# total physical memory. This holds image tiles evicted from the
+# compute cache.
+
+Gaffer.ValuePlug.setCompressedCacheMemoryLimit(
+	min( 1024**3, psutil.virtual_memory().total // 8 )
+)
+
+# Enable the persistent on-disk cache if a location has been
+# provided for it.
+
+if os.environ.get( "GAFFER_PERSISTENT_CACHE_DIRECTORY" ) :
+	Gaffer.ValuePlug.setPersistentCacheDirectory( os.environ["GAFFER_PERSISTENT_CACHE_DIRECTORY"] )
+
+# Enable the memory governor if requested. This shrinks caches when memory
+# is scarce, which is useful when running in memory-limited containers on a
+# render farm. `GAFFER_MEMORY_GOVERNOR_CACHE_FRACTION` may be used to specify
+# the compute cache limit as a fraction of available memory.
+
+if os.environ.get( "GAFFER_MEMORY_GOVERNOR", "0" ) != "0" :
+	if os.environ.get( "GAFFER_MEMORY_GOVERNOR_CACHE_FRACTION" ) :
+		Gaffer.MemoryGovernor.setMaximumLimitFraction(
+			"ValuePlug:computeCache", float( os.environ["GAFFER_MEMORY_GOVERNOR_CACHE_FRACTION"] )
+		)
+	Gaffer.MemoryGovernor.setEnabled( True )
+	atexit.register( Gaffer.MemoryGovernor.setEnabled, False )
@@ -249,6 +249,12 @@ def __graphEditorCreated( graphEditor ) :
 		"performanceMonitor:perHashDuration",
 		"performanceMonitor:perComputeDuration",
 		"performanceMonitor:hashesPerCompute",
+		"performanceMonitor:collaborationCount",
+		"performanceMonitor:cycleFallbackCount",
+		"performanceMonitor:waitCount",
+		"performanceMonitor:waitDuration",
+		"performanceMonitor:waitsPerCollaboration",
+		"performanceMonitor:stolenCount",
 	}
 
 	annotationsGadget.setVisibleAnnotations( " ".join( visibleAnnotations ) )